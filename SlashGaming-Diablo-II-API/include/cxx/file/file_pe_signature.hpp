@@ -66,7 +66,9 @@ class FilePeSignature {
   static constexpr ::std::size_t kSignatureCount = Count;
 
   static constexpr ::std::size_t kSignatureSize =
-      kSignatureCount * sizeof(SignatureType::value_type);
+      kSignatureCount * sizeof(typename SignatureType::value_type);
+
+  static constexpr ::std::size_t kPeHeaderPointerOffset = 0x3C;
 
   constexpr FilePeSignature() noexcept
       : signature_() {
@@ -81,26 +83,82 @@ class FilePeSignature {
       const FilePeSignature& rhs
   ) noexcept = default;
 
+  constexpr const SignatureType& signature() const noexcept {
+    return this->signature_;
+  }
+
+  /**
+   * Reads the signature from the bytes of a PE file. Returns false if the
+   * PE header pointer or the signature is outside of the bytes.
+   */
+  static constexpr bool ReadBytes(
+      const ::std::uint8_t* data,
+      ::std::size_t size,
+      FilePeSignature* signature
+  ) noexcept {
+    if (size < kPeHeaderPointerOffset + sizeof(::std::uint32_t)) {
+      return false;
+    }
+
+    // Grab the pointer to the PE header.
+    ::std::size_t pe_header_pointer = 0;
+
+    for (::std::size_t i = 0; i < sizeof(::std::uint32_t); i += 1) {
+      pe_header_pointer |= static_cast<::std::size_t>(
+          data[kPeHeaderPointerOffset + i]
+      ) << (i * 8);
+    }
+
+    if (pe_header_pointer > size
+        || kSignatureSize > size - pe_header_pointer) {
+      return false;
+    }
+
+    // Read the PE header.
+    for (::std::size_t i = 0; i < kSignatureCount; i += 1) {
+      signature->signature_[i] = data[pe_header_pointer + i];
+    }
+
+    return true;
+  }
+
+  /**
+   * Reads the signature from the PE file at the specified path. Returns an
+   * all-zero signature if the file could not be read.
+   */
   static FilePeSignature ReadFile(const wchar_t* path) {
-    std::basic_ifstream<SignatureType::value_type> file_stream(
+    std::ifstream file_stream(
         path,
         std::ios_base::in | std::ios_base::binary
     );
 
     // Grab the pointer to the PE header.
-    file_stream.seekg(0x3C);
+    ::std::array<::std::uint8_t, sizeof(::std::uint32_t)>
+        pe_header_pointer_bytes;
 
-    ::std::intptr_t pe_header_pointer;
+    file_stream.seekg(kPeHeaderPointerOffset);
     file_stream.read(
-        reinterpret_cast<::std::uint8_t*>(&pe_header_pointer),
-        sizeof(pe_header_pointer)
+        reinterpret_cast<char*>(pe_header_pointer_bytes.data()),
+        pe_header_pointer_bytes.size()
     );
 
+    ::std::uint32_t pe_header_pointer = pe_header_pointer_bytes[0]
+        | (pe_header_pointer_bytes[1] << 8)
+        | (pe_header_pointer_bytes[2] << 16)
+        | (pe_header_pointer_bytes[3] << 24);
+
     // Read the PE header.
     file_stream.seekg(pe_header_pointer);
 
     FilePeSignature file_pe_signature;
-    file_stream.read(file_pe_signature.signature_.data(), kSignatureSize);
+    file_stream.read(
+        reinterpret_cast<char*>(file_pe_signature.signature_.data()),
+        kSignatureSize
+    );
+
+    if (!file_stream) {
+      return FilePeSignature();
+    }
 
     return file_pe_signature;
   }
@@ -139,6 +139,21 @@ class DLLEXPORT GameAddress {
   std::intptr_t raw_address_;
 };
 
+/**
+ * Resolves every address used by the API that is located in the
+ * specified library, loading the library if it is not loaded yet. This
+ * can be called during startup to avoid locating each address on the
+ * first call of its function or variable.
+ */
+DLLEXPORT void ResolveAllAddresses(::d2::DefaultLibrary library);
+
+/**
+ * Resolves every address used by the API that is located in a library
+ * the game has already loaded. Libraries that are not loaded, such as
+ * the renderers the game does not use, are skipped rather than loaded.
+ */
+DLLEXPORT void ResolveAllAddresses();
+
 } // namespace mapi
 
 #include "../dllexport_undefine.inc"
@@ -46,8 +46,13 @@
 #ifndef SGMAPI_CXX_GAME_PATCH_HPP_
 #define SGMAPI_CXX_GAME_PATCH_HPP_
 
+#include <cstddef>
 #include <cstdint>
-#include <vector>
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <memory>
+#include <type_traits>
 
 #include "game_address.hpp"
 #include "game_branch_type.hpp"
@@ -56,6 +61,8 @@
 
 namespace mapi {
 
+class GamePatchTransaction;
+
 /**
  * A game patch that is capable of replacing values in memory with
  * user-specified values and restoring the original state of the values in
@@ -85,15 +92,52 @@ class DLLEXPORT GamePatch {
   /**
    * Applies the patch by replacing the values at its target address with the
    * values stored in its buffer. Does nothing if the patch is applied.
+   *
+   * The patch is applied as a transaction of one patch on the process
+   * memory. Exits with an error if it overlaps a patch that is applied, or
+   * if its memory could not be made writable.
    */
   void Apply();
 
   /**
    * Removes the effects of the patch by restoring the patched entries to their
    * original values. Does nothing if the patch is not applied.
+   *
+   * The patch is removed as a transaction of one patch on the process
+   * memory. Exits with an error if its memory could not be made writable.
    */
   void Remove();
 
+  /**
+   * Make an instance of a back branch patch. The patch replaces the last
+   * bytes with a branch to a user-specified function, then replaces the
+   * remaining front bytes with no-op instructions.
+   *
+   * The patch size is the smallest size that covers whole instructions.
+   * Exits with an error if the instructions cannot be decoded or if the
+   * patched range contains the target of a nearby branch.
+   */
+  static GamePatch MakeGameBackBranchPatch(
+      const GameAddress& game_address,
+      BranchType branch_type,
+      void (*func_ptr)()
+  );
+
+  /**
+   * Make an instance of a back branch patch. The patch replaces the last
+   * bytes with a branch to a user-specified function, then replaces the
+   * remaining front bytes with no-op instructions.
+   *
+   * The patch size is the smallest size that covers whole instructions.
+   * Exits with an error if the instructions cannot be decoded or if the
+   * patched range contains the target of a nearby branch.
+   */
+  static GamePatch MakeGameBackBranchPatch(
+      GameAddress&& game_address,
+      BranchType branch_type,
+      void (*func_ptr)()
+  );
+
   /**
    * Make an instance of a back branch patch. The patch replaces the last
    * bytes with a branch to a user-specified function, then replaces the
@@ -118,6 +162,36 @@ class DLLEXPORT GamePatch {
       std::size_t patch_size
   );
 
+  /**
+   * Make an instance of a branch patch. The patch replaces the first bytes
+   * with a branch to a user-specified function, then replaces the rest of the
+   * bytes with no-op instructions.
+   *
+   * The patch size is the smallest size that covers whole instructions.
+   * Exits with an error if the instructions cannot be decoded or if the
+   * patched range contains the target of a nearby branch.
+   */
+  static GamePatch MakeGameBranchPatch(
+      const GameAddress& game_address,
+      BranchType branch_type,
+      void (*func_ptr)()
+  );
+
+  /**
+   * Make an instance of a branch patch. The patch replaces the first bytes
+   * with a branch to a user-specified function, then replaces the rest of the
+   * bytes with no-op instructions.
+   *
+   * The patch size is the smallest size that covers whole instructions.
+   * Exits with an error if the instructions cannot be decoded or if the
+   * patched range contains the target of a nearby branch.
+   */
+  static GamePatch MakeGameBranchPatch(
+      GameAddress&& game_address,
+      BranchType branch_type,
+      void (*func_ptr)()
+  );
+
   /**
    * Make an instance of a branch patch. The patch replaces the first bytes
    * with a branch to a user-specified function, then replaces the rest of the
@@ -172,10 +246,15 @@ class DLLEXPORT GamePatch {
       Iter first,
       Iter last
   ) {
-    static_assert (std::is_same<Iter::value_type, std::uint8_t>::value
-        || std::is_same<Iter::value_type, std::int8_t>::value);
+    static_assert (
+        std::is_same<typename Iter::value_type, std::uint8_t>::value
+            || std::is_same<typename Iter::value_type, std::int8_t>::value
+    );
 
-    return GamePatch(game_address, std::vector<std::uint8_t>(first, last));
+    GamePatch game_patch(game_address, std::distance(first, last));
+    std::copy(first, last, game_patch.patch_buffer());
+
+    return game_patch;
   }
 
   /**
@@ -188,13 +267,15 @@ class DLLEXPORT GamePatch {
       Iter first,
       Iter last
   ) {
-    static_assert (std::is_same<Iter::value_type, std::uint8_t>::value
-        || std::is_same<Iter::value_type, std::int8_t>::value);
-
-    return GamePatch(
-        std::move(game_address),
-        std::vector<std::uint8_t>(first, last)
+    static_assert (
+        std::is_same<typename Iter::value_type, std::uint8_t>::value
+            || std::is_same<typename Iter::value_type, std::int8_t>::value
     );
+
+    GamePatch game_patch(game_address, std::distance(first, last));
+    std::copy(first, last, game_patch.patch_buffer());
+
+    return game_patch;
   }
 
   /**
@@ -222,35 +303,43 @@ class DLLEXPORT GamePatch {
   void Swap(GamePatch& game_patch) noexcept;
 
  private:
-  GamePatch(
-      const GameAddress& game_address,
-      const std::vector<std::uint8_t>& patch_buffer
-  );
+  friend class GamePatchTransaction;
 
-  GamePatch(
-      GameAddress&& game_address,
-      const std::vector<std::uint8_t>& patch_buffer
-  );
+  static constexpr const std::size_t kInlineBufferCapacity = 32;
 
-  GamePatch(
-      const GameAddress& game_address,
-      std::vector<std::uint8_t>&& patch_buffer
-  );
+  /**
+   * Creates a patch of the specified size. The current values at the
+   * address are stored, and the patch buffer is left for the caller to
+   * fill.
+   */
+  GamePatch(const GameAddress& game_address, std::size_t patch_size);
 
-  GamePatch(
-      GameAddress&& game_address,
-      std::vector<std::uint8_t>&& patch_buffer
+  /**
+   * Returns the smallest patch size for the address that is at least
+   * min_size and ends on an instruction boundary.
+   */
+  static std::size_t GetInstructionBoundaryPatchSize(
+      const GameAddress& game_address,
+      std::size_t min_size
   );
 
   const GameAddress& game_address() const noexcept;
   bool is_patch_applied() const noexcept;
-  const std::vector<std::uint8_t>& patch_buffer() const noexcept;
-  const std::vector<std::uint8_t>& unpatched_buffer() const noexcept;
+  std::size_t patch_size() const noexcept;
+  const std::uint8_t* patch_buffer() const noexcept;
+  std::uint8_t* patch_buffer() noexcept;
+  const std::uint8_t* unpatched_buffer() const noexcept;
+  std::uint8_t* unpatched_buffer() noexcept;
 
   GameAddress game_address_;
   bool is_patch_applied_;
-  std::vector<std::uint8_t> patch_buffer_;
-  std::vector<std::uint8_t> unpatched_buffer_;
+  std::size_t patch_size_;
+
+  // Patches up to the inline capacity are stored without allocating.
+  // Larger patches store both buffers in a single allocation.
+  std::array<std::uint8_t, kInlineBufferCapacity> inline_patch_buffer_;
+  std::array<std::uint8_t, kInlineBufferCapacity> inline_unpatched_buffer_;
+  std::unique_ptr<std::uint8_t[]> large_buffers_;
 };
 
 } // namespace mapi
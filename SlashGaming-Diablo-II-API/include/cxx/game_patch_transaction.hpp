@@ -0,0 +1,193 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGMAPI_CXX_GAME_PATCH_TRANSACTION_HPP_
+#define SGMAPI_CXX_GAME_PATCH_TRANSACTION_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "game_patch.hpp"
+
+#include "../dllexport_define.inc"
+
+namespace mapi {
+
+/**
+ * The memory operations used to commit a game patch transaction. The
+ * default implementation operates on the memory of the current process.
+ * The memory also tracks the ranges of the patches that are applied to
+ * it, so that a later patch cannot overwrite them. GamePatch::Apply and
+ * GamePatch::Remove commit through the process memory as well, so a
+ * patch applied on its own is tracked like one applied by a transaction.
+ */
+class DLLEXPORT GamePatchMemory {
+ public:
+  GamePatchMemory();
+
+  GamePatchMemory(const GamePatchMemory& memory) = delete;
+
+  virtual ~GamePatchMemory();
+
+  GamePatchMemory& operator=(const GamePatchMemory& memory) = delete;
+
+  /**
+   * Makes a single page writable, storing its previous protection. Returns
+   * false if the protection could not be changed.
+   */
+  virtual bool MakePageWritable(
+      std::intptr_t page_address,
+      std::uint32_t* old_protection
+  ) = 0;
+
+  /**
+   * Restores the protection of a single page. Returns false if the
+   * protection could not be changed.
+   */
+  virtual bool RestorePageProtection(
+      std::intptr_t page_address,
+      std::uint32_t old_protection
+  ) = 0;
+
+  /**
+   * Writes bytes to memory that was made writable.
+   */
+  virtual void Write(
+      std::intptr_t address,
+      const std::uint8_t* buffer,
+      std::size_t size
+  ) = 0;
+
+  /**
+   * Flushes the instruction cache for the specified range of memory.
+   */
+  virtual void FlushInstructionCache(
+      std::intptr_t address,
+      std::size_t size
+  ) = 0;
+
+  /**
+   * Returns the size of a page, which must be a power of 2.
+   */
+  virtual std::size_t page_size() const = 0;
+
+  /**
+   * Returns the memory of the current process.
+   */
+  static GamePatchMemory& GetProcessMemory();
+
+ private:
+  friend class GamePatchTransaction;
+
+  // Serializes commits, and guards the applied ranges.
+  std::mutex commit_mutex_;
+
+  // Maps the start address of each applied patch to its size. Patches
+  // applied together may share a start address.
+  std::multimap<std::intptr_t, std::size_t> applied_ranges_;
+};
+
+/**
+ * A set of game patches that are applied or removed together. Writes are
+ * sorted by address and merged into runs, so that each touched page has
+ * its protection changed once, and each run has its instruction cache
+ * flushed once. If any page cannot be made writable, no bytes are
+ * written.
+ */
+class DLLEXPORT GamePatchTransaction {
+ public:
+  GamePatchTransaction();
+
+  explicit GamePatchTransaction(GamePatchMemory& memory);
+
+  GamePatchTransaction(const GamePatchTransaction& transaction) = delete;
+
+  GamePatchTransaction(GamePatchTransaction&& transaction) noexcept;
+
+  ~GamePatchTransaction();
+
+  GamePatchTransaction& operator=(
+      const GamePatchTransaction& transaction
+  ) = delete;
+
+  GamePatchTransaction& operator=(
+      GamePatchTransaction&& transaction
+  ) noexcept;
+
+  /**
+   * Adds a game patch to the transaction. The game patch must outlive the
+   * transaction.
+   */
+  void Add(GamePatch* game_patch);
+
+  /**
+   * Applies all of the patches that are not applied. Returns false without
+   * changing memory if two patches write different values to the same
+   * address, if a patch overlaps a patch that was applied earlier and has
+   * not been removed, or if a page could not be made writable.
+   */
+  bool Apply();
+
+  /**
+   * Removes all of the patches that are applied. Returns false without
+   * changing memory if two patches restore different values to the same
+   * address, or if a page could not be made writable.
+   */
+  bool Remove();
+
+ private:
+  GamePatchMemory* memory_;
+  std::vector<GamePatch*> game_patches_;
+
+  bool Commit(bool is_apply);
+};
+
+} // namespace mapi
+
+#include "../dllexport_undefine.inc"
+#endif // SGMAPI_CXX_GAME_PATCH_TRANSACTION_HPP_
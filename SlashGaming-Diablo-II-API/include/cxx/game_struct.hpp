@@ -56,6 +56,7 @@
 #include "game_struct/d2_mpq_archive.hpp"
 #include "game_struct/d2_mpq_archive_handle.hpp"
 #include "game_struct/d2_positional_rectangle.hpp"
+#include "game_struct/d2_struct_layout.hpp"
 #include "game_struct/d2_unicode_char.hpp"
 
 #endif // SGD2MAPI_CXX_GAME_STRUCT_HPP_
@@ -47,6 +47,7 @@
 #define SGD2MAPI_CXX_GAME_STRUCT_D2_CEL_CONTEXT_HPP_
 
 #include "d2_cel_context/d2_cel_context_api.hpp"
+#include "d2_cel_context/d2_cel_context_layout.hpp"
 #include "d2_cel_context/d2_cel_context_struct.hpp"
 #include "d2_cel_context/d2_cel_context_view.hpp"
 #include "d2_cel_context/d2_cel_context_wrapper.hpp"
@@ -94,22 +94,12 @@ class DLLEXPORT CelContext_Api {
       CelContext_Api&& other
   ) noexcept = default;
 
-  constexpr operator CelContext_View() const noexcept {
-    return ::std::visit(
-        [](const auto& actual_cel_context) {
-          return CelContext_View(&actual_cel_context);
-        },
-        this->cel_context_
-    );
+  operator CelContext_View() const noexcept {
+    return CelContext_View(this->Get());
   }
 
-  constexpr operator CelContext_Wrapper() noexcept {
-    return ::std::visit(
-        [](auto& actual_cel_context) {
-          return CelContext_Wrapper(&actual_cel_context);
-        },
-        this->cel_context_
-    );
+  operator CelContext_Wrapper() noexcept {
+    return CelContext_Wrapper(this->Get());
   }
 
   constexpr CelContext* Get() noexcept {
@@ -127,7 +117,7 @@ class DLLEXPORT CelContext_Api {
     );
   }
 
-  constexpr void AssignMembers(CelContext_View src) {
+  void AssignMembers(CelContext_View src) {
     CelContext_Wrapper dest_wrapper(*this);
 
     dest_wrapper.AssignMembers(src);
@@ -143,43 +133,43 @@ class DLLEXPORT CelContext_Api {
 
   Cel* GetCel();
 
-  constexpr CelFile_View GetCelFile() const noexcept {
+  CelFile_View GetCelFile() const noexcept {
     CelContext_View view(*this);
 
     return view.GetCelFile();
   }
 
-  constexpr CelFile_Wrapper GetCelFile() noexcept {
+  CelFile_Wrapper GetCelFile() noexcept {
     CelContext_Wrapper wrapper(*this);
 
     return wrapper.GetCelFile();
   }
 
-  constexpr void SetCelFile(CelFile_Wrapper cel_file) noexcept {
+  void SetCelFile(CelFile_Wrapper cel_file) noexcept {
     CelContext_Wrapper wrapper(*this);
 
     wrapper.SetCelFile(cel_file);
   }
 
-  constexpr unsigned int GetDirectionIndex() const noexcept {
+  unsigned int GetDirectionIndex() const noexcept {
     CelContext_View view(*this);
 
     return view.GetDirectionIndex();
   }
 
-  constexpr void SetDirectionIndex(unsigned int direction_index) noexcept {
+  void SetDirectionIndex(unsigned int direction_index) noexcept {
     CelContext_Wrapper wrapper(*this);
 
     wrapper.SetDirectionIndex(direction_index);
   }
 
-  constexpr unsigned int GetFrameIndex() const noexcept {
+  unsigned int GetFrameIndex() const noexcept {
     CelContext_View view(*this);
 
     return view.GetFrameIndex();
   }
 
-  constexpr void SetFrameIndex(unsigned int frame_index) noexcept {
+  void SetFrameIndex(unsigned int frame_index) noexcept {
     CelContext_Wrapper wrapper(*this);
 
     wrapper.SetFrameIndex(frame_index);
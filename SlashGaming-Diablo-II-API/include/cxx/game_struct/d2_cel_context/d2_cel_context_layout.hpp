@@ -0,0 +1,120 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_GAME_STRUCT_D2_CEL_CONTEXT_D2_CEL_CONTEXT_LAYOUT_HPP_
+#define SGD2MAPI_CXX_GAME_STRUCT_D2_CEL_CONTEXT_D2_CEL_CONTEXT_LAYOUT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../../game_version.hpp"
+#include "../d2_cel_file/d2_cel_file_struct.hpp"
+#include "../d2_struct_layout.hpp"
+#include "d2_cel_context_struct.hpp"
+
+#include "../../../dllexport_define.inc"
+
+namespace d2 {
+
+/**
+ * The size and field offsets of one version of CelContext.
+ */
+struct CelContextLayout {
+  std::size_t size;
+  mapi::StructField<CelFile*> cel_file;
+  mapi::StructField<std::uint32_t> direction_index;
+  mapi::StructField<std::uint32_t> frame_index;
+};
+
+inline constexpr CelContextLayout kCelContextLayout_1_00 = {
+    sizeof(CelContext_1_00),
+    { offsetof(CelContext_1_00, cel_file) },
+    { offsetof(CelContext_1_00, direction_index) },
+    { offsetof(CelContext_1_00, frame_index) }
+};
+
+inline constexpr CelContextLayout kCelContextLayout_1_12A = {
+    sizeof(CelContext_1_12A),
+    { offsetof(CelContext_1_12A, cel_file) },
+    { offsetof(CelContext_1_12A, direction_index) },
+    { offsetof(CelContext_1_12A, frame_index) }
+};
+
+inline constexpr CelContextLayout kCelContextLayout_1_13C = {
+    sizeof(CelContext_1_13C),
+    { offsetof(CelContext_1_13C, cel_file) },
+    { offsetof(CelContext_1_13C, direction_index) },
+    { offsetof(CelContext_1_13C, frame_index) }
+};
+
+inline constexpr mapi::VersionedStructLayout<CelContextLayout>
+kCelContextLayouts[] = {
+    {
+        GameVersion::kBeta1_02,
+        GameVersion::k1_10,
+        &kCelContextLayout_1_00
+    },
+    {
+        GameVersion::k1_12A,
+        GameVersion::k1_12A,
+        &kCelContextLayout_1_12A
+    },
+    {
+        GameVersion::k1_11,
+        GameVersion::kLod1_14D,
+        &kCelContextLayout_1_13C
+    }
+};
+
+/**
+ * Returns the CelContext layout of the running game version. The layout
+ * is selected on the first call.
+ */
+DLLEXPORT const CelContextLayout& GetRunningCelContextLayout();
+
+} // namespace d2
+
+#include "../../../dllexport_undefine.inc"
+#endif // SGD2MAPI_CXX_GAME_STRUCT_D2_CEL_CONTEXT_D2_CEL_CONTEXT_LAYOUT_HPP_
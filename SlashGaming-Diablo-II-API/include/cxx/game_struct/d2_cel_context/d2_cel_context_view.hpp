@@ -47,9 +47,9 @@
 #define SGD2MAPI_CXX_GAME_STRUCT_D2_CEL_CONTEXT_D2_CEL_CONTEXT_VIEW_HPP_
 
 #include <cstddef>
-#include <variant>
 
 #include "../d2_cel_file/d2_cel_file_view.hpp"
+#include "d2_cel_context_layout.hpp"
 #include "d2_cel_context_struct.hpp"
 
 #include "../../../dllexport_define.inc"
@@ -58,18 +58,16 @@ namespace d2 {
 
 class DLLEXPORT CelContext_View {
  public:
-  using ViewVariant = ::std::variant<
-      const CelContext_1_00*,
-      const CelContext_1_12A*,
-      const CelContext_1_13C*
-  >;
-
   CelContext_View() = delete;
 
   CelContext_View(const CelContext* cel_context) noexcept;
 
-  constexpr explicit CelContext_View(ViewVariant cel_context) noexcept
-      : cel_context_(::std::move(cel_context_)) {
+  constexpr CelContext_View(
+      const CelContext* cel_context,
+      const CelContextLayout& layout
+  ) noexcept
+      : cel_context_(cel_context),
+        layout_(&layout) {
   }
 
   constexpr CelContext_View(
@@ -90,61 +88,42 @@ class DLLEXPORT CelContext_View {
       CelContext_View&& other
   ) noexcept = default;
 
-  constexpr CelContext_View operator[](
+  CelContext_View operator[](
       std::size_t index
   ) const noexcept {
-    return std::visit(
-        [index](const auto& actual_cel_context) {
-          return CelContext_View(
-              &actual_cel_context[index]
-          );
-        },
-        this->cel_context_
+    return CelContext_View(
+        mapi::GetStructElement(
+            this->cel_context_,
+            this->layout_->size,
+            index
+        ),
+        *this->layout_
     );
   }
 
   constexpr const CelContext* Get() const noexcept {
-    return std::visit(
-        [](const auto& actual_cel_context) {
-          return reinterpret_cast<const CelContext*>(actual_cel_context);
-        },
-        this->cel_context_
-    );
-  };
-
-  constexpr CelFile_View GetCelFile() const noexcept {
-    return std::visit(
-        [](const auto& actual_cel_context) {
-          return CelFile_View(
-              actual_cel_context->cel_file
-          );
-        },
-        this->cel_context_
-    );
+    return this->cel_context_;
   }
 
-  constexpr unsigned int GetDirectionIndex() const noexcept {
-    return std::visit(
-        [](const auto& actual_cel_context) {
-          return actual_cel_context->direction_index;
-        },
-        this->cel_context_
-    );
+  constexpr const CelContextLayout& layout() const noexcept {
+    return *this->layout_;
   }
 
-  constexpr unsigned int GetFrameIndex() const noexcept {
-    return std::visit(
-        [](const auto& actual_cel_context) {
-          return actual_cel_context->frame_index;
-        },
-        this->cel_context_
-    );
+  CelFile_View GetCelFile() const noexcept {
+    return CelFile_View(this->layout_->cel_file.Read(this->cel_context_));
   }
 
- private:
-  ViewVariant cel_context_;
+  unsigned int GetDirectionIndex() const noexcept {
+    return this->layout_->direction_index.Read(this->cel_context_);
+  }
 
-  static ViewVariant CreateVariant(const CelContext* cel_context);
+  unsigned int GetFrameIndex() const noexcept {
+    return this->layout_->frame_index.Read(this->cel_context_);
+  }
+
+ private:
+  const CelContext* cel_context_;
+  const CelContextLayout* layout_;
 };
 
 } // namespace d2
@@ -47,12 +47,13 @@
 #define SGD2MAPI_CXX_GAME_STRUCT_D2_CEL_CONTEXT_D2_CEL_CONTEXT_WRAPPER_HPP_
 
 #include <cstddef>
-#include <type_traits>
+#include <cstring>
 
 #include "../../helper/d2_draw_options.hpp"
 #include "../d2_cel/d2_cel_struct.hpp"
 #include "../d2_cel_file/d2_cel_file_view.hpp"
 #include "../d2_cel_file/d2_cel_file_wrapper.hpp"
+#include "d2_cel_context_layout.hpp"
 #include "d2_cel_context_struct.hpp"
 #include "d2_cel_context_view.hpp"
 
@@ -62,20 +63,16 @@ namespace d2 {
 
 class DLLEXPORT CelContext_Wrapper {
  public:
-  using WrapperVariant = std::variant<
-      CelContext_1_00*,
-      CelContext_1_12A*,
-      CelContext_1_13C*
-  >;
-
   CelContext_Wrapper() = delete;
 
   CelContext_Wrapper(CelContext* cel_context) noexcept;
 
-  constexpr explicit CelContext_Wrapper(
-      WrapperVariant cel_context
+  constexpr CelContext_Wrapper(
+      CelContext* cel_context,
+      const CelContextLayout& layout
   ) noexcept
-      : cel_context_(::std::move(cel_context)) {
+      : cel_context_(cel_context),
+        layout_(&layout) {
   }
 
   constexpr CelContext_Wrapper(
@@ -96,7 +93,7 @@ class DLLEXPORT CelContext_Wrapper {
       CelContext_Wrapper&& other
   ) noexcept = default;
 
-  constexpr CelContext_View operator[](
+  CelContext_View operator[](
       std::size_t index
   ) const noexcept {
     CelContext_View view(*this);
@@ -104,59 +101,37 @@ class DLLEXPORT CelContext_Wrapper {
     return view[index];
   }
 
-  constexpr CelContext_Wrapper operator[](
+  CelContext_Wrapper operator[](
       std::size_t index
   ) noexcept {
-    return ::std::visit(
-        [index](auto& actual_cel_context) {
-          return CelContext_Wrapper(
-              &actual_cel_context[index]
-          );
-        },
-        this->cel_context_
+    return CelContext_Wrapper(
+        mapi::GetStructElement(
+            this->cel_context_,
+            this->layout_->size,
+            index
+        ),
+        *this->layout_
     );
   }
 
   constexpr operator CelContext_View() const noexcept {
-    return ::std::visit(
-        [](const auto& actual_cel_context) {
-          return CelContext_View(actual_cel_context);
-        },
-        this->cel_context_
-    );
+    return CelContext_View(this->cel_context_, *this->layout_);
   }
 
   constexpr CelContext* Get() noexcept {
-    const auto* const_this = this;
-
-    return const_cast<CelContext*>(const_this->Get());
+    return this->cel_context_;
   }
 
   constexpr const CelContext* Get() const noexcept {
-    return std::visit(
-        [](const auto& actual_cel_context) {
-          return reinterpret_cast<const CelContext*>(
-              actual_cel_context
-          );
-        },
-        this->cel_context_
-    );
+    return this->cel_context_;
   }
 
-  constexpr void AssignMembers(CelContext_View src) {
-    std::visit(
-        [&src](auto& actual_dest) {
-          using Dest_T = decltype(actual_dest);
-          using ActualSrc_T = const std::remove_pointer_t<
-              std::remove_reference_t<Dest_T>
-          >*;
-
-          const auto* actual_src = reinterpret_cast<ActualSrc_T>(src.Get());
+  constexpr const CelContextLayout& layout() const noexcept {
+    return *this->layout_;
+  }
 
-          *actual_dest = *actual_src;
-        },
-        this->cel_context_
-    );
+  void AssignMembers(CelContext_View src) {
+    std::memcpy(this->cel_context_, src.Get(), this->layout_->size);
   }
 
   bool DrawFrame(int position_x, int position_y);
@@ -169,72 +144,46 @@ class DLLEXPORT CelContext_Wrapper {
 
   Cel* GetCel();
 
-  constexpr CelFile_Wrapper GetCelFile() noexcept {
-    return ::std::visit(
-        [](auto& actual_cel_context) {
-          return CelFile_Wrapper(actual_cel_context->cel_file);
-        },
-        this->cel_context_
-    );
+  CelFile_Wrapper GetCelFile() noexcept {
+    return CelFile_Wrapper(this->layout_->cel_file.Read(this->cel_context_));
   }
 
-  constexpr CelFile_View GetCelFile() const noexcept {
+  CelFile_View GetCelFile() const noexcept {
     CelContext_View view(*this);
 
     return view.GetCelFile();
   }
 
-  constexpr void SetCelFile(CelFile_Wrapper cel_file) noexcept {
-    std::visit(
-        [&cel_file](auto& actual_cel_context) {
-          using CelContext_T = std::remove_pointer_t<
-              std::remove_reference_t<decltype(actual_cel_context)>
-          >;
-          using CelFile_T = std::remove_pointer_t<
-              decltype(CelContext_T::cel_file)
-          >;
-
-          actual_cel_context->cel_file =
-              reinterpret_cast<CelFile_T*>(cel_file.Get());
-        },
-        this->cel_context_
-    );
+  void SetCelFile(CelFile_Wrapper cel_file) noexcept {
+    this->layout_->cel_file.Write(this->cel_context_, cel_file.Get());
   }
 
-  constexpr unsigned int GetDirectionIndex() const noexcept {
+  unsigned int GetDirectionIndex() const noexcept {
     CelContext_View view(*this);
 
     return view.GetDirectionIndex();
   }
 
-  constexpr void SetDirectionIndex(unsigned int direction_index) noexcept {
-    std::visit(
-        [direction_index](auto& actual_cel_context) {
-          actual_cel_context->direction_index = direction_index;
-        },
-        this->cel_context_
+  void SetDirectionIndex(unsigned int direction_index) noexcept {
+    this->layout_->direction_index.Write(
+        this->cel_context_,
+        direction_index
     );
   }
 
-  constexpr unsigned int GetFrameIndex() const noexcept {
+  unsigned int GetFrameIndex() const noexcept {
     CelContext_View view(*this);
 
     return view.GetFrameIndex();
   }
 
-  constexpr void SetFrameIndex(unsigned int frame_index) noexcept {
-    std::visit(
-        [frame_index](auto& actual_cel_context) {
-          actual_cel_context->direction_index = frame_index;
-        },
-        this->cel_context_
-    );
+  void SetFrameIndex(unsigned int frame_index) noexcept {
+    this->layout_->frame_index.Write(this->cel_context_, frame_index);
   }
 
  private:
-  WrapperVariant cel_context_;
-
-  static WrapperVariant CreateVariant(CelContext* cel_context);
+  CelContext* cel_context_;
+  const CelContextLayout* layout_;
 };
 
 } // namespace d2
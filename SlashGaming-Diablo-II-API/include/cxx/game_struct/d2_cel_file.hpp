@@ -47,6 +47,7 @@
 #define SGD2MAPI_CXX_GAME_STRUCT_D2_CEL_FILE_HPP_
 
 #include "d2_cel_file/d2_cel_file_api.hpp"
+#include "d2_cel_file/d2_cel_file_metadata.hpp"
 #include "d2_cel_file/d2_cel_file_struct.hpp"
 #include "d2_cel_file/d2_cel_file_view.hpp"
 #include "d2_cel_file/d2_cel_file_wrapper.hpp"
@@ -50,6 +50,7 @@
 
 #include "../../helper/d2_draw_options.hpp"
 #include "../d2_cel/d2_cel_struct.hpp"
+#include "d2_cel_file_metadata.hpp"
 #include "d2_cel_file_struct.hpp"
 #include "d2_cel_file_view.hpp"
 #include "d2_cel_file_wrapper.hpp"
@@ -115,6 +116,12 @@ class DLLEXPORT CelFile_Api {
 
   Cel_View GetCel(unsigned int direction, unsigned int frame);
 
+  /**
+   * Returns the metadata of every frame, which is read when the cel file
+   * is opened.
+   */
+  const CelFileMetadata& GetMetadata() const noexcept;
+
   bool IsOpen() const;
 
   void Open(
@@ -143,6 +150,7 @@ class DLLEXPORT CelFile_Api {
  private:
   ApiVariant cel_file_;
   bool is_open_;
+  CelFileMetadata metadata_;
 
   static ApiVariant CreateVariant(
       const char* cel_file_path,
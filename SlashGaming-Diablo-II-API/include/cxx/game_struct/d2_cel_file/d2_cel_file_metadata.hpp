@@ -0,0 +1,153 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_GAME_STRUCT_D2_CEL_FILE_D2_CEL_FILE_METADATA_HPP_
+#define SGD2MAPI_CXX_GAME_STRUCT_D2_CEL_FILE_D2_CEL_FILE_METADATA_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "../d2_cel/d2_cel_struct.hpp"
+#include "d2_cel_file_wrapper.hpp"
+
+#include "../../../dllexport_define.inc"
+
+namespace d2 {
+
+/**
+ * The width, height, and offsets of every frame in every direction of a
+ * cel file, read once. Each value is stored in its own array, and the
+ * widths of consecutive frames are also stored as running totals, so
+ * that the width of a row of frames is found without visiting each
+ * frame.
+ */
+class DLLEXPORT CelFileMetadata {
+ public:
+  CelFileMetadata() noexcept;
+
+  /**
+   * Reads the cel of every frame in every direction of the cel file.
+   */
+  explicit CelFileMetadata(CelFile_Wrapper cel_file);
+
+  /**
+   * Copies the metadata of the cels, which are listed direction by
+   * direction, with num_frames cels per direction.
+   */
+  CelFileMetadata(
+      unsigned int num_directions,
+      unsigned int num_frames,
+      const Cel* const* cels
+  );
+
+  CelFileMetadata(const CelFileMetadata& other);
+
+  CelFileMetadata(CelFileMetadata&& other) noexcept;
+
+  ~CelFileMetadata();
+
+  CelFileMetadata& operator=(const CelFileMetadata& other);
+
+  CelFileMetadata& operator=(CelFileMetadata&& other) noexcept;
+
+  int GetWidth(unsigned int direction, unsigned int frame) const noexcept;
+
+  int GetHeight(unsigned int direction, unsigned int frame) const noexcept;
+
+  int GetOffsetX(unsigned int direction, unsigned int frame) const noexcept;
+
+  int GetOffsetY(unsigned int direction, unsigned int frame) const noexcept;
+
+  /**
+   * Returns the total width of frame_count consecutive frames of the
+   * direction, starting from first_frame.
+   */
+  int GetFramesWidth(
+      unsigned int direction,
+      unsigned int first_frame,
+      unsigned int frame_count
+  ) const noexcept;
+
+  /**
+   * Returns whether every frame of the grid, read from left to right and
+   * top to bottom, is in the direction.
+   */
+  bool HasFrameGrid(
+      unsigned int direction,
+      unsigned int columns,
+      unsigned int rows
+  ) const noexcept;
+
+  void Clear() noexcept;
+
+  bool empty() const noexcept;
+
+  unsigned int num_directions() const noexcept;
+
+  unsigned int num_frames() const noexcept;
+
+ private:
+  unsigned int num_directions_;
+  unsigned int num_frames_;
+
+  std::vector<int> widths_;
+  std::vector<int> heights_;
+  std::vector<int> offsets_x_;
+  std::vector<int> offsets_y_;
+
+  // Each direction has num_frames_ + 1 entries. The entry for a frame is
+  // the total width of the frames before it.
+  std::vector<int> width_prefix_sums_;
+
+  std::size_t GetIndex(
+      unsigned int direction,
+      unsigned int frame
+  ) const noexcept;
+};
+
+} // namespace d2
+
+#include "../../../dllexport_undefine.inc"
+#endif // SGD2MAPI_CXX_GAME_STRUCT_D2_CEL_FILE_D2_CEL_FILE_METADATA_HPP_
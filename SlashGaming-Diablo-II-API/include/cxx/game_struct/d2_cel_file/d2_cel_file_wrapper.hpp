@@ -58,6 +58,8 @@
 
 namespace d2 {
 
+class CelFileMetadata;
+
 class DLLEXPORT CelFile_Wrapper {
  public:
   using WrapperVariant = std::variant<CelFile_1_00*>;
@@ -157,6 +159,10 @@ class DLLEXPORT CelFile_Wrapper {
       unsigned int rows
   );
 
+  /**
+   * Draws the frames as a grid, reading the cel of each frame in the
+   * grid as it is needed. Nothing is allocated or cached.
+   */
   bool DrawAllFrames(
       int position_x,
       int position_y,
@@ -165,6 +171,19 @@ class DLLEXPORT CelFile_Wrapper {
       const DrawAllCelFileFramesOptions& all_frames_options
   );
 
+  /**
+   * Draws the frames as a grid, using the metadata of the cel file to lay
+   * out the grid instead of reading each frame's cel.
+   */
+  bool DrawAllFrames(
+      int position_x,
+      int position_y,
+      unsigned int columns,
+      unsigned int rows,
+      const DrawAllCelFileFramesOptions& all_frames_options,
+      const CelFileMetadata& metadata
+  );
+
   Cel_Wrapper GetCel(unsigned int direction, unsigned int frame);
 
   constexpr unsigned int GetVersion() const noexcept {
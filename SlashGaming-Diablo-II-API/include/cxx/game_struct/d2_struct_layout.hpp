@@ -0,0 +1,142 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_GAME_STRUCT_D2_STRUCT_LAYOUT_HPP_
+#define SGD2MAPI_CXX_GAME_STRUCT_D2_STRUCT_LAYOUT_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "../game_version.hpp"
+
+namespace mapi {
+
+/**
+ * The offset of a field of type T within one version of a game struct.
+ * Reads and writes copy the bytes at the offset, so the same field works
+ * on the game's memory and on a plain byte buffer.
+ */
+template <typename T>
+struct StructField {
+  static_assert(std::is_trivially_copyable_v<T>);
+
+  std::size_t offset;
+
+  T Read(const void* base) const noexcept {
+    T value;
+    std::memcpy(
+        &value,
+        static_cast<const std::byte*>(base) + this->offset,
+        sizeof(value)
+    );
+
+    return value;
+  }
+
+  void Write(void* base, T value) const noexcept {
+    std::memcpy(
+        static_cast<std::byte*>(base) + this->offset,
+        &value,
+        sizeof(value)
+    );
+  }
+};
+
+/**
+ * A layout of a game struct, and the inclusive range of game versions
+ * that it is used for.
+ */
+template <typename Layout>
+struct VersionedStructLayout {
+  ::d2::GameVersion first_version;
+  ::d2::GameVersion last_version;
+  const Layout* layout;
+};
+
+/**
+ * Returns the first layout whose range holds the game version, or nullptr
+ * if there is none. The layouts read like the if-else chain on the game
+ * version that they replace.
+ */
+template <typename Layout, std::size_t kLayoutCount>
+constexpr const Layout* FindStructLayout(
+    const VersionedStructLayout<Layout> (&layouts)[kLayoutCount],
+    ::d2::GameVersion game_version
+) noexcept {
+  for (const VersionedStructLayout<Layout>& entry : layouts) {
+    if (game_version >= entry.first_version
+        && game_version <= entry.last_version) {
+      return entry.layout;
+    }
+  }
+
+  return nullptr;
+}
+
+/**
+ * Returns the address of the element at the index of an array of game
+ * structs, where each element is element_size bytes.
+ */
+template <typename T>
+inline T* GetStructElement(
+    T* base,
+    std::size_t element_size,
+    std::size_t index
+) noexcept {
+  using Byte_T = std::conditional_t<
+      std::is_const_v<T>,
+      const std::byte,
+      std::byte
+  >;
+
+  return reinterpret_cast<T*>(
+      reinterpret_cast<Byte_T*>(base) + (index * element_size)
+  );
+}
+
+} // namespace mapi
+
+#endif // SGD2MAPI_CXX_GAME_STRUCT_D2_STRUCT_LAYOUT_HPP_
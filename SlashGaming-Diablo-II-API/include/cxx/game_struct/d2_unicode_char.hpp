@@ -46,11 +46,15 @@
 #ifndef SGD2MAPI_CXX_GAME_STRUCT_D2_UNICODE_CHAR_HPP_
 #define SGD2MAPI_CXX_GAME_STRUCT_D2_UNICODE_CHAR_HPP_
 
+#include "d2_unicode_char/d2_inline_unicode_string.hpp"
 #include "d2_unicode_char/d2_unicode_char_api.hpp"
 #include "d2_unicode_char/d2_unicode_char_struct.hpp"
 #include "d2_unicode_char/d2_unicode_char_view.hpp"
 #include "d2_unicode_char/d2_unicode_char_wrapper.hpp"
+#include "d2_unicode_char/d2_unicode_literal.hpp"
+#include "d2_unicode_char/d2_unicode_rope.hpp"
 #include "d2_unicode_char/d2_unicode_string_api.hpp"
+#include "d2_unicode_char/d2_unicode_string_arena.hpp"
 #include "d2_unicode_char/d2_unicode_string_view_api.hpp"
 
 #include "../../dllexport_undefine.inc"
@@ -0,0 +1,319 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_GAME_STRUCT_D2_UNICODE_CHAR_D2_INLINE_UNICODE_STRING_HPP_
+#define SGD2MAPI_CXX_GAME_STRUCT_D2_UNICODE_CHAR_D2_INLINE_UNICODE_STRING_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "d2_unicode_char_struct.hpp"
+#include "d2_unicode_string_view_api.hpp"
+
+namespace d2 {
+
+/**
+ * A Unicode string that stores up to Capacity characters inside of the
+ * object. Longer strings spill over to the heap. Intended for short UI
+ * labels that would otherwise allocate on every construction.
+ */
+template <std::size_t Capacity>
+class InlineUnicodeString {
+ public:
+  using value_type = UnicodeChar;
+  using size_type = int;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+
+  static_assert(Capacity > 0);
+
+  static constexpr const size_type kInlineCapacity = Capacity;
+
+  InlineUnicodeString() noexcept
+      : length_(0),
+        capacity_(kInlineCapacity) {
+    this->inline_buffer_[0] = UnicodeChar_1_00();
+  }
+
+  InlineUnicodeString(UnicodeStringView_Api view)
+      : InlineUnicodeString() {
+    this->append(view);
+  }
+
+  InlineUnicodeString(const value_type* s)
+      : InlineUnicodeString(UnicodeStringView_Api(s)) {
+  }
+
+  InlineUnicodeString(const value_type* s, size_type count)
+      : InlineUnicodeString(UnicodeStringView_Api(s, count)) {
+  }
+
+  InlineUnicodeString(const InlineUnicodeString& str)
+      : InlineUnicodeString(static_cast<UnicodeStringView_Api>(str)) {
+  }
+
+  InlineUnicodeString(InlineUnicodeString&& str) noexcept
+      : InlineUnicodeString() {
+    this->MoveFrom(str);
+  }
+
+  ~InlineUnicodeString() = default;
+
+  InlineUnicodeString& operator=(const InlineUnicodeString& str) {
+    if (this != &str) {
+      this->clear();
+      this->append(str);
+    }
+
+    return *this;
+  }
+
+  InlineUnicodeString& operator=(InlineUnicodeString&& str) noexcept {
+    if (this != &str) {
+      this->heap_buffer_.reset();
+      this->capacity_ = kInlineCapacity;
+      this->MoveFrom(str);
+    }
+
+    return *this;
+  }
+
+  InlineUnicodeString& operator=(UnicodeStringView_Api view) {
+    size_type count = view.length();
+
+    // The view may point into this string, so the old buffer is kept
+    // alive until the characters have been copied.
+    std::unique_ptr<UnicodeChar_1_00[]> old_heap_buffer;
+    if (count > this->capacity_) {
+      old_heap_buffer = this->Grow(count);
+    }
+
+    const UnicodeChar_1_00* actual_src =
+        reinterpret_cast<const UnicodeChar_1_00*>(view.data());
+    UnicodeChar_1_00* actual_dest = this->actual_data();
+
+    // A view into this string starts at or after the destination, so a
+    // forward copy never overwrites a character before it is read.
+    if (actual_src != actual_dest) {
+      std::copy_n(actual_src, count, actual_dest);
+    }
+
+    actual_dest[count] = UnicodeChar_1_00();
+
+    this->length_ = count;
+
+    return *this;
+  }
+
+  InlineUnicodeString& operator+=(UnicodeStringView_Api view) {
+    return this->append(view);
+  }
+
+  InlineUnicodeString& operator+=(const value_type& ch) {
+    this->push_back(ch);
+    return *this;
+  }
+
+  operator UnicodeStringView_Api() const noexcept {
+    return UnicodeStringView_Api(this->data(), this->length_);
+  }
+
+  /**
+   * Element access
+   */
+
+  reference operator[](size_type pos) noexcept {
+    return this->data()[pos];
+  }
+
+  const_reference operator[](size_type pos) const noexcept {
+    return this->data()[pos];
+  }
+
+  pointer data() noexcept {
+    return reinterpret_cast<pointer>(this->actual_data());
+  }
+
+  const_pointer data() const noexcept {
+    return reinterpret_cast<const_pointer>(this->actual_data());
+  }
+
+  const_pointer c_str() const noexcept {
+    return this->data();
+  }
+
+  /**
+   * Capacity
+   */
+
+  [[nodiscard]] bool empty() const noexcept {
+    return this->length_ == 0;
+  }
+
+  size_type size() const noexcept {
+    return this->length_;
+  }
+
+  size_type length() const noexcept {
+    return this->length_;
+  }
+
+  size_type capacity() const noexcept {
+    return this->capacity_;
+  }
+
+  /**
+   * Returns whether the characters are stored inside of the object.
+   */
+  bool is_inline() const noexcept {
+    return this->heap_buffer_ == nullptr;
+  }
+
+  void reserve(size_type new_cap) {
+    if (new_cap <= this->capacity_) {
+      return;
+    }
+
+    this->Grow(new_cap);
+  }
+
+  /**
+   * Operations
+   */
+
+  void clear() noexcept {
+    this->length_ = 0;
+    this->actual_data()[0] = UnicodeChar_1_00();
+  }
+
+  void push_back(const value_type& ch) {
+    this->append(UnicodeStringView_Api(&ch, 1));
+  }
+
+  InlineUnicodeString& append(UnicodeStringView_Api view) {
+    size_type count = view.length();
+    size_type new_length = this->length_ + count;
+
+    // The view may point into this string, so the old buffer is kept
+    // alive until the characters have been copied.
+    std::unique_ptr<UnicodeChar_1_00[]> old_heap_buffer;
+    if (new_length > this->capacity_) {
+      old_heap_buffer = this->Grow(std::max(new_length, this->capacity_ * 2));
+    }
+
+    const UnicodeChar_1_00* actual_src =
+        reinterpret_cast<const UnicodeChar_1_00*>(view.data());
+    UnicodeChar_1_00* actual_dest = this->actual_data();
+
+    std::copy_n(actual_src, count, &actual_dest[this->length_]);
+    actual_dest[new_length] = UnicodeChar_1_00();
+
+    this->length_ = new_length;
+
+    return *this;
+  }
+
+  InlineUnicodeString& append(const value_type* s, size_type count) {
+    return this->append(UnicodeStringView_Api(s, count));
+  }
+
+ private:
+  std::array<UnicodeChar_1_00, Capacity + 1> inline_buffer_;
+  std::unique_ptr<UnicodeChar_1_00[]> heap_buffer_;
+  size_type length_;
+  size_type capacity_;
+
+  UnicodeChar_1_00* actual_data() noexcept {
+    return (this->heap_buffer_ == nullptr)
+        ? this->inline_buffer_.data()
+        : this->heap_buffer_.get();
+  }
+
+  const UnicodeChar_1_00* actual_data() const noexcept {
+    return (this->heap_buffer_ == nullptr)
+        ? this->inline_buffer_.data()
+        : this->heap_buffer_.get();
+  }
+
+  std::unique_ptr<UnicodeChar_1_00[]> Grow(size_type new_cap) {
+    std::unique_ptr<UnicodeChar_1_00[]> new_buffer(
+        new UnicodeChar_1_00[new_cap + 1]
+    );
+
+    std::copy_n(this->actual_data(), this->length_ + 1, new_buffer.get());
+
+    this->capacity_ = new_cap;
+    this->heap_buffer_.swap(new_buffer);
+
+    return new_buffer;
+  }
+
+  void MoveFrom(InlineUnicodeString& str) noexcept {
+    if (str.heap_buffer_ != nullptr) {
+      this->heap_buffer_ = std::move(str.heap_buffer_);
+      this->capacity_ = str.capacity_;
+    } else {
+      std::copy_n(
+          str.inline_buffer_.data(),
+          str.length_ + 1,
+          this->inline_buffer_.data()
+      );
+    }
+
+    this->length_ = str.length_;
+
+    str.capacity_ = kInlineCapacity;
+    str.clear();
+  }
+};
+
+} // namespace d2
+
+#endif // SGD2MAPI_CXX_GAME_STRUCT_D2_UNICODE_CHAR_D2_INLINE_UNICODE_STRING_HPP_
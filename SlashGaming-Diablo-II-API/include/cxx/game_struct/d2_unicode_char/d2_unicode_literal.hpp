@@ -0,0 +1,249 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_GAME_STRUCT_D2_UNICODE_CHAR_D2_UNICODE_LITERAL_HPP_
+#define SGD2MAPI_CXX_GAME_STRUCT_D2_UNICODE_CHAR_D2_UNICODE_LITERAL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "d2_unicode_char_struct.hpp"
+#include "d2_unicode_string_view_api.hpp"
+
+namespace d2 {
+
+/**
+ * A null-terminated UnicodeChar array that is built at compile time. It
+ * converts to UnicodeStringView_Api without copying or allocating.
+ */
+template <std::size_t Length>
+struct UnicodeLiteral {
+  UnicodeChar_1_00 chars[Length + 1];
+
+  const UnicodeChar* data() const noexcept {
+    return reinterpret_cast<const UnicodeChar*>(this->chars);
+  }
+
+  const UnicodeChar* c_str() const noexcept {
+    return this->data();
+  }
+
+  static constexpr std::size_t length() noexcept {
+    return Length;
+  }
+
+  static constexpr std::size_t size() noexcept {
+    return Length;
+  }
+
+  operator UnicodeStringView_Api() const noexcept {
+    return UnicodeStringView_Api(this->data(), Length);
+  }
+};
+
+namespace unicode_literal {
+
+/**
+ * Holds the characters of a UTF-8 string literal so that the literal can
+ * be used as a template argument.
+ */
+template <std::size_t Size>
+struct Utf8StringLiteral {
+  char8_t chars[Size];
+
+  consteval Utf8StringLiteral(const char8_t (&str)[Size]) : chars() {
+    for (std::size_t i = 0; i < Size; i += 1) {
+      this->chars[i] = str[i];
+    }
+  }
+
+  /**
+   * Returns the number of code units before the null terminator.
+   */
+  static consteval std::size_t length() noexcept {
+    return Size - 1;
+  }
+};
+
+/**
+ * Calling this function in a constant expression makes the expression
+ * ill-formed, which surfaces invalid UTF-8 as a compile error.
+ */
+inline void InvalidUtf8InUnicodeLiteral() {
+}
+
+struct DecodedCodePoint {
+  char32_t code_point;
+  std::size_t size;
+};
+
+/**
+ * Decodes the code point at the start of the string. Overlong forms,
+ * surrogates and values beyond U+10FFFF are rejected.
+ */
+consteval DecodedCodePoint DecodeUtf8CodePoint(
+    const char8_t* str,
+    std::size_t length
+) {
+  char8_t lead = str[0];
+
+  std::size_t size;
+  char32_t code_point;
+  char32_t min_code_point;
+
+  if (lead < 0x80) {
+    return DecodedCodePoint{ lead, 1 };
+  } else if ((lead & 0xE0) == 0xC0) {
+    size = 2;
+    code_point = lead & 0x1F;
+    min_code_point = 0x80;
+  } else if ((lead & 0xF0) == 0xE0) {
+    size = 3;
+    code_point = lead & 0x0F;
+    min_code_point = 0x800;
+  } else if ((lead & 0xF8) == 0xF0) {
+    size = 4;
+    code_point = lead & 0x07;
+    min_code_point = 0x10000;
+  } else {
+    InvalidUtf8InUnicodeLiteral();
+    return DecodedCodePoint{ 0, 1 };
+  }
+
+  if (size > length) {
+    InvalidUtf8InUnicodeLiteral();
+  }
+
+  for (std::size_t i = 1; i < size; i += 1) {
+    if ((str[i] & 0xC0) != 0x80) {
+      InvalidUtf8InUnicodeLiteral();
+    }
+
+    code_point = (code_point << 6) | (str[i] & 0x3F);
+  }
+
+  if (code_point < min_code_point
+      || code_point > 0x10FFFF
+      || (code_point >= 0xD800 && code_point <= 0xDFFF)) {
+    InvalidUtf8InUnicodeLiteral();
+  }
+
+  return DecodedCodePoint{ code_point, size };
+}
+
+/**
+ * Returns the number of UTF-16 code units needed for the literal.
+ */
+template <Utf8StringLiteral Str>
+consteval std::size_t GetUtf16Length() {
+  std::size_t utf16_length = 0;
+
+  for (std::size_t i = 0; i < Str.length(); ) {
+    DecodedCodePoint decoded =
+        DecodeUtf8CodePoint(&Str.chars[i], Str.length() - i);
+
+    utf16_length += (decoded.code_point >= 0x10000) ? 2 : 1;
+    i += decoded.size;
+  }
+
+  return utf16_length;
+}
+
+template <Utf8StringLiteral Str>
+consteval UnicodeLiteral<GetUtf16Length<Str>()> MakeUnicodeLiteral() {
+  UnicodeLiteral<GetUtf16Length<Str>()> literal = {};
+
+  std::size_t dest_index = 0;
+  for (std::size_t i = 0; i < Str.length(); ) {
+    DecodedCodePoint decoded =
+        DecodeUtf8CodePoint(&Str.chars[i], Str.length() - i);
+
+    if (decoded.code_point >= 0x10000) {
+      char32_t offset = decoded.code_point - 0x10000;
+
+      literal.chars[dest_index].ch =
+          static_cast<std::uint16_t>(0xD800 | (offset >> 10));
+      literal.chars[dest_index + 1].ch =
+          static_cast<std::uint16_t>(0xDC00 | (offset & 0x3FF));
+      dest_index += 2;
+    } else {
+      literal.chars[dest_index].ch =
+          static_cast<std::uint16_t>(decoded.code_point);
+      dest_index += 1;
+    }
+
+    i += decoded.size;
+  }
+
+  literal.chars[dest_index].ch = 0;
+
+  return literal;
+}
+
+/**
+ * One instance exists per distinct literal, so every use of the same
+ * literal refers to the same static array.
+ */
+template <Utf8StringLiteral Str>
+inline constexpr auto kUnicodeLiteral = MakeUnicodeLiteral<Str>();
+
+} // namespace unicode_literal
+
+namespace literals {
+
+/**
+ * Converts a UTF-8 string literal into a static UnicodeChar array at
+ * compile time, for example u8"Gold"_d2.
+ */
+template <unicode_literal::Utf8StringLiteral Str>
+consteval const auto& operator""_d2() {
+  return unicode_literal::kUnicodeLiteral<Str>;
+}
+
+} // namespace literals
+
+} // namespace d2
+
+#endif // SGD2MAPI_CXX_GAME_STRUCT_D2_UNICODE_CHAR_D2_UNICODE_LITERAL_HPP_
@@ -0,0 +1,160 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_GAME_STRUCT_D2_UNICODE_CHAR_D2_UNICODE_ROPE_HPP_
+#define SGD2MAPI_CXX_GAME_STRUCT_D2_UNICODE_CHAR_D2_UNICODE_ROPE_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "../../helper/d2_draw_options.hpp"
+#include "d2_unicode_char_struct.hpp"
+#include "d2_unicode_string_view_api.hpp"
+
+#include "../../../dllexport_define.inc"
+
+namespace d2 {
+
+struct UnicodeRopeNode;
+
+/**
+ * A Unicode string stored as a balanced tree of short segments. Insert
+ * and erase at any position take O(log n) time instead of copying the
+ * whole string. Flatten produces a contiguous copy for drawing.
+ *
+ * Each segment is a separate allocation, so for strings of a few
+ * thousand code units, UnicodeString_Api is faster at every operation.
+ * The rope only pays off for long text that is edited at the front,
+ * such as a message log that is trimmed as it grows.
+ */
+class DLLEXPORT UnicodeRope {
+ public:
+  using value_type = UnicodeChar;
+  using size_type = int;
+  using const_reference = const value_type&;
+
+  static constexpr size_type npos = size_type(-1);
+
+  UnicodeRope();
+  explicit UnicodeRope(UnicodeStringView_Api view);
+  UnicodeRope(const UnicodeRope& rope);
+  UnicodeRope(UnicodeRope&& rope) noexcept;
+
+  ~UnicodeRope();
+
+  UnicodeRope& operator=(const UnicodeRope& rope);
+  UnicodeRope& operator=(UnicodeRope&& rope) noexcept;
+
+  UnicodeRope& operator+=(UnicodeStringView_Api view);
+
+  /**
+   * Element access
+   */
+
+  const_reference operator[](size_type pos) const;
+  const_reference at(size_type pos) const;
+
+  /**
+   * Capacity
+   */
+
+  [[nodiscard]] bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type length() const noexcept;
+
+  /**
+   * Operations
+   */
+
+  void clear() noexcept;
+
+  UnicodeRope& insert(size_type index, UnicodeStringView_Api view);
+
+  UnicodeRope& erase(size_type index = 0, size_type count = npos);
+
+  UnicodeRope& append(UnicodeStringView_Api view);
+
+  UnicodeRope& prepend(UnicodeStringView_Api view);
+
+  size_type copy(
+      value_type* dest,
+      size_type count,
+      size_type pos = 0
+  ) const;
+
+  /**
+   * Returns a contiguous, null-terminated copy of the rope. The view
+   * remains valid until the rope is next modified.
+   */
+  UnicodeStringView_Api Flatten() const;
+
+  /**
+   * Extended Diablo II functions
+   */
+
+  void Draw(int position_x, int position_y) const;
+  void Draw(
+      int position_x,
+      int position_y,
+      const DrawTextOptions& options
+  ) const;
+
+ private:
+  std::unique_ptr<UnicodeRopeNode> root_;
+  std::uint32_t priority_state_;
+
+  mutable std::vector<UnicodeChar_1_00> flat_buffer_;
+  mutable bool is_flat_buffer_valid_;
+
+  std::uint32_t NextPriority() noexcept;
+
+  std::unique_ptr<UnicodeRopeNode> MakeNodes(UnicodeStringView_Api view);
+};
+
+} // namespace d2
+
+#include "../../../dllexport_undefine.inc"
+#endif // SGD2MAPI_CXX_GAME_STRUCT_D2_UNICODE_CHAR_D2_UNICODE_ROPE_HPP_
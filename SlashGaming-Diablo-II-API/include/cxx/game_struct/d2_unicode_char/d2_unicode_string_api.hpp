@@ -100,33 +100,76 @@ class DLLEXPORT UnicodeString_Api {
    * Element access
    */
 
-  reference operator[](size_type pos);
-  const_reference operator[](size_type pos) const;
+  reference operator[](size_type pos) {
+    return reinterpret_cast<reference>(this->actual_str()[pos]);
+  }
 
-  reference at(size_type pos);
-  const_reference at(size_type pos) const;
+  const_reference operator[](size_type pos) const {
+    return reinterpret_cast<const_reference>(this->actual_str()[pos]);
+  }
 
-  value_type& front();
-  const value_type& front() const;
+  reference at(size_type pos) {
+    return reinterpret_cast<reference>(this->actual_str().at(pos));
+  }
 
-  value_type& back();
-  const value_type& back() const;
+  const_reference at(size_type pos) const {
+    return reinterpret_cast<const_reference>(this->actual_str().at(pos));
+  }
 
-  value_type* data() noexcept;
-  const value_type* data() const noexcept;
+  value_type& front() {
+    return reinterpret_cast<reference>(this->actual_str().front());
+  }
 
-  const value_type* c_str() const noexcept;
+  const value_type& front() const {
+    return reinterpret_cast<const_reference>(this->actual_str().front());
+  }
+
+  value_type& back() {
+    return reinterpret_cast<reference>(this->actual_str().back());
+  }
+
+  const value_type& back() const {
+    return reinterpret_cast<const_reference>(this->actual_str().back());
+  }
+
+  value_type* data() noexcept {
+    return reinterpret_cast<pointer>(this->actual_str().data());
+  }
+
+  const value_type* data() const noexcept {
+    return reinterpret_cast<const_pointer>(this->actual_str().data());
+  }
+
+  const value_type* c_str() const noexcept {
+    return reinterpret_cast<const_pointer>(this->actual_str().c_str());
+  }
 
   /**
    * Capacity
    */
 
-  [[nodiscard]] bool empty() const noexcept;
-  size_type size() const noexcept;
-  size_type length() const noexcept;
-  size_type max_size() const noexcept;
+  [[nodiscard]] bool empty() const noexcept {
+    return this->actual_str().empty();
+  }
+
+  size_type size() const noexcept {
+    return this->actual_str().size();
+  }
+
+  size_type length() const noexcept {
+    return this->actual_str().length();
+  }
+
+  size_type max_size() const noexcept {
+    return this->actual_str().max_size();
+  }
+
   void reserve(size_type new_cap);
-  size_type capacity() const noexcept;
+
+  size_type capacity() const noexcept {
+    return this->actual_str().capacity();
+  }
+
   void shrink_to_fit();
 
   /**
@@ -241,8 +284,24 @@ class DLLEXPORT UnicodeString_Api {
   void Draw(int position_x, int position_y) const;
   void Draw(int position_x, int position_y, const DrawTextOptions& options) const;
 
+  /**
+   * Converts UTF-8 text. Unlike D2Lang's Utf8ToUnicode, which stops at
+   * the first null character, the whole view is converted, including
+   * embedded null characters. Each invalid byte becomes U+FFFD, and so
+   * does each byte of an encoded surrogate. Code points above U+FFFF
+   * become surrogate pairs.
+   */
   static UnicodeString_Api FromUtf8String(std::u8string_view src);
 
+  /**
+   * Converts the string to UTF-8. Unlike D2Lang's UnicodeToUtf8, which
+   * stops at the first null character, the whole string is converted,
+   * including embedded null characters. A surrogate pair becomes one
+   * four-byte sequence. An unpaired surrogate is kept as its own
+   * three-byte sequence rather than replaced, so the result is not
+   * strictly valid UTF-8, and FromUtf8String turns such a sequence into
+   * U+FFFD characters.
+   */
   std::u8string ToUtf8String() const;
 
  private:
@@ -252,6 +311,20 @@ class DLLEXPORT UnicodeString_Api {
 
   ApiVariant str_;
 
+  /**
+   * ApiVariant has a single alternative, so the string is accessed
+   * through get_if instead of std::visit. get_if still checks the index,
+   * but the variant is never valueless, so the result is never null and
+   * there is no bad_variant_access path to carry.
+   */
+  std::basic_string<UnicodeChar_1_00>& actual_str() noexcept {
+    return *std::get_if<0>(&this->str_);
+  }
+
+  const std::basic_string<UnicodeChar_1_00>& actual_str() const noexcept {
+    return *std::get_if<0>(&this->str_);
+  }
+
   UnicodeString_Api(ApiVariant&& str);
 };
 
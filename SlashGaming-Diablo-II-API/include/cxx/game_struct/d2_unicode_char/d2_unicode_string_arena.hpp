@@ -0,0 +1,172 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_GAME_STRUCT_D2_UNICODE_CHAR_D2_UNICODE_STRING_ARENA_HPP_
+#define SGD2MAPI_CXX_GAME_STRUCT_D2_UNICODE_CHAR_D2_UNICODE_STRING_ARENA_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "d2_unicode_char_struct.hpp"
+#include "d2_unicode_string_view_api.hpp"
+
+#include "../../../dllexport_define.inc"
+
+namespace d2 {
+
+/**
+ * A bump allocator for Unicode strings that only live for a single frame.
+ * Memory is allocated in chunks that are kept between resets, so once the
+ * arena has warmed up, building a frame's worth of strings performs no
+ * heap allocations. Reset frees every string in constant time.
+ */
+class DLLEXPORT UnicodeStringArena {
+ public:
+  static constexpr const std::size_t kDefaultChunkLength = 4096;
+
+  UnicodeStringArena();
+
+  explicit UnicodeStringArena(std::size_t chunk_length);
+
+  UnicodeStringArena(const UnicodeStringArena& arena) = delete;
+
+  UnicodeStringArena(UnicodeStringArena&& arena) noexcept;
+
+  ~UnicodeStringArena();
+
+  UnicodeStringArena& operator=(const UnicodeStringArena& arena) = delete;
+
+  UnicodeStringArena& operator=(UnicodeStringArena&& arena) noexcept;
+
+  /**
+   * Allocates an uninitialized block of the specified number of
+   * characters. The block remains valid until the arena is reset.
+   */
+  UnicodeChar* Allocate(std::size_t length);
+
+  /**
+   * Attempts to grow the most recent allocation in place. Returns true if
+   * the block now holds the new length.
+   */
+  bool TryExtend(
+      const UnicodeChar* block,
+      std::size_t old_length,
+      std::size_t new_length
+  ) noexcept;
+
+  /**
+   * Copies the view into the arena and returns a null-terminated view of
+   * the copy.
+   */
+  UnicodeStringView_Api Copy(UnicodeStringView_Api view);
+
+  /**
+   * Frees every allocation made since the last reset. The chunks are
+   * kept for reuse.
+   */
+  void Reset() noexcept;
+
+  std::size_t chunk_count() const noexcept;
+
+ private:
+  struct Chunk {
+    std::unique_ptr<UnicodeChar_1_00[]> buffer;
+    std::size_t length;
+  };
+
+  std::vector<Chunk> chunks_;
+  std::size_t chunk_length_;
+  std::size_t current_chunk_index_;
+  std::size_t current_chunk_offset_;
+};
+
+/**
+ * Builds a null-terminated Unicode string in a UnicodeStringArena. The
+ * result can be passed anywhere a UnicodeStringView_Api is accepted, and
+ * remains valid until the arena is reset.
+ */
+class DLLEXPORT UnicodeStringBuilder {
+ public:
+  using value_type = UnicodeChar;
+  using size_type = int;
+
+  explicit UnicodeStringBuilder(UnicodeStringArena& arena) noexcept;
+
+  UnicodeStringBuilder& operator+=(UnicodeStringView_Api view);
+  UnicodeStringBuilder& operator+=(const value_type& ch);
+
+  operator UnicodeStringView_Api() const noexcept;
+
+  UnicodeStringBuilder& append(UnicodeStringView_Api view);
+  UnicodeStringBuilder& append(const value_type* s, size_type count);
+
+  void push_back(const value_type& ch);
+
+  void reserve(size_type new_cap);
+
+  void clear() noexcept;
+
+  const value_type* data() const noexcept;
+
+  const value_type* c_str() const noexcept;
+
+  size_type length() const noexcept;
+
+  size_type capacity() const noexcept;
+
+  [[nodiscard]] bool empty() const noexcept;
+
+ private:
+  UnicodeStringArena* arena_;
+  UnicodeChar_1_00* buffer_;
+  size_type length_;
+  size_type capacity_;
+};
+
+} // namespace d2
+
+#include "../../../dllexport_undefine.inc"
+#endif // SGD2MAPI_CXX_GAME_STRUCT_D2_UNICODE_CHAR_D2_UNICODE_STRING_ARENA_HPP_
@@ -105,55 +105,26 @@ class DLLEXPORT UnicodeStringView_Api {
    * Element access
    */
 
-  constexpr const_reference operator[](
+  const_reference operator[](
       size_type pos
   ) const {
-    const auto* actual_pointer = std::visit(
-        [pos](const auto& actual_view) {
-          return reinterpret_cast<const_pointer>(
-              &actual_view[pos]
-          );
-        },
-        this->view_
-    );
-
-    return *actual_pointer;
+    return reinterpret_cast<const_reference>(this->actual_view()[pos]);
   }
 
-  constexpr const_reference at(size_type pos) const {
-    return *std::visit(
-        [pos](const auto& actual_view) {
-          return reinterpret_cast<const_pointer>(&actual_view.at(pos));
-        },
-        this->view_
-    );
+  const_reference at(size_type pos) const {
+    return reinterpret_cast<const_reference>(this->actual_view().at(pos));
   }
 
-  constexpr const_reference front() const {
-    return *std::visit(
-        [](auto& actual_view) {
-          return reinterpret_cast<const_pointer>(&actual_view.front());
-        },
-        this->view_
-    );
+  const_reference front() const {
+    return reinterpret_cast<const_reference>(this->actual_view().front());
   }
 
-  constexpr const_reference back() const {
-    return *std::visit(
-        [](const auto& actual_view) {
-          return reinterpret_cast<const_pointer>(&actual_view.back());
-        },
-        this->view_
-    );
+  const_reference back() const {
+    return reinterpret_cast<const_reference>(this->actual_view().back());
   }
 
-  constexpr const_pointer data() const noexcept {
-    return std::visit(
-        [](const auto& actual_view) {
-          return reinterpret_cast<const_pointer>(actual_view.data());
-        },
-        this->view_
-    );
+  const_pointer data() const noexcept {
+    return reinterpret_cast<const_pointer>(this->actual_view().data());
   }
 
   /**
@@ -161,39 +132,19 @@ class DLLEXPORT UnicodeStringView_Api {
    */
 
   constexpr size_type size() const noexcept {
-    return std::visit(
-        [](const auto& actual_view) {
-          return actual_view.size();
-        },
-        this->view_
-    );
+    return this->actual_view().size();
   }
 
   constexpr size_type length() const noexcept {
-    return std::visit(
-        [](const auto& actual_view) {
-          return actual_view.length();
-        },
-        this->view_
-    );
+    return this->actual_view().length();
   }
 
   constexpr size_type max_size() const noexcept {
-    return std::visit(
-        [](const auto& actual_view) {
-          return actual_view.max_size();
-        },
-        this->view_
-    );
+    return this->actual_view().max_size();
   }
 
   [[nodiscard]] constexpr bool empty() const noexcept {
-    return std::visit(
-        [](const auto& actual_view) {
-          return actual_view.empty();
-        },
-        this->view_
-    );
+    return this->actual_view().empty();
   }
 
   /**
@@ -201,60 +152,30 @@ class DLLEXPORT UnicodeStringView_Api {
    */
 
   constexpr void remove_prefix(size_type n) {
-    std::visit(
-        [n](auto& actual_view) {
-          return actual_view.remove_prefix(n);
-        },
-        this->view_
-    );
+    this->actual_view().remove_prefix(n);
   }
 
   constexpr void remove_suffix(size_type n) {
-    std::visit(
-        [n](auto& actual_view) {
-          return actual_view.remove_suffix(n);
-        },
-        this->view_
-    );
+    this->actual_view().remove_suffix(n);
   }
 
   constexpr void swap(UnicodeStringView_Api& v) noexcept {
-    std::visit(
-        [&v](auto& actual_view) {
-          using UnicodeStringView_T = std::remove_reference_t<
-              decltype(actual_view)
-          >;
-
-          UnicodeStringView_T& actual_v =
-              std::get<UnicodeStringView_T>(v.view_);
-
-          return actual_view.swap(actual_v);
-        },
-        this->view_
-    );
+    this->actual_view().swap(v.actual_view());
   }
 
   /**
    * Operations
    */
 
-  constexpr size_type copy(
+  size_type copy(
       value_type* dest,
       size_type count,
       size_type pos = 0
   ) const {
-    return std::visit(
-        [dest, count, pos](const auto& actual_src_view) {
-          using UnicodeStringView_T = std::remove_reference_t<
-              decltype(actual_src_view)
-          >;
-          using UnicodeChar_T = typename UnicodeStringView_T::value_type;
-
-          UnicodeChar_T* actual_dest = reinterpret_cast<UnicodeChar_T*>(dest);
-
-          return actual_src_view.copy(actual_dest, count, pos);
-        },
-        this->view_
+    return this->actual_view().copy(
+        reinterpret_cast<UnicodeChar_1_00*>(dest),
+        count,
+        pos
     );
   }
 
@@ -278,135 +199,63 @@ class DLLEXPORT UnicodeStringView_Api {
       size_type count2
   ) const;
 
-  constexpr int compare(const value_type* s) const {
-    return std::visit(
-        [s](const auto& actual_src_view) {
-          using UnicodeStringView_T = std::remove_const_t<
-              std::remove_reference_t<decltype(actual_src_view)>
-          >;
-          using UnicodeChar_T = typename UnicodeStringView_T::value_type;
-
-          const UnicodeChar_T* actual_s =
-              reinterpret_cast<const UnicodeChar_T*>(s);
-
-          return actual_src_view.compare(actual_s);
-        },
-        this->view_
+  int compare(const value_type* s) const {
+    return this->actual_view().compare(
+        reinterpret_cast<const UnicodeChar_1_00*>(s)
     );
   }
 
-  constexpr int compare(
+  int compare(
       size_type pos1,
       size_type count1,
       const value_type* s
   ) const {
-    return std::visit(
-        [pos1, count1, s](const auto& actual_src_view) {
-          using UnicodeStringView_T = std::remove_const_t<
-              std::remove_reference_t<decltype(actual_src_view)>
-          >;
-          using UnicodeChar_T = typename UnicodeStringView_T::value_type;
-
-          const UnicodeChar_T* actual_s =
-              reinterpret_cast<const UnicodeChar_T*>(s);
-
-          return actual_src_view.compare(pos1, count1, actual_s);
-        },
-        this->view_
+    return this->actual_view().compare(
+        pos1,
+        count1,
+        reinterpret_cast<const UnicodeChar_1_00*>(s)
     );
   }
 
-  constexpr int compare(
+  int compare(
       size_type pos1,
       size_type count1,
       const value_type* s,
       size_type count2
   ) const {
-    return std::visit(
-        [pos1, count1, s, count2](const auto& actual_src_view) {
-          using UnicodeStringView_T = std::remove_const_t<
-              std::remove_reference_t<decltype(actual_src_view)>
-          >;
-          using UnicodeChar_T = typename UnicodeStringView_T::value_type;
-
-          const UnicodeChar_T* actual_s =
-              reinterpret_cast<const UnicodeChar_T*>(s);
-
-          return actual_src_view.compare(pos1, count1, actual_s, count2);
-        },
-        this->view_
+    return this->actual_view().compare(
+        pos1,
+        count1,
+        reinterpret_cast<const UnicodeChar_1_00*>(s),
+        count2
     );
   }
 
   bool starts_with(UnicodeStringView_Api sv) const noexcept;
 
-  constexpr bool starts_with(const value_type& c) const noexcept {
-    return std::visit(
-        [&c](const auto& actual_str_view) {
-          using UnicodeStringView_T = std::remove_reference_t<
-              decltype(actual_str_view)
-          >;
-          using UnicodeChar_T = typename UnicodeStringView_T::value_type;
-
-          const UnicodeChar_T& actual_c =
-              reinterpret_cast<const UnicodeChar_T&>(c);
-
-          return actual_str_view.starts_with(actual_c);
-        },
-        this->view_
+  bool starts_with(const value_type& c) const noexcept {
+    return this->actual_view().starts_with(
+        reinterpret_cast<const UnicodeChar_1_00&>(c)
     );
   }
 
-  constexpr bool starts_with(const value_type* s) const {
-    return std::visit(
-        [s](const auto& actual_view) {
-          using UnicodeStringView_T = std::remove_reference_t<
-              decltype(actual_view)
-          >;
-          using UnicodeChar_T = typename UnicodeStringView_T::value_type;
-
-          const UnicodeChar_T* actual_s =
-              reinterpret_cast<const UnicodeChar_T*>(s);
-
-          return actual_view.starts_with(actual_s);
-        },
-        this->view_
+  bool starts_with(const value_type* s) const {
+    return this->actual_view().starts_with(
+        reinterpret_cast<const UnicodeChar_1_00*>(s)
     );
   }
 
   bool ends_with(UnicodeStringView_Api sv) const noexcept;
 
-  constexpr bool ends_with(const value_type& c) const noexcept {
-    return std::visit(
-        [&c](const auto& actual_str_view) {
-          using UnicodeStringView_T = std::remove_reference_t<
-              decltype(actual_str_view)
-          >;
-          using UnicodeChar_T = typename UnicodeStringView_T::value_type;
-
-          const UnicodeChar_T& actual_c =
-              reinterpret_cast<const UnicodeChar_T&>(c);
-
-          return actual_str_view.ends_with(actual_c);
-        },
-        this->view_
+  bool ends_with(const value_type& c) const noexcept {
+    return this->actual_view().ends_with(
+        reinterpret_cast<const UnicodeChar_1_00&>(c)
     );
   }
 
-  constexpr bool ends_with(const value_type* s) const {
-    return std::visit(
-        [s](const auto& actual_view) {
-          using UnicodeStringView_T = std::remove_reference_t<
-              decltype(actual_view)
-          >;
-          using UnicodeChar_T = typename UnicodeStringView_T::value_type;
-
-          const UnicodeChar_T* actual_s =
-              reinterpret_cast<const UnicodeChar_T*>(s);
-
-          return actual_view.ends_with(actual_s);
-        },
-        this->view_
+  bool ends_with(const value_type* s) const {
+    return this->actual_view().ends_with(
+        reinterpret_cast<const UnicodeChar_1_00*>(s)
     );
   }
 
@@ -419,64 +268,35 @@ class DLLEXPORT UnicodeStringView_Api {
       size_type pos = 0
   ) const noexcept;
 
-  constexpr size_type find(
+  size_type find(
       value_type& ch,
       size_type pos = 0
   ) const noexcept {
-    return std::visit(
-        [&ch, pos](const auto& actual_view) {
-          using UnicodeStringView_T = std::remove_const_t<
-              std::remove_reference_t<decltype(actual_view)>
-          >;
-          using UnicodeChar_T = typename UnicodeStringView_T::value_type;
-
-          UnicodeChar_T& actual_ch =
-              reinterpret_cast<UnicodeChar_T&>(ch);
-
-          return actual_view.find(actual_ch, pos);
-        },
-        this->view_
+    return this->actual_view().find(
+        reinterpret_cast<const UnicodeChar_1_00&>(ch),
+        pos
     );
   }
 
-  constexpr size_type find(
+  size_type find(
       const value_type* s,
       size_type pos,
       size_type count
   ) const {
-    return std::visit(
-        [s, pos, count](const auto& actual_view) {
-          using UnicodeStringView_T = std::remove_const_t<
-              std::remove_reference_t<decltype(actual_view)>
-          >;
-          using UnicodeChar_T = typename UnicodeStringView_T::value_type;
-
-          const UnicodeChar_T* actual_s =
-              reinterpret_cast<const UnicodeChar_T*>(s);
-
-          return actual_view.find(actual_s, pos, count);
-        },
-        this->view_
+    return this->actual_view().find(
+        reinterpret_cast<const UnicodeChar_1_00*>(s),
+        pos,
+        count
     );
   }
 
-  constexpr size_type find(
+  size_type find(
       const value_type* s,
       size_type pos
   ) const {
-    return std::visit(
-        [s, pos](const auto& actual_view) {
-          using UnicodeStringView_T = std::remove_const_t<
-              std::remove_reference_t<decltype(actual_view)>
-          >;
-          using UnicodeChar_T = typename UnicodeStringView_T::value_type;
-
-          const UnicodeChar_T* actual_s =
-              reinterpret_cast<const UnicodeChar_T*>(s);
-
-          return actual_view.find(actual_s, pos);
-        },
-        this->view_
+    return this->actual_view().find(
+        reinterpret_cast<const UnicodeChar_1_00*>(s),
+        pos
     );
   }
 
@@ -494,6 +314,22 @@ class DLLEXPORT UnicodeStringView_Api {
 
   ApiVariant view_;
 
+  /**
+   * ApiVariant has a single alternative, so the view is accessed
+   * through get_if instead of std::visit. get_if still checks the index,
+   * but the variant is never valueless, so the result is never null and
+   * there is no bad_variant_access path to carry.
+   */
+  constexpr std::basic_string_view<UnicodeChar_1_00>&
+  actual_view() noexcept {
+    return *std::get_if<0>(&this->view_);
+  }
+
+  constexpr const std::basic_string_view<UnicodeChar_1_00>&
+  actual_view() const noexcept {
+    return *std::get_if<0>(&this->view_);
+  }
+
   constexpr explicit UnicodeStringView_Api(
       ApiVariant view
   ) noexcept
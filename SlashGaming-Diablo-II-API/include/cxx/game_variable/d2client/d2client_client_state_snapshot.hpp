@@ -0,0 +1,152 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_GAME_VARIABLE_D2CLIENT_D2CLIENT_CLIENT_STATE_SNAPSHOT_HPP_
+#define SGD2MAPI_CXX_GAME_VARIABLE_D2CLIENT_D2CLIENT_CLIENT_STATE_SNAPSHOT_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "../../game_constant/d2_client_game_type.hpp"
+#include "../../game_constant/d2_difficulty_level.hpp"
+#include "../../game_constant/d2_screen_open_mode.hpp"
+
+#include "../../../dllexport_define.inc"
+
+namespace d2::d2client {
+
+/**
+ * The values of the D2Client UI state variables, read together. A
+ * variable that the running game version does not have is left
+ * value-initialized.
+ */
+struct alignas(64) ClientStateSnapshot {
+  ScreenOpenMode screen_open_mode;
+  DifficultyLevel difficulty_level;
+  ClientGameType game_type;
+
+  int general_display_width;
+  int general_display_height;
+  int general_play_area_camera_shift_x;
+  int screen_shift_x;
+  int screen_shift_y;
+  int ingame_mouse_position_x;
+  int ingame_mouse_position_y;
+  unsigned int inventory_arrange_mode;
+
+  bool is_automap_open;
+  bool is_game_menu_open;
+  bool is_help_screen_open;
+  bool is_new_skill_button_pressed;
+  bool is_new_stats_button_pressed;
+};
+
+static_assert(std::is_trivially_copyable_v<ClientStateSnapshot>);
+static_assert(sizeof(ClientStateSnapshot) == 64);
+
+/**
+ * Reads every D2Client UI state variable. Only the D2Client variables
+ * are resolved, each once, and D2Client is never loaded by this call;
+ * before D2Client is loaded, every variable is left value-initialized.
+ */
+DLLEXPORT ClientStateSnapshot CaptureClientState();
+
+/**
+ * Holds the most recently published client state snapshot. One thread,
+ * usually the game thread once per frame, publishes snapshots; any number
+ * of threads can read them concurrently. A reader never sees a mix of
+ * two snapshots, and never blocks the publisher.
+ */
+class DLLEXPORT ClientStateSnapshotChannel {
+ public:
+  ClientStateSnapshotChannel() noexcept;
+
+  ClientStateSnapshotChannel(const ClientStateSnapshotChannel&) = delete;
+
+  ClientStateSnapshotChannel& operator=(
+      const ClientStateSnapshotChannel&
+  ) = delete;
+
+  /**
+   * Captures the client state and publishes it. Must not be called from
+   * more than one thread at a time.
+   */
+  void Update();
+
+  /**
+   * Publishes the snapshot. Must not be called from more than one thread
+   * at a time.
+   */
+  void Publish(const ClientStateSnapshot& snapshot) noexcept;
+
+  /**
+   * Returns the most recently published snapshot, or a value-initialized
+   * snapshot if none has been published.
+   */
+  ClientStateSnapshot Read() const noexcept;
+
+  /**
+   * Returns the number of snapshots that have been published.
+   */
+  std::uint32_t publish_count() const noexcept;
+
+ private:
+  static constexpr std::size_t kWordCount =
+      sizeof(ClientStateSnapshot) / sizeof(std::uint32_t);
+
+  // The sequence is odd while a snapshot is being written. The words are
+  // atomic so that a reader racing with the publisher is not a data race;
+  // the sequence tells the reader to discard what it read.
+  alignas(64) std::atomic<std::uint32_t> sequence_;
+  alignas(64) std::array<std::atomic<std::uint32_t>, kWordCount> words_;
+};
+
+} // namespace d2::d2client
+
+#include "../../../dllexport_undefine.inc"
+#endif // SGD2MAPI_CXX_GAME_VARIABLE_D2CLIENT_D2CLIENT_CLIENT_STATE_SNAPSHOT_HPP_
@@ -46,6 +46,7 @@
 #ifndef SGD2MAPI_CXX_GAME_VARIABLE_D2CLIENT_VARIABLE_HPP_
 #define SGD2MAPI_CXX_GAME_VARIABLE_D2CLIENT_VARIABLE_HPP_
 
+#include "d2client/d2client_client_state_snapshot.hpp"
 #include "d2client/d2client_difficulty_level.hpp"
 #include "d2client/d2client_game_type.hpp"
 #include "d2client/d2client_general_display_height.hpp"
@@ -48,6 +48,11 @@
 
 #include "helper/d2_determine_video_mode.hpp"
 #include "helper/d2_draw_options.hpp"
+#include "helper/d2_game_string_table.hpp"
+#include "helper/d2_game_variable_snapshot.hpp"
+#include "helper/d2_text_draw_batch.hpp"
+#include "helper/d2_text_layout.hpp"
+#include "helper/d2_unicode_string_routine.hpp"
 #include "helper/rgba_32bit_color.hpp"
 
 #endif // SGD2MAPI_CXX_HELPER_HPP_
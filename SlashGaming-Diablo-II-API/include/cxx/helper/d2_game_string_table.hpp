@@ -0,0 +1,201 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_HELPER_D2_GAME_STRING_TABLE_HPP_
+#define SGD2MAPI_CXX_HELPER_D2_GAME_STRING_TABLE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../game_constant/d2_text_font.hpp"
+#include "../game_struct/d2_unicode_char/d2_unicode_string_view_api.hpp"
+
+#include "../../dllexport_define.inc"
+
+namespace d2 {
+
+/**
+ * The source of the strings held by a game string table. The default
+ * implementation calls into D2Lang and D2Win.
+ */
+class DLLEXPORT GameStringSource {
+ public:
+  virtual ~GameStringSource();
+
+  /**
+   * Returns the string at the index in the current language. The string
+   * must be null-terminated.
+   */
+  virtual UnicodeStringView_Api GetStringByIndex(unsigned int id) = 0;
+
+  /**
+   * Returns the draw width of the text in the specified font.
+   */
+  virtual int GetDrawWidth(
+      UnicodeStringView_Api text,
+      TextFont text_font
+  ) = 0;
+
+  /**
+   * Returns the source that reads strings from the game.
+   */
+  static GameStringSource& GetGameSource();
+};
+
+/**
+ * An interning cache of game strings, keyed by language and string index.
+ * Each string is fetched once, copied into memory owned by the table,
+ * and converted to UTF-8 once. The views that the table returns stay
+ * valid until the table is cleared or destructed.
+ *
+ * The table cannot detect a change of the game's language, so callers
+ * identify the language with SetLanguage.
+ */
+class DLLEXPORT GameStringTable {
+ public:
+  GameStringTable();
+
+  explicit GameStringTable(GameStringSource& source);
+
+  GameStringTable(const GameStringTable& table) = delete;
+
+  GameStringTable(GameStringTable&& table) noexcept;
+
+  ~GameStringTable();
+
+  GameStringTable& operator=(const GameStringTable& table) = delete;
+
+  GameStringTable& operator=(GameStringTable&& table) noexcept;
+
+  /**
+   * Returns the string at the index in the current language.
+   */
+  UnicodeStringView_Api GetString(unsigned int id);
+
+  /**
+   * Returns the UTF-8 form of the string at the index in the current
+   * language.
+   */
+  std::u8string_view GetUtf8String(unsigned int id);
+
+  /**
+   * Returns the draw width of the string at the index in the specified
+   * font. The width is remembered for the most recently requested font.
+   */
+  int GetDrawWidth(unsigned int id, TextFont text_font);
+
+  /**
+   * Interns id_count consecutive strings, starting from first_id, in the
+   * current language. All of the new strings share a single allocation
+   * for their text and another for their UTF-8 form.
+   */
+  void Preload(unsigned int first_id, unsigned int id_count);
+
+  /**
+   * Selects the language that subsequent lookups are keyed by. Strings
+   * interned under other languages are kept.
+   */
+  void SetLanguage(std::uint32_t language);
+
+  std::uint32_t language() const noexcept;
+
+  /**
+   * Frees every interned string. Previously returned views become
+   * invalid.
+   */
+  void Clear() noexcept;
+
+  std::size_t size() const noexcept;
+
+  std::size_t hit_count() const noexcept;
+
+  std::size_t miss_count() const noexcept;
+
+  /**
+   * Returns the number of bytes used to store the text and UTF-8 form of
+   * the interned strings.
+   */
+  std::size_t memory_usage() const noexcept;
+
+ private:
+  struct Entry {
+    UnicodeStringView_Api text;
+    std::u8string_view utf8_text;
+    TextFont draw_width_font;
+    int draw_width;
+    bool has_draw_width;
+  };
+
+  GameStringSource* source_;
+  std::uint32_t language_;
+  std::unordered_map<std::uint64_t, Entry> entries_;
+  std::vector<std::unique_ptr<UnicodeChar_1_00[]>> text_blocks_;
+  std::vector<std::unique_ptr<char8_t[]>> utf8_blocks_;
+  std::size_t hit_count_;
+  std::size_t miss_count_;
+  std::size_t memory_usage_;
+
+  std::uint64_t GetKey(unsigned int id) const noexcept;
+
+  Entry& GetEntry(unsigned int id);
+
+  /**
+   * Copies the texts into two new blocks and adds an entry for each.
+   */
+  void Intern(
+      const unsigned int* ids,
+      const UnicodeStringView_Api* texts,
+      std::size_t count
+  );
+};
+
+} // namespace d2
+
+#include "../../dllexport_undefine.inc"
+#endif // SGD2MAPI_CXX_HELPER_D2_GAME_STRING_TABLE_HPP_
@@ -0,0 +1,158 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_HELPER_D2_GAME_VARIABLE_SNAPSHOT_HPP_
+#define SGD2MAPI_CXX_HELPER_D2_GAME_VARIABLE_SNAPSHOT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "../game_bool.hpp"
+#include "../game_constant/d2_difficulty_level.hpp"
+#include "../game_constant/d2_screen_open_mode.hpp"
+#include "../game_constant/d2_video_mode.hpp"
+
+#include "../../dllexport_define.inc"
+
+namespace d2 {
+
+/**
+ * The game variables that can be captured into a GameVariableSnapshot.
+ */
+enum class GameVariable {
+  kDifficultyLevel,
+  kGameType,
+  kGeneralDisplayHeight,
+  kGeneralDisplayWidth,
+  kGeneralPlayAreaCameraShiftX,
+  kIngameMousePositionX,
+  kIngameMousePositionY,
+  kInventoryArrangeMode,
+  kIsAutomapOpen,
+  kIsGameMenuOpen,
+  kIsHelpScreenOpen,
+  kIsNewSkillButtonPressed,
+  kIsNewStatsButtonPressed,
+  kScreenOpenMode,
+  kScreenShiftX,
+  kScreenShiftY,
+  kGlobalInventoryTxtRecordsCount,
+  kIsWindowedMode,
+  kResolutionMode,
+  kVideoMode,
+  kMainMenuMousePositionX,
+  kMainMenuMousePositionY,
+
+  kCount,
+};
+
+/**
+ * A set of game variables, with one bit for each GameVariable.
+ */
+using GameVariableMask = std::uint32_t;
+
+static_assert(
+    static_cast<std::size_t>(GameVariable::kCount)
+        <= sizeof(GameVariableMask) * 8
+);
+
+constexpr GameVariableMask ToGameVariableMask(GameVariable variable) {
+  return GameVariableMask(1) << static_cast<int>(variable);
+}
+
+constexpr GameVariableMask kAllGameVariables =
+    ToGameVariableMask(GameVariable::kCount) - 1;
+
+/**
+ * The values of game variables at one point in time. Values are stored
+ * as the game stores them, so that capturing is a plain copy. Only the
+ * variables in captured_mask hold values; the others are left untouched.
+ */
+struct GameVariableSnapshot {
+  GameVariableMask captured_mask;
+
+  DifficultyLevel_1_00 difficulty_level;
+  std::int32_t game_type;
+  std::int32_t general_display_height;
+  std::int32_t general_display_width;
+  std::int32_t general_play_area_camera_shift_x;
+  std::int32_t ingame_mouse_position_x;
+  std::int32_t ingame_mouse_position_y;
+  std::uint32_t inventory_arrange_mode;
+  mapi::bool32 is_automap_open;
+  mapi::bool32 is_game_menu_open;
+  mapi::bool32 is_help_screen_open;
+  mapi::bool32 is_new_skill_button_pressed;
+  mapi::bool32 is_new_stats_button_pressed;
+  ScreenOpenMode_1_07 screen_open_mode;
+  std::int32_t screen_shift_x;
+  std::int32_t screen_shift_y;
+  std::uint32_t global_inventory_txt_records_count;
+  mapi::bool32 is_windowed_mode;
+  std::uint32_t resolution_mode;
+  VideoMode_1_00 video_mode;
+  std::int32_t main_menu_mouse_position_x;
+  std::int32_t main_menu_mouse_position_y;
+};
+
+static_assert(std::is_trivial_v<GameVariableSnapshot>);
+static_assert(std::is_standard_layout_v<GameVariableSnapshot>);
+
+/**
+ * Copies the variables in the mask into the snapshot, and sets the
+ * snapshot's captured mask to the variables that were copied. Variables
+ * that the running game version does not have, or whose library is not
+ * loaded yet, are not copied. Capturing never loads a library.
+ */
+DLLEXPORT void CaptureGameVariables(
+    GameVariableMask mask,
+    GameVariableSnapshot* snapshot
+);
+
+} // namespace d2
+
+#include "../../dllexport_undefine.inc"
+#endif // SGD2MAPI_CXX_HELPER_D2_GAME_VARIABLE_SNAPSHOT_HPP_
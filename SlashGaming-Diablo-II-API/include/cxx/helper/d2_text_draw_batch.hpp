@@ -0,0 +1,186 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_HELPER_D2_TEXT_DRAW_BATCH_HPP_
+#define SGD2MAPI_CXX_HELPER_D2_TEXT_DRAW_BATCH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../game_constant/d2_text_color.hpp"
+#include "../game_constant/d2_text_font.hpp"
+#include "../game_struct/d2_unicode_char/d2_unicode_string_view_api.hpp"
+#include "d2_draw_options.hpp"
+
+#include "../../dllexport_define.inc"
+
+namespace d2 {
+
+/**
+ * The operations that a text draw batch issues when it is flushed. The
+ * default implementation calls into the game.
+ */
+class DLLEXPORT TextDrawBackend {
+ public:
+  virtual ~TextDrawBackend();
+
+  /**
+   * Sets the font used to measure and draw text. Returns the previous
+   * font.
+   */
+  virtual TextFont SetFont(TextFont text_font) = 0;
+
+  /**
+   * Returns the draw width of the text in the current font.
+   */
+  virtual int GetDrawWidth(UnicodeStringView_Api text) = 0;
+
+  /**
+   * Draws the text in the current font, with the left edge at the
+   * specified position.
+   */
+  virtual void DrawUnicodeText(
+      UnicodeStringView_Api text,
+      int position_x,
+      int position_y,
+      TextColor text_color
+  ) = 0;
+
+  /**
+   * Returns the backend that draws through the game. Its GetDrawWidth
+   * measures in the font last passed to SetFont, so SetFont must be
+   * called before text is measured.
+   */
+  static TextDrawBackend& GetGameBackend();
+};
+
+/**
+ * Records text draws and issues them together. On flush, the draws are
+ * grouped by font and color so that each font is set only once, and the
+ * previous font is restored afterwards. Draws with the same font and
+ * color keep the order they were added in; draws in different groups may
+ * be reordered, so overlapping text should use separate batches.
+ *
+ * The batch does not copy text. Each text must remain valid until the
+ * batch is flushed, and is drawn up to its null terminator, as with
+ * UnicodeStringView_Api::Draw. A UnicodeStringArena is a natural owner
+ * for per-frame text.
+ */
+class DLLEXPORT TextDrawBatch {
+ public:
+  TextDrawBatch();
+
+  explicit TextDrawBatch(TextDrawBackend& backend);
+
+  TextDrawBatch(const TextDrawBatch& batch) = delete;
+
+  TextDrawBatch(TextDrawBatch&& batch) noexcept;
+
+  ~TextDrawBatch();
+
+  TextDrawBatch& operator=(const TextDrawBatch& batch) = delete;
+
+  TextDrawBatch& operator=(TextDrawBatch&& batch) noexcept;
+
+  /**
+   * Records a draw of the text, aligned horizontally to the position as
+   * specified by the options.
+   */
+  void Add(
+      UnicodeStringView_Api text,
+      int position_x,
+      int position_y,
+      TextFont text_font,
+      const DrawTextOptions& options
+  );
+
+  /**
+   * Records a draw of the text centered between left and right, like
+   * d2client::DrawCenteredUnicodeText.
+   */
+  void AddCentered(
+      UnicodeStringView_Api text,
+      int left,
+      int right,
+      int position_y,
+      TextFont text_font,
+      TextColor text_color
+  );
+
+  /**
+   * Issues every recorded draw, then clears the batch. The command
+   * buffer's memory is kept for the next frame.
+   */
+  void Flush();
+
+  /**
+   * Discards every recorded draw without issuing it.
+   */
+  void Clear() noexcept;
+
+  std::size_t size() const noexcept;
+
+  [[nodiscard]] bool empty() const noexcept;
+
+ private:
+  struct Command {
+    UnicodeStringView_Api text;
+    int position_x;
+    int position_y;
+    DrawPositionXBehavior position_x_behavior;
+    TextColor text_color;
+    TextFont text_font;
+    std::uint32_t sequence;
+  };
+
+  TextDrawBackend* backend_;
+  std::vector<Command> commands_;
+};
+
+} // namespace d2
+
+#include "../../dllexport_undefine.inc"
+#endif // SGD2MAPI_CXX_HELPER_D2_TEXT_DRAW_BATCH_HPP_
@@ -0,0 +1,246 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_HELPER_D2_TEXT_LAYOUT_HPP_
+#define SGD2MAPI_CXX_HELPER_D2_TEXT_LAYOUT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../game_constant/d2_text_font.hpp"
+#include "../game_struct/d2_unicode_char/d2_unicode_char_struct.hpp"
+#include "../game_struct/d2_unicode_char/d2_unicode_string_view_api.hpp"
+
+#include "../../dllexport_define.inc"
+
+namespace d2 {
+
+/**
+ * The metrics that a text layout engine lays text out with. The default
+ * implementation measures text through D2Win.
+ */
+class DLLEXPORT TextLayoutSource {
+ public:
+  virtual ~TextLayoutSource();
+
+  /**
+   * Returns the draw width of a single code unit in the specified font.
+   * This is called for every code unit that is laid out, so a source
+   * that measures slowly should keep its own table of widths.
+   */
+  virtual int GetGlyphWidth(UnicodeChar_1_00 ch, TextFont text_font) = 0;
+
+  /**
+   * Returns the distance between the baselines of two consecutive lines
+   * in the specified font.
+   */
+  virtual int GetLineHeight(TextFont text_font) = 0;
+
+  /**
+   * Returns the source that measures text through the game.
+   */
+  static TextLayoutSource& GetGameSource();
+};
+
+/**
+ * A single line of laid out text. The text is null-terminated, so it can
+ * be drawn directly or added to a TextDrawBatch.
+ */
+struct TextLayoutLine {
+  UnicodeStringView_Api text;
+  int width;
+};
+
+/**
+ * The result of laying out text: its lines, in order, and the size of
+ * the box that bounds them.
+ */
+class DLLEXPORT TextLayout {
+ public:
+  TextLayout();
+
+  TextLayout(const TextLayout& layout) = delete;
+
+  TextLayout(TextLayout&& layout) noexcept;
+
+  ~TextLayout();
+
+  TextLayout& operator=(const TextLayout& layout) = delete;
+
+  TextLayout& operator=(TextLayout&& layout) noexcept;
+
+  std::span<const TextLayoutLine> lines() const noexcept;
+
+  /**
+   * Returns the width of the widest line.
+   */
+  int width() const noexcept;
+
+  /**
+   * Returns the height of all of the lines together.
+   */
+  int height() const noexcept;
+
+  int line_height() const noexcept;
+
+ private:
+  friend class TextLayoutEngine;
+
+  std::u16string source_text_;
+
+  std::vector<UnicodeChar_1_00> line_text_;
+  std::vector<TextLayoutLine> lines_;
+  int width_;
+  int line_height_;
+
+  // Whether the layout was returned since the engine's last Trim.
+  bool is_used_;
+};
+
+/**
+ * Breaks text into lines that fit within a maximum width. Lines break at
+ * newlines and, when a line would be too wide, after the last space
+ * before the overflow; a word wider than the maximum width is broken
+ * between code units. Spaces at a wrapped line break are dropped. Color
+ * codes take no width, and a maximum width of zero or less disables
+ * wrapping. Each line is drawn on its own, so a line that starts while a
+ * color code is in effect begins with a copy of that code.
+ *
+ * The engine measures text by summing the glyph widths that the source
+ * reports, so that laying out text is a single pass over it. The game
+ * source reads the widths from the same per-font tables that the width
+ * cache uses. Layouts are cached by text, font, and maximum width, and
+ * every distinct combination keeps its own layout. A returned layout stays
+ * valid until Clear, or until a call to Trim finds that it has not been
+ * returned since the previous Trim. Layout never evicts.
+ */
+class DLLEXPORT TextLayoutEngine {
+ public:
+  TextLayoutEngine();
+
+  explicit TextLayoutEngine(TextLayoutSource& source);
+
+  TextLayoutEngine(const TextLayoutEngine& engine) = delete;
+
+  TextLayoutEngine(TextLayoutEngine&& engine) noexcept;
+
+  ~TextLayoutEngine();
+
+  TextLayoutEngine& operator=(const TextLayoutEngine& engine) = delete;
+
+  TextLayoutEngine& operator=(TextLayoutEngine&& engine) noexcept;
+
+  /**
+   * Returns the layout of the text in the specified font, wrapped to the
+   * maximum width.
+   */
+  const TextLayout& Layout(
+      UnicodeStringView_Api text,
+      TextFont text_font,
+      int max_width
+  );
+
+  /**
+   * Frees every cached layout.
+   */
+  void Clear() noexcept;
+
+  /**
+   * Frees every cached layout that Layout has not returned since the
+   * previous call to Trim. Calling this once per frame keeps the layouts
+   * of the text that is still drawn, and frees the rest.
+   */
+  void Trim() noexcept;
+
+  /**
+   * Returns the number of cached layouts.
+   */
+  std::size_t size() const noexcept;
+
+ private:
+  /**
+   * The text, font, and maximum width of a cached layout. The text views
+   * the layout's own copy, which lives as long as the layout does.
+   */
+  struct LayoutKey {
+    std::u16string_view text;
+    TextFont text_font;
+    int max_width;
+
+    bool operator==(const LayoutKey& key) const noexcept = default;
+  };
+
+  struct LayoutKeyHash {
+    std::size_t operator()(const LayoutKey& key) const noexcept;
+  };
+
+  TextLayoutSource* source_;
+  std::unordered_map<
+      LayoutKey,
+      std::unique_ptr<TextLayout>,
+      LayoutKeyHash
+  > layouts_;
+
+  /**
+   * Lays out the text into the layout, replacing its contents.
+   */
+  void Build(
+      TextLayout& layout,
+      UnicodeStringView_Api text,
+      TextFont text_font,
+      int max_width
+  );
+};
+
+} // namespace d2
+
+#include "../../dllexport_undefine.inc"
+#endif // SGD2MAPI_CXX_HELPER_D2_TEXT_LAYOUT_HPP_
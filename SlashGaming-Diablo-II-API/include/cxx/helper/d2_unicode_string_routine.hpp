@@ -0,0 +1,103 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_HELPER_D2_UNICODE_STRING_ROUTINE_HPP_
+#define SGD2MAPI_CXX_HELPER_D2_UNICODE_STRING_ROUTINE_HPP_
+
+#include "../../dllexport_define.inc"
+
+namespace d2 {
+
+/**
+ * The D2Lang Unicode string operations that can be redirected away from
+ * the game's implementation.
+ */
+enum class UnicodeStringOperation {
+  kStrlen,
+  kStrcmp,
+  kStrncmp,
+  kStrcpy,
+  kStrcat,
+  kToLower,
+  kToUpper,
+
+  kCount,
+};
+
+enum class UnicodeStringRoutine {
+  /**
+   * Call into the game's D2Lang routine.
+   */
+  kGame,
+
+  /**
+   * Use the library's vectorized routine. Case conversion only changes
+   * letters in the Basic Latin and Latin-1 Supplement blocks.
+   */
+  kNative,
+};
+
+/**
+ * Returns the routine used by the version-independent D2Lang Unicode
+ * function for the operation. Defaults to kGame.
+ */
+DLLEXPORT UnicodeStringRoutine GetUnicodeStringRoutine(
+    UnicodeStringOperation operation
+);
+
+/**
+ * Sets the routine used by the version-independent D2Lang Unicode
+ * function for the operation. The versioned functions always call into
+ * the game.
+ */
+DLLEXPORT void SetUnicodeStringRoutine(
+    UnicodeStringOperation operation,
+    UnicodeStringRoutine routine
+);
+
+} // namespace d2
+
+#include "../../dllexport_undefine.inc"
+#endif // SGD2MAPI_CXX_HELPER_D2_UNICODE_STRING_ROUTINE_HPP_
@@ -0,0 +1,167 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGMAPI_CXX_TRAMPOLINE_ARENA_HPP_
+#define SGMAPI_CXX_TRAMPOLINE_ARENA_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "game_address.hpp"
+
+#include "../dllexport_define.inc"
+
+namespace mapi {
+
+/**
+ * The source of executable memory for a trampoline arena. The default
+ * implementation allocates memory in the current process.
+ */
+class DLLEXPORT TrampolinePageProvider {
+ public:
+  virtual ~TrampolinePageProvider();
+
+  /**
+   * Allocates a readable, writable and executable page within 2 GB of the
+   * specified address. Returns 0 if no page could be allocated.
+   */
+  virtual std::intptr_t AllocatePage(std::intptr_t near_address) = 0;
+
+  /**
+   * Frees a page that was returned by AllocatePage.
+   */
+  virtual void FreePage(std::intptr_t page_address) = 0;
+
+  /**
+   * Flushes the instruction cache for the specified range of memory.
+   */
+  virtual void FlushInstructionCache(
+      std::intptr_t address,
+      std::size_t size
+  ) = 0;
+
+  /**
+   * Returns the size of each page returned by AllocatePage.
+   */
+  virtual std::size_t page_size() const = 0;
+
+  /**
+   * Returns the page provider for the current process.
+   */
+  static TrampolinePageProvider& GetProcessPageProvider();
+};
+
+/**
+ * An allocator of small executable stubs, such as hook trampolines, that
+ * are reachable with a rel32 branch from a target module. Stubs are packed
+ * into shared pages and are only freed together, when the arena is cleared
+ * or destructed.
+ */
+class DLLEXPORT TrampolineArena {
+ public:
+  static constexpr const std::size_t kStubAlignment = 16;
+
+  /**
+   * Creates an arena for stubs that are reachable from the target address.
+   */
+  explicit TrampolineArena(std::intptr_t target_address);
+
+  TrampolineArena(
+      std::intptr_t target_address,
+      TrampolinePageProvider& page_provider
+  );
+
+  TrampolineArena(const TrampolineArena& arena) = delete;
+
+  TrampolineArena(TrampolineArena&& arena) noexcept;
+
+  /**
+   * Destructs the arena and frees all of its stubs.
+   */
+  ~TrampolineArena();
+
+  TrampolineArena& operator=(const TrampolineArena& arena) = delete;
+
+  TrampolineArena& operator=(TrampolineArena&& arena) noexcept;
+
+  /**
+   * Allocates a stub of the specified size. Returns the address of the
+   * writable stub, or 0 if the size exceeds a page or no page could be
+   * allocated.
+   */
+  std::intptr_t Allocate(std::size_t size);
+
+  /**
+   * Makes a trampoline that executes the instructions that a patch of the
+   * specified size would overwrite at the game address, then jumps back
+   * to the instruction after the patch. Must be called before the patch is
+   * applied. Returns the address of the trampoline, or 0 if the
+   * instructions could not be relocated.
+   */
+  std::intptr_t MakeTrampoline(
+      const GameAddress& game_address,
+      std::size_t patch_size
+  );
+
+  /**
+   * Frees all of the stubs in the arena. The stubs must no longer be
+   * reachable from patched code.
+   */
+  void Clear();
+
+  std::size_t page_count() const noexcept;
+
+ private:
+  TrampolinePageProvider* page_provider_;
+  std::intptr_t target_address_;
+  std::vector<std::intptr_t> pages_;
+  std::size_t current_page_offset_;
+};
+
+} // namespace mapi
+
+#include "../dllexport_undefine.inc"
+#endif // SGMAPI_CXX_TRAMPOLINE_ARENA_HPP_
@@ -55,9 +55,11 @@
 #include "cxx/game_executable.hpp"
 #include "cxx/game_function.hpp"
 #include "cxx/game_patch.hpp"
+#include "cxx/game_patch_transaction.hpp"
 #include "cxx/game_struct.hpp"
 #include "cxx/game_variable.hpp"
 #include "cxx/game_version.hpp"
 #include "cxx/helper.hpp"
+#include "cxx/trampoline_arena.hpp"
 
 #endif // SGD2MAPI_SGD2MAPI_HPP_
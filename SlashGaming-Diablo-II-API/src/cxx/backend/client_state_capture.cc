@@ -0,0 +1,144 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "client_state_capture.hpp"
+
+namespace mapi {
+namespace {
+
+template <typename T, typename U>
+static void CaptureValue(const T* address, U* value) {
+  if (address == nullptr) {
+    return;
+  }
+
+  *value = static_cast<U>(*address);
+}
+
+} // namespace
+
+::d2::d2client::ClientStateSnapshot CaptureClientState(
+    const ClientStateAddresses& addresses,
+    ::d2::GameVersion game_version
+) {
+  using ::d2::GameVersion;
+
+  ::d2::d2client::ClientStateSnapshot snapshot = {};
+
+  if (addresses.screen_open_mode != nullptr) {
+    snapshot.screen_open_mode = ::d2::screen_open_mode::ToApiValue_1_07(
+        *addresses.screen_open_mode
+    );
+  }
+
+  if (addresses.difficulty_level != nullptr) {
+    snapshot.difficulty_level = ::d2::difficulty_level::ToApiValue_1_00(
+        *addresses.difficulty_level
+    );
+  }
+
+  if (addresses.game_type != nullptr) {
+    std::int32_t game_type = *addresses.game_type;
+
+    if (game_version <= GameVersion::k1_06B) {
+      snapshot.game_type = ::d2::client_game_type::ToApiValue_1_00(
+          static_cast<::d2::ClientGameType_1_00>(game_type)
+      );
+    } else /* if (game_version >= GameVersion::k1_07Beta) */ {
+      snapshot.game_type = ::d2::client_game_type::ToApiValue_1_07(
+          static_cast<::d2::ClientGameType_1_07>(game_type)
+      );
+    }
+  }
+
+  CaptureValue(
+      addresses.general_display_width,
+      &snapshot.general_display_width
+  );
+  CaptureValue(
+      addresses.general_display_height,
+      &snapshot.general_display_height
+  );
+  CaptureValue(
+      addresses.general_play_area_camera_shift_x,
+      &snapshot.general_play_area_camera_shift_x
+  );
+  CaptureValue(addresses.screen_shift_x, &snapshot.screen_shift_x);
+  CaptureValue(addresses.screen_shift_y, &snapshot.screen_shift_y);
+  CaptureValue(
+      addresses.ingame_mouse_position_x,
+      &snapshot.ingame_mouse_position_x
+  );
+  CaptureValue(
+      addresses.ingame_mouse_position_y,
+      &snapshot.ingame_mouse_position_y
+  );
+  CaptureValue(
+      addresses.inventory_arrange_mode,
+      &snapshot.inventory_arrange_mode
+  );
+
+  CaptureValue(addresses.is_automap_open, &snapshot.is_automap_open);
+  CaptureValue(
+      addresses.is_game_menu_open,
+      &snapshot.is_game_menu_open
+  );
+  CaptureValue(
+      addresses.is_help_screen_open,
+      &snapshot.is_help_screen_open
+  );
+  CaptureValue(
+      addresses.is_new_skill_button_pressed,
+      &snapshot.is_new_skill_button_pressed
+  );
+  CaptureValue(
+      addresses.is_new_stats_button_pressed,
+      &snapshot.is_new_stats_button_pressed
+  );
+
+  return snapshot;
+}
+
+} // namespace mapi
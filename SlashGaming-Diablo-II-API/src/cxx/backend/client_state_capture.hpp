@@ -0,0 +1,96 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_BACKEND_CLIENT_STATE_CAPTURE_HPP_
+#define SGD2MAPI_CXX_BACKEND_CLIENT_STATE_CAPTURE_HPP_
+
+#include <cstdint>
+
+#include "../../../include/cxx/game_bool.hpp"
+#include "../../../include/cxx/game_constant/d2_difficulty_level.hpp"
+#include "../../../include/cxx/game_constant/d2_screen_open_mode.hpp"
+#include "../../../include/cxx/game_variable/d2client/d2client_client_state_snapshot.hpp"
+#include "../../../include/cxx/game_version.hpp"
+
+namespace mapi {
+
+/**
+ * The addresses of the D2Client UI state variables. A variable that is
+ * not available has a nullptr address.
+ */
+struct ClientStateAddresses {
+  const ::d2::ScreenOpenMode_1_07* screen_open_mode;
+  const ::d2::DifficultyLevel_1_00* difficulty_level;
+  const ::std::int32_t* game_type;
+
+  const ::std::int32_t* general_display_width;
+  const ::std::int32_t* general_display_height;
+  const ::std::int32_t* general_play_area_camera_shift_x;
+  const ::std::int32_t* screen_shift_x;
+  const ::std::int32_t* screen_shift_y;
+  const ::std::int32_t* ingame_mouse_position_x;
+  const ::std::int32_t* ingame_mouse_position_y;
+  const ::std::uint32_t* inventory_arrange_mode;
+
+  const bool32* is_automap_open;
+  const bool32* is_game_menu_open;
+  const bool32* is_help_screen_open;
+  const bool32* is_new_skill_button_pressed;
+  const bool32* is_new_stats_button_pressed;
+};
+
+/**
+ * Reads the D2Client UI state variables through the addresses,
+ * converting each value from the representation used by the game
+ * version. Variables with a nullptr address are left value-initialized.
+ */
+::d2::d2client::ClientStateSnapshot CaptureClientState(
+    const ClientStateAddresses& addresses,
+    ::d2::GameVersion game_version
+);
+
+} // namespace mapi
+
+#endif // SGD2MAPI_CXX_BACKEND_CLIENT_STATE_CAPTURE_HPP_
@@ -83,7 +83,22 @@ static_assert(
 } // namespace
 
 bool IsFileD2seExecutable(const wchar_t* path) {
-  FilePeSignature file_signature = FilePeSignature::ReadFile(path);
+  const ::mapi::MappedFile file(path);
+
+  return IsFileD2seExecutable(file);
+}
+
+bool IsFileD2seExecutable(const ::mapi::MappedFile& file) {
+  FilePeSignature file_signature;
+  bool is_read_success = FilePeSignature::ReadBytes(
+      file.data(),
+      file.size(),
+      &file_signature
+  );
+
+  if (!is_read_success) {
+    return false;
+  }
 
   return ::std::ranges::binary_search(
       kD2seExecutablePeSignatureSortedSet,
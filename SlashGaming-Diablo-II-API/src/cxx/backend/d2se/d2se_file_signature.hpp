@@ -46,10 +46,18 @@
 #ifndef SGMAPI_CXX_BACKEND_D2SE_D2SE_FILE_SIGNATURE_HPP_
 #define SGMAPI_CXX_BACKEND_D2SE_D2SE_FILE_SIGNATURE_HPP_
 
+#include "../file/mapped_file.hpp"
+
 namespace d2::d2se::intern::file_signature {
 
 bool IsFileD2seExecutable(const wchar_t* path);
 
+/**
+ * Checks an executable that the caller has already mapped, so that the
+ * mapping can be shared with other checks of the same file.
+ */
+bool IsFileD2seExecutable(const ::mapi::MappedFile& file);
+
 } // namespace d2::d2se::intern::file_signature
 
 #endif // SGMAPI_CXX_BACKEND_D2SE_D2SE_FILE_SIGNATURE_HPP_
@@ -0,0 +1,246 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "mapped_file.hpp"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace mapi {
+namespace {
+
+#if defined(_WIN32)
+
+static const ::std::uint8_t* MapFile(
+    const wchar_t* path,
+    ::std::size_t* size
+) {
+  HANDLE file_handle = CreateFileW(
+      path,
+      GENERIC_READ,
+      FILE_SHARE_READ,
+      nullptr,
+      OPEN_EXISTING,
+      FILE_ATTRIBUTE_NORMAL,
+      nullptr
+  );
+
+  if (file_handle == INVALID_HANDLE_VALUE) {
+    return nullptr;
+  }
+
+  LARGE_INTEGER file_size;
+  BOOL is_get_file_size_success = GetFileSizeEx(file_handle, &file_size);
+
+  // Empty files cannot be mapped.
+  if (!is_get_file_size_success || file_size.QuadPart == 0) {
+    CloseHandle(file_handle);
+    return nullptr;
+  }
+
+  HANDLE mapping_handle = CreateFileMappingW(
+      file_handle,
+      nullptr,
+      PAGE_READONLY,
+      0,
+      0,
+      nullptr
+  );
+
+  CloseHandle(file_handle);
+
+  if (mapping_handle == nullptr) {
+    return nullptr;
+  }
+
+  void* view = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+
+  // The view keeps the mapping alive after its handle is closed.
+  CloseHandle(mapping_handle);
+
+  if (view == nullptr) {
+    return nullptr;
+  }
+
+  *size = static_cast<::std::size_t>(file_size.QuadPart);
+
+  return static_cast<const ::std::uint8_t*>(view);
+}
+
+static void UnmapFile(const ::std::uint8_t* data, ::std::size_t) {
+  UnmapViewOfFile(data);
+}
+
+#else
+
+static const ::std::uint8_t* MapFile(
+    const wchar_t* path,
+    ::std::size_t* size
+) {
+  ::std::size_t path_length = ::std::wcstombs(nullptr, path, 0);
+
+  if (path_length == static_cast<::std::size_t>(-1)) {
+    return nullptr;
+  }
+
+  ::std::string narrow_path(path_length, '\0');
+  ::std::wcstombs(narrow_path.data(), path, path_length + 1);
+
+  int file_descriptor = open(narrow_path.c_str(), O_RDONLY);
+
+  if (file_descriptor == -1) {
+    return nullptr;
+  }
+
+  struct stat file_status;
+
+  // Empty files cannot be mapped.
+  if (fstat(file_descriptor, &file_status) != 0
+      || file_status.st_size == 0) {
+    close(file_descriptor);
+    return nullptr;
+  }
+
+  void* view = mmap(
+      nullptr,
+      file_status.st_size,
+      PROT_READ,
+      MAP_PRIVATE,
+      file_descriptor,
+      0
+  );
+
+  // The mapping stays valid after the file descriptor is closed.
+  close(file_descriptor);
+
+  if (view == MAP_FAILED) {
+    return nullptr;
+  }
+
+  *size = static_cast<::std::size_t>(file_status.st_size);
+
+  return static_cast<const ::std::uint8_t*>(view);
+}
+
+static void UnmapFile(const ::std::uint8_t* data, ::std::size_t size) {
+  munmap(const_cast<::std::uint8_t*>(data), size);
+}
+
+#endif
+
+} // namespace
+
+MappedFile::MappedFile() noexcept
+    : data_(nullptr),
+      size_(0) {
+}
+
+MappedFile::MappedFile(const wchar_t* path)
+    : data_(nullptr),
+      size_(0) {
+  this->data_ = MapFile(path, &this->size_);
+
+  if (this->data_ == nullptr) {
+    this->size_ = 0;
+  }
+}
+
+MappedFile::MappedFile(MappedFile&& rhs) noexcept
+    : data_(::std::exchange(rhs.data_, nullptr)),
+      size_(::std::exchange(rhs.size_, 0)) {
+}
+
+MappedFile::~MappedFile() {
+  this->Close();
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& rhs) noexcept {
+  if (this == &rhs) {
+    return *this;
+  }
+
+  this->Close();
+
+  this->data_ = ::std::exchange(rhs.data_, nullptr);
+  this->size_ = ::std::exchange(rhs.size_, 0);
+
+  return *this;
+}
+
+bool MappedFile::Read(
+    ::std::size_t offset,
+    void* destination,
+    ::std::size_t count
+) const noexcept {
+  if (offset > this->size_ || count > this->size_ - offset) {
+    return false;
+  }
+
+  ::std::memcpy(destination, &this->data_[offset], count);
+
+  return true;
+}
+
+void MappedFile::Close() noexcept {
+  if (this->data_ != nullptr) {
+    UnmapFile(this->data_, this->size_);
+  }
+
+  this->data_ = nullptr;
+  this->size_ = 0;
+}
+
+} // namespace mapi
@@ -43,61 +43,68 @@
  *  work.
  */
 
-#include "fastcall_function.hpp"
+#ifndef SGD2MAPI_CXX_BACKEND_FILE_MAPPED_FILE_HPP_
+#define SGD2MAPI_CXX_BACKEND_FILE_MAPPED_FILE_HPP_
 
-#include "../../../asm_x86_macro.h"
+#include <cstddef>
+#include <cstdint>
 
 namespace mapi {
 
-__declspec(naked) void* __cdecl CallFastcallFunction_Impl(
-    std::intptr_t func_ptr,
-    int num_params,
-    ...
-) {
-  ASM_X86(push ebp);
-  ASM_X86(mov ebp, esp);
+/**
+ * A read-only memory mapping of an entire file. A file that could not be
+ * opened or mapped is represented as an empty mapping. The file is
+ * unmapped when the mapping is destroyed, so callers should hold it only
+ * as long as they read from it.
+ */
+class MappedFile {
+ public:
+  MappedFile() noexcept;
 
-  ASM_X86(push ecx);
-  ASM_X86(push edx);
+  /**
+   * Maps the file at the specified path.
+   */
+  explicit MappedFile(const wchar_t* path);
 
-  // Push all the stack arguments.
+  MappedFile(const MappedFile& rhs) = delete;
 
-  // Load num_params into ecx.
-  ASM_X86(mov ecx, dword ptr [ebp + 12]);
+  MappedFile(MappedFile&& rhs) noexcept;
 
-  // Load pointer of num_params into eax, which will be used to get the
-  // pointer of the parameters after it.
-  ASM_X86(lea eax, dword ptr [ebp + 12]);
-  ASM_X86(lea eax, dword ptr [eax + ecx * 4]);
-ASM_X86_LABEL(CallFastcallFunction_PushStackArgsLoop);
-  ASM_X86(cmp ecx, 3);
-  ASM_X86(jl CallFastcallFunction_PushStackArgsLoopEnd);
+  ~MappedFile();
 
-  ASM_X86(push dword ptr [eax]);
-  ASM_X86(sub ecx, 1);
-  ASM_X86(sub eax, 4);
-  ASM_X86(jmp CallFastcallFunction_PushStackArgsLoop);
-ASM_X86_LABEL(CallFastcallFunction_PushStackArgsLoopEnd);
+  MappedFile& operator=(const MappedFile& rhs) = delete;
 
-  // We do not conditionally branch when setting the ecx or edx registers,
-  // because it incurs additional cost (in readability and execution) with no
-  // realistic benefit. the fact that if the called function has no
-  // parameters, the register values are overwritten anyways.
+  MappedFile& operator=(MappedFile&& rhs) noexcept;
 
-  // Set second parameter.
-  ASM_X86(mov edx, dword ptr [ebp + 20]);
+  /**
+   * Copies count bytes starting at offset into the destination. Returns
+   * false without copying if the range is not within the file.
+   */
+  bool Read(
+      ::std::size_t offset,
+      void* destination,
+      ::std::size_t count
+  ) const noexcept;
 
-  // Set first parameter.
-  ASM_X86(mov ecx, dword ptr [ebp + 16]);
+  constexpr const ::std::uint8_t* data() const noexcept {
+    return this->data_;
+  }
 
-  // Call the function.
-  ASM_X86(call dword ptr [ebp + 8]);
+  constexpr ::std::size_t size() const noexcept {
+    return this->size_;
+  }
 
-  ASM_X86(pop edx);
-  ASM_X86(pop ecx);
+  constexpr bool is_open() const noexcept {
+    return this->data_ != nullptr;
+  }
 
-  ASM_X86(leave);
-  ASM_X86(ret);
-}
+ private:
+  const ::std::uint8_t* data_;
+  ::std::size_t size_;
+
+  void Close() noexcept;
+};
 
 } // namespace mapi
+
+#endif // SGD2MAPI_CXX_BACKEND_FILE_MAPPED_FILE_HPP_
@@ -0,0 +1,409 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "pe_image.hpp"
+
+#include <cstring>
+#include <utility>
+
+namespace mapi {
+namespace {
+
+static constexpr ::std::size_t kDosHeaderNewHeaderOffset = 0x3C;
+static constexpr ::std::size_t kPeSignatureSize = 4;
+static constexpr ::std::size_t kFileHeaderSize = 20;
+static constexpr ::std::size_t kSectionHeaderSize = 40;
+static constexpr ::std::size_t kExportDirectorySize = 40;
+
+static constexpr ::std::uint16_t kOptionalHeaderMagicPe32 = 0x10B;
+static constexpr ::std::uint16_t kOptionalHeaderMagicPe32Plus = 0x20B;
+
+template <typename T>
+static T ReadLittleEndian(const ::std::uint8_t* ptr) noexcept {
+  T value = 0;
+
+  for (::std::size_t i = 0; i < sizeof(T); i += 1) {
+    value |= static_cast<T>(ptr[i]) << (i * 8);
+  }
+
+  return value;
+}
+
+} // namespace
+
+PeImage::PeImage() noexcept
+    : data_(nullptr),
+      size_(0),
+      layout_(Layout::kMapped),
+      is_valid_(false),
+      section_headers_offset_(0),
+      section_count_(0),
+      export_directory_rva_(0),
+      export_directory_size_(0),
+      ordinal_base_(0) {
+}
+
+PeImage::PeImage(
+    const ::std::uint8_t* data,
+    ::std::size_t size,
+    Layout layout
+)
+    : data_(data),
+      size_(size),
+      layout_(layout),
+      is_valid_(false),
+      section_headers_offset_(0),
+      section_count_(0),
+      export_directory_rva_(0),
+      export_directory_size_(0),
+      ordinal_base_(0) {
+  this->is_valid_ = this->ReadHeaders() && this->ReadExportDirectory();
+
+  if (!this->is_valid_) {
+    this->export_rvas_.clear();
+    this->export_rvas_by_name_.clear();
+  }
+}
+
+PeImage PeImage::FromLoadedModule(::std::intptr_t base_address) {
+  if (base_address == 0) {
+    return PeImage();
+  }
+
+  const ::std::uint8_t* data =
+      reinterpret_cast<const ::std::uint8_t*>(base_address);
+
+  // The headers of a loaded module are always mapped, so SizeOfImage can
+  // be read before the bounds of the image are known.
+  ::std::uint32_t new_header_offset = ReadLittleEndian<::std::uint32_t>(
+      &data[kDosHeaderNewHeaderOffset]
+  );
+
+  const ::std::uint8_t* optional_header =
+      &data[new_header_offset + kPeSignatureSize + kFileHeaderSize];
+
+  ::std::uint32_t size_of_image = ReadLittleEndian<::std::uint32_t>(
+      &optional_header[56]
+  );
+
+  return PeImage(data, size_of_image, Layout::kMapped);
+}
+
+::std::uint32_t PeImage::FindExportByName(
+    ::std::string_view name
+) const noexcept {
+  auto search_result = this->export_rvas_by_name_.find(name);
+
+  if (search_result == this->export_rvas_by_name_.cend()) {
+    return 0;
+  }
+
+  return search_result->second;
+}
+
+::std::uint32_t PeImage::FindExportByOrdinal(
+    ::std::uint16_t ordinal
+) const noexcept {
+  ::std::uint32_t index = ordinal - this->ordinal_base_;
+
+  if (ordinal < this->ordinal_base_ || index >= this->export_rvas_.size()) {
+    return 0;
+  }
+
+  return this->export_rvas_[index];
+}
+
+bool PeImage::ReadHeaders() {
+  const ::std::uint8_t* dos_header = this->OffsetToPointer(
+      0,
+      kDosHeaderNewHeaderOffset + sizeof(::std::uint32_t)
+  );
+
+  if (dos_header == nullptr || dos_header[0] != 'M' || dos_header[1] != 'Z') {
+    return false;
+  }
+
+  ::std::uint32_t new_header_offset = ReadLittleEndian<::std::uint32_t>(
+      &dos_header[kDosHeaderNewHeaderOffset]
+  );
+
+  const ::std::uint8_t* nt_headers = this->OffsetToPointer(
+      new_header_offset,
+      kPeSignatureSize + kFileHeaderSize
+  );
+
+  if (nt_headers == nullptr
+      || ::std::memcmp(nt_headers, "PE\0\0", kPeSignatureSize) != 0) {
+    return false;
+  }
+
+  const ::std::uint8_t* file_header = &nt_headers[kPeSignatureSize];
+  ::std::uint16_t section_count = ReadLittleEndian<::std::uint16_t>(
+      &file_header[2]
+  );
+  ::std::uint16_t optional_header_size = ReadLittleEndian<::std::uint16_t>(
+      &file_header[16]
+  );
+
+  ::std::size_t optional_header_offset =
+      new_header_offset + kPeSignatureSize + kFileHeaderSize;
+
+  const ::std::uint8_t* optional_header = this->OffsetToPointer(
+      optional_header_offset,
+      optional_header_size
+  );
+
+  if (optional_header == nullptr || optional_header_size < 2) {
+    return false;
+  }
+
+  ::std::uint16_t magic = ReadLittleEndian<::std::uint16_t>(
+      optional_header
+  );
+
+  ::std::size_t rva_count_offset;
+
+  if (magic == kOptionalHeaderMagicPe32) {
+    rva_count_offset = 92;
+  } else if (magic == kOptionalHeaderMagicPe32Plus) {
+    rva_count_offset = 108;
+  } else {
+    return false;
+  }
+
+  this->section_headers_offset_ =
+      optional_header_offset + optional_header_size;
+  this->section_count_ = section_count;
+
+  if (this->OffsetToPointer(
+          this->section_headers_offset_,
+          this->section_count_ * kSectionHeaderSize
+      ) == nullptr) {
+    return false;
+  }
+
+  // The export directory is the first data directory, immediately after
+  // the count of data directories.
+  ::std::size_t export_data_directory_offset = rva_count_offset + 4;
+
+  if (optional_header_size < export_data_directory_offset + 8) {
+    return false;
+  }
+
+  ::std::uint32_t rva_count = ReadLittleEndian<::std::uint32_t>(
+      &optional_header[rva_count_offset]
+  );
+
+  if (rva_count == 0) {
+    return true;
+  }
+
+  this->export_directory_rva_ = ReadLittleEndian<::std::uint32_t>(
+      &optional_header[export_data_directory_offset]
+  );
+  this->export_directory_size_ = ReadLittleEndian<::std::uint32_t>(
+      &optional_header[export_data_directory_offset + 4]
+  );
+
+  return true;
+}
+
+bool PeImage::ReadExportDirectory() {
+  // An image without exports is valid, but has an empty index.
+  if (this->export_directory_rva_ == 0) {
+    return true;
+  }
+
+  const ::std::uint8_t* export_directory = this->RvaToPointer(
+      this->export_directory_rva_,
+      kExportDirectorySize
+  );
+
+  if (export_directory == nullptr) {
+    return false;
+  }
+
+  this->ordinal_base_ = ReadLittleEndian<::std::uint32_t>(
+      &export_directory[16]
+  );
+  ::std::uint32_t function_count = ReadLittleEndian<::std::uint32_t>(
+      &export_directory[20]
+  );
+  ::std::uint32_t name_count = ReadLittleEndian<::std::uint32_t>(
+      &export_directory[24]
+  );
+
+  if (function_count > this->size_ / sizeof(::std::uint32_t)
+      || name_count > this->size_ / sizeof(::std::uint32_t)) {
+    return false;
+  }
+
+  const ::std::uint8_t* functions = this->RvaToPointer(
+      ReadLittleEndian<::std::uint32_t>(&export_directory[28]),
+      function_count * sizeof(::std::uint32_t)
+  );
+  const ::std::uint8_t* names = this->RvaToPointer(
+      ReadLittleEndian<::std::uint32_t>(&export_directory[32]),
+      name_count * sizeof(::std::uint32_t)
+  );
+  const ::std::uint8_t* name_ordinals = this->RvaToPointer(
+      ReadLittleEndian<::std::uint32_t>(&export_directory[36]),
+      name_count * sizeof(::std::uint16_t)
+  );
+
+  if ((function_count > 0 && functions == nullptr)
+      || (name_count > 0 && (names == nullptr || name_ordinals == nullptr))) {
+    return false;
+  }
+
+  // Forwarded exports are stored as 0, so that callers fall back to the
+  // OS loader to resolve them.
+  this->export_rvas_.resize(function_count);
+
+  for (::std::size_t i = 0; i < function_count; i += 1) {
+    ::std::uint32_t rva = ReadLittleEndian<::std::uint32_t>(
+        &functions[i * sizeof(::std::uint32_t)]
+    );
+
+    this->export_rvas_[i] = this->IsForwardedExport(rva) ? 0 : rva;
+  }
+
+  this->export_rvas_by_name_.reserve(name_count);
+
+  for (::std::size_t i = 0; i < name_count; i += 1) {
+    ::std::uint32_t name_rva = ReadLittleEndian<::std::uint32_t>(
+        &names[i * sizeof(::std::uint32_t)]
+    );
+    ::std::uint16_t function_index = ReadLittleEndian<::std::uint16_t>(
+        &name_ordinals[i * sizeof(::std::uint16_t)]
+    );
+
+    const char* name = reinterpret_cast<const char*>(
+        this->RvaToPointer(name_rva, 1)
+    );
+
+    if (name == nullptr || function_index >= function_count) {
+      return false;
+    }
+
+    // The name must be terminated within the bounds of the image.
+    ::std::size_t name_offset = reinterpret_cast<const ::std::uint8_t*>(name)
+        - this->data_;
+    const void* terminator = ::std::memchr(
+        name,
+        '\0',
+        this->size_ - name_offset
+    );
+
+    if (terminator == nullptr) {
+      return false;
+    }
+
+    this->export_rvas_by_name_.emplace(
+        ::std::string_view(name, static_cast<const char*>(terminator) - name),
+        this->export_rvas_[function_index]
+    );
+  }
+
+  return true;
+}
+
+bool PeImage::IsForwardedExport(::std::uint32_t rva) const noexcept {
+  return rva >= this->export_directory_rva_
+      && rva - this->export_directory_rva_ < this->export_directory_size_;
+}
+
+const ::std::uint8_t* PeImage::RvaToPointer(
+    ::std::uint32_t rva,
+    ::std::size_t count
+) const noexcept {
+  if (this->layout_ == Layout::kMapped) {
+    return this->OffsetToPointer(rva, count);
+  }
+
+  for (::std::size_t i = 0; i < this->section_count_; i += 1) {
+    const ::std::uint8_t* section_header = &this->data_[
+        this->section_headers_offset_ + (i * kSectionHeaderSize)
+    ];
+
+    ::std::uint32_t virtual_address = ReadLittleEndian<::std::uint32_t>(
+        &section_header[12]
+    );
+    ::std::uint32_t raw_data_size = ReadLittleEndian<::std::uint32_t>(
+        &section_header[16]
+    );
+    ::std::uint32_t raw_data_offset = ReadLittleEndian<::std::uint32_t>(
+        &section_header[20]
+    );
+
+    if (rva < virtual_address || rva - virtual_address >= raw_data_size) {
+      continue;
+    }
+
+    ::std::uint32_t rva_offset = rva - virtual_address;
+    if (count > raw_data_size - rva_offset) {
+      return nullptr;
+    }
+
+    return this->OffsetToPointer(raw_data_offset + rva_offset, count);
+  }
+
+  return nullptr;
+}
+
+const ::std::uint8_t* PeImage::OffsetToPointer(
+    ::std::size_t offset,
+    ::std::size_t count
+) const noexcept {
+  if (this->data_ == nullptr
+      || offset > this->size_
+      || count > this->size_ - offset) {
+    return nullptr;
+  }
+
+  return &this->data_[offset];
+}
+
+} // namespace mapi
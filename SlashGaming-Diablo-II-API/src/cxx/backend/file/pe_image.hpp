@@ -0,0 +1,145 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_BACKEND_FILE_PE_IMAGE_HPP_
+#define SGD2MAPI_CXX_BACKEND_FILE_PE_IMAGE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace mapi {
+
+/**
+ * A read-only view of a PE image's export table. The export index is
+ * built once on construction, after which lookups by name or ordinal do
+ * not scan the export table. The image bytes must outlive the PeImage.
+ */
+class PeImage {
+ public:
+  /**
+   * Specifies whether the bytes are laid out as a module loaded by the
+   * OS, where RVAs are offsets from the base, or as the file on disk,
+   * where RVAs are translated through the section table.
+   */
+  enum class Layout {
+    kMapped, kFile,
+  };
+
+  PeImage() noexcept;
+
+  PeImage(
+      const ::std::uint8_t* data,
+      ::std::size_t size,
+      Layout layout
+  );
+
+  /**
+   * Creates a PeImage from a module that is loaded in memory. The image
+   * size is read from the module's optional header.
+   */
+  static PeImage FromLoadedModule(::std::intptr_t base_address);
+
+  /**
+   * Returns the RVA of the export with the specified name, or 0 if the
+   * name is not exported or is forwarded to another library.
+   */
+  ::std::uint32_t FindExportByName(::std::string_view name) const noexcept;
+
+  /**
+   * Returns the RVA of the export with the specified ordinal, or 0 if the
+   * ordinal is not exported or is forwarded to another library.
+   */
+  ::std::uint32_t FindExportByOrdinal(
+      ::std::uint16_t ordinal
+  ) const noexcept;
+
+  /**
+   * Returns whether the headers and the export directory were read
+   * without going out of bounds.
+   */
+  constexpr bool is_valid() const noexcept {
+    return this->is_valid_;
+  }
+
+ private:
+  const ::std::uint8_t* data_;
+  ::std::size_t size_;
+  Layout layout_;
+  bool is_valid_;
+
+  ::std::size_t section_headers_offset_;
+  ::std::size_t section_count_;
+
+  ::std::uint32_t export_directory_rva_;
+  ::std::uint32_t export_directory_size_;
+
+  ::std::uint32_t ordinal_base_;
+  ::std::vector<::std::uint32_t> export_rvas_;
+  ::std::unordered_map<::std::string_view, ::std::uint32_t>
+      export_rvas_by_name_;
+
+  bool ReadHeaders();
+
+  bool ReadExportDirectory();
+
+  bool IsForwardedExport(::std::uint32_t rva) const noexcept;
+
+  const ::std::uint8_t* RvaToPointer(
+      ::std::uint32_t rva,
+      ::std::size_t count
+  ) const noexcept;
+
+  const ::std::uint8_t* OffsetToPointer(
+      ::std::size_t offset,
+      ::std::size_t count
+  ) const noexcept;
+};
+
+} // namespace mapi
+
+#endif // SGD2MAPI_CXX_BACKEND_FILE_PE_IMAGE_HPP_
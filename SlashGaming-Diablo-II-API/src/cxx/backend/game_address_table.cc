@@ -45,10 +45,13 @@
 
 #include "game_address_table.hpp"
 
+#include <windows.h>
 #include <cstddef>
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <string>
+#include <vector>
 
 #include <mdc/error/exit_on_error.hpp>
 #include <mdc/wchar_t/filew.h>
@@ -68,26 +71,60 @@ static const GameAddressTable& GetGameAddressTable() {
   return game_address_table;
 }
 
+// Resolved addresses are stored at the same index as their entry in the
+// game address table. A raw address of 0 marks an unresolved entry. The
+// slots are atomic because any thread may be the first to use an address.
+// Two threads may both locate the same entry, but they store the same
+// address.
+static ::std::vector<::std::atomic<GameAddress>>& GetResolvedGameAddresses() {
+  static ::std::vector<::std::atomic<GameAddress>> resolved_game_addresses(
+      GetGameAddressTable().size()
+  );
+
+  return resolved_game_addresses;
+}
+
+// DefaultLibrary enumerations are sequential, which the array lookup
+// relies on.
+static constexpr ::std::size_t kLoadedGameLibrariesCount =
+    static_cast<::std::size_t>(::d2::DefaultLibrary::kStorm) + 1;
+
+// The game never unloads its libraries, so a library is only checked
+// with GetModuleHandleW until it is first found loaded. The flags are
+// atomic because any thread may be the first to find a library loaded.
+static ::std::array<::std::atomic<bool>, kLoadedGameLibrariesCount>
+    loaded_game_libraries;
+
+static GameAddress ResolveGameAddressTableEntry(
+    const GameAddressTableEntry* entry
+) {
+  ::std::size_t entry_index = entry - GetGameAddressTable().entries();
+  ::std::atomic<GameAddress>& resolved_game_address =
+      GetResolvedGameAddresses()[entry_index];
+
+  GameAddress game_address =
+      resolved_game_address.load(::std::memory_order_acquire);
+
+  if (game_address.raw_address() == 0) {
+    game_address = entry->second.LocateGameAddress();
+    resolved_game_address.store(game_address, ::std::memory_order_release);
+  }
+
+  return game_address;
+}
+
 } // namespace
 
 GameAddress LoadGameAddress(
     ::d2::DefaultLibrary library,
     const char* address_name
 ) {
-  const GameAddressTable& game_address_table = GetGameAddressTable();
-
-  const GameAddressTableEntry* table = game_address_table.first;
-  std::size_t table_count = game_address_table.second;
-
-  ::std::pair search_range = ::std::equal_range(
-      &table[0],
-      &table[table_count],
-      ::std::make_tuple(library, address_name),
-      GameAddressTableEntryCompareKey()
+  const GameAddressTableEntry* entry = GetGameAddressTable().Find(
+      library,
+      address_name
   );
 
-  if (search_range.first == &table[table_count]
-      || search_range.first == search_range.second) {
+  if (entry == nullptr) {
     std::size_t address_name_wide_length = ::mdc::wide::DecodeAsciiLength(
         address_name
     );
@@ -115,7 +152,87 @@ GameAddress LoadGameAddress(
     return GameAddress::FromOffset(static_cast<d2::DefaultLibrary>(-1), 0);
   }
 
-  return search_range.first->second.LocateGameAddress();
+  return ResolveGameAddressTableEntry(entry);
+}
+
+bool HasGameAddress(::d2::DefaultLibrary library, const char* address_name) {
+  return GetGameAddressTable().Find(library, address_name) != nullptr;
+}
+
+void ResolveGameAddresses(::d2::DefaultLibrary library) {
+  const GameAddressTable& game_address_table = GetGameAddressTable();
+
+  const GameAddressTableEntry* table_begin = game_address_table.entries();
+  const GameAddressTableEntry* table_end =
+      table_begin + game_address_table.size();
+
+  // Entries are sorted by library first, so all entries for the library
+  // are in one contiguous range.
+  ::std::pair library_range = ::std::equal_range(
+      table_begin,
+      table_end,
+      library,
+      GameAddressTableEntryCompareLibrary()
+  );
+
+  for (const GameAddressTableEntry* entry = library_range.first;
+      entry != library_range.second;
+      entry += 1) {
+    ResolveGameAddressTableEntry(entry);
+  }
+}
+
+void ResolveGameAddresses() {
+  const GameAddressTable& game_address_table = GetGameAddressTable();
+
+  const GameAddressTableEntry* table_begin = game_address_table.entries();
+  const GameAddressTableEntry* table_end =
+      table_begin + game_address_table.size();
+
+  // Walk the table one library range at a time, and check each library
+  // once. Resolving an entry would otherwise load its library, including
+  // renderer libraries that the game never uses.
+  const GameAddressTableEntry* library_begin = table_begin;
+
+  while (library_begin != table_end) {
+    ::d2::DefaultLibrary library = ::std::get<0>(library_begin->first);
+
+    const GameAddressTableEntry* library_end = ::std::upper_bound(
+        library_begin,
+        table_end,
+        library,
+        GameAddressTableEntryCompareLibrary()
+    );
+
+    if (IsGameLibraryLoaded(library)) {
+      for (const GameAddressTableEntry* entry = library_begin;
+          entry != library_end;
+          entry += 1) {
+        ResolveGameAddressTableEntry(entry);
+      }
+    }
+
+    library_begin = library_end;
+  }
+}
+
+bool IsGameLibraryLoaded(::d2::DefaultLibrary library) {
+  ::std::atomic<bool>& is_loaded =
+      loaded_game_libraries[static_cast<::std::size_t>(library)];
+
+  if (is_loaded.load(::std::memory_order_relaxed)) {
+    return true;
+  }
+
+  const wchar_t* path = ::d2::default_library::GetPathWithRedirect(library);
+
+  if (GetModuleHandleW(path) == nullptr) {
+    return false;
+  }
+
+  is_loaded.store(true, ::std::memory_order_relaxed);
+
+  return true;
 }
 
 } // namespace mapi
@@ -51,11 +51,45 @@
 
 namespace mapi {
 
+/**
+ * Returns the address of the entry with the specified name. Each call
+ * hashes the name to find the entry, then atomically loads the entry's
+ * resolved address, locating it only if it is unresolved. Callers that
+ * use an address repeatedly should keep the returned address.
+ */
 GameAddress LoadGameAddress(
     ::d2::DefaultLibrary library,
     const char* address_name
 );
 
+/**
+ * Returns whether the running game version's address table has an entry
+ * with the specified name.
+ */
+bool HasGameAddress(::d2::DefaultLibrary library, const char* address_name);
+
+/**
+ * Resolves every entry in the running game version's address table that
+ * belongs to the specified library. Later calls to LoadGameAddress for
+ * those entries read the resolved address instead of locating it again.
+ */
+void ResolveGameAddresses(::d2::DefaultLibrary library);
+
+/**
+ * Resolves every entry in the running game version's address table whose
+ * library is already loaded. The entries of libraries that are not loaded
+ * are skipped, so that no library is loaded by this call.
+ */
+void ResolveGameAddresses();
+
+/**
+ * Returns whether the specified library is already loaded in the game
+ * process. Never loads the library. Until the library is first found
+ * loaded, each call costs a GetModuleHandleW, which takes the loader
+ * lock. After that, a call is one atomic load.
+ */
+bool IsGameLibraryLoaded(::d2::DefaultLibrary library);
+
 } // namespace mapi
 
 #endif // SGD2MAPI_CXX_BACKEND_GAME_ADDRESS_TABLE_HPP_
@@ -0,0 +1,244 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGMAPI_CXX_BACKEND_GAME_ADDRESS_TABLE_GAME_ADDRESS_HASH_INDEX_HPP_
+#define SGMAPI_CXX_BACKEND_GAME_ADDRESS_TABLE_GAME_ADDRESS_HASH_INDEX_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <string_view>
+#include <tuple>
+
+#include "../../../../include/cxx/default_game_library.hpp"
+
+namespace mapi {
+
+/**
+ * Returns the 32-bit FNV-1a hash of a game address table key.
+ */
+constexpr ::std::uint32_t HashGameAddressKey(
+    ::d2::DefaultLibrary library,
+    ::std::string_view address_name
+) noexcept {
+  constexpr ::std::uint32_t kFnvOffsetBasis = 0x811C9DC5;
+  constexpr ::std::uint32_t kFnvPrime = 0x01000193;
+
+  ::std::uint32_t hash = kFnvOffsetBasis;
+
+  hash ^= static_cast<::std::uint32_t>(library);
+  hash *= kFnvPrime;
+
+  for (char ch : address_name) {
+    hash ^= static_cast<::std::uint8_t>(ch);
+    hash *= kFnvPrime;
+  }
+
+  return hash;
+}
+
+/**
+ * Scrambles a key hash with a bucket's displacement seed. The finalizer
+ * is a bijection, so keys with distinct hashes never share a mixed value.
+ */
+constexpr ::std::uint32_t MixGameAddressHash(
+    ::std::uint32_t hash,
+    ::std::uint16_t seed
+) noexcept {
+  hash ^= seed;
+  hash ^= hash >> 16;
+  hash *= 0x85EBCA6B;
+  hash ^= hash >> 13;
+  hash *= 0xC2B2AE35;
+  hash ^= hash >> 16;
+
+  return hash;
+}
+
+/**
+ * A minimal perfect hash index over a game address table, built at
+ * compile time using hash and displace. Each key hashes into a bucket,
+ * and each bucket stores the seed that places all of its keys into
+ * unused slots. A slot maps back to the index of the entry in the table.
+ */
+template <::std::size_t Count>
+class GameAddressHashIndex {
+ public:
+  static_assert(Count > 0);
+
+  static constexpr ::std::size_t kEntryCount = Count;
+  static constexpr ::std::size_t kBucketCount = (Count / 2) + 1;
+
+  GameAddressHashIndex() = delete;
+
+  template <typename Entry>
+  explicit constexpr GameAddressHashIndex(
+      const ::std::array<Entry, Count>& table
+  ) noexcept
+      : seeds_(),
+        entry_indices_(),
+        is_valid_(false) {
+    ::std::array<::std::uint32_t, Count> hashes = {};
+
+    for (::std::size_t i = 0; i < Count; i += 1) {
+      const auto& [library, address_name] = table[i].first;
+      hashes[i] = HashGameAddressKey(library, address_name);
+    }
+
+    // Group the entry indices by bucket.
+    ::std::array<::std::size_t, kBucketCount + 1> bucket_starts = {};
+
+    for (::std::size_t i = 0; i < Count; i += 1) {
+      bucket_starts[(hashes[i] % kBucketCount) + 1] += 1;
+    }
+
+    ::std::size_t max_bucket_size = 0;
+
+    for (::std::size_t bucket = 0; bucket < kBucketCount; bucket += 1) {
+      ::std::size_t bucket_size = bucket_starts[bucket + 1];
+      if (bucket_size > max_bucket_size) {
+        max_bucket_size = bucket_size;
+      }
+
+      bucket_starts[bucket + 1] += bucket_starts[bucket];
+    }
+
+    ::std::array<::std::size_t, Count> bucket_members = {};
+    ::std::array<::std::size_t, kBucketCount> bucket_fill = {};
+
+    for (::std::size_t i = 0; i < Count; i += 1) {
+      ::std::size_t bucket = hashes[i] % kBucketCount;
+
+      bucket_members[bucket_starts[bucket] + bucket_fill[bucket]] = i;
+      bucket_fill[bucket] += 1;
+    }
+
+    // Place the largest buckets first, since they have the fewest seeds
+    // that fit.
+    ::std::array<bool, Count> is_slot_used = {};
+    ::std::array<::std::size_t, Count> candidate_slots = {};
+
+    for (::std::size_t bucket_size = max_bucket_size;
+        bucket_size > 0;
+        bucket_size -= 1) {
+      for (::std::size_t bucket = 0; bucket < kBucketCount; bucket += 1) {
+        ::std::size_t bucket_start = bucket_starts[bucket];
+
+        if (bucket_starts[bucket + 1] - bucket_start != bucket_size) {
+          continue;
+        }
+
+        bool is_placed = false;
+
+        for (::std::uint32_t seed = 0; seed <= 0xFFFF; seed += 1) {
+          is_placed = true;
+
+          for (::std::size_t i = 0; i < bucket_size; i += 1) {
+            ::std::size_t slot = MixGameAddressHash(
+                hashes[bucket_members[bucket_start + i]],
+                static_cast<::std::uint16_t>(seed)
+            ) % Count;
+
+            for (::std::size_t j = 0; j < i; j += 1) {
+              if (candidate_slots[j] == slot) {
+                is_placed = false;
+              }
+            }
+
+            if (!is_placed || is_slot_used[slot]) {
+              is_placed = false;
+              break;
+            }
+
+            candidate_slots[i] = slot;
+          }
+
+          if (is_placed) {
+            this->seeds_[bucket] = static_cast<::std::uint16_t>(seed);
+            break;
+          }
+        }
+
+        if (!is_placed) {
+          return;
+        }
+
+        for (::std::size_t i = 0; i < bucket_size; i += 1) {
+          is_slot_used[candidate_slots[i]] = true;
+          this->entry_indices_[candidate_slots[i]] =
+              static_cast<::std::uint16_t>(bucket_members[bucket_start + i]);
+        }
+      }
+    }
+
+    this->is_valid_ = true;
+  }
+
+  constexpr const ::std::array<::std::uint16_t, kBucketCount>&
+  seeds() const noexcept {
+    return this->seeds_;
+  }
+
+  constexpr const ::std::array<::std::uint16_t, Count>&
+  entry_indices() const noexcept {
+    return this->entry_indices_;
+  }
+
+  /**
+   * Returns whether every entry in the table was assigned a unique slot.
+   */
+  constexpr bool is_valid() const noexcept {
+    return this->is_valid_;
+  }
+
+ private:
+  ::std::array<::std::uint16_t, kBucketCount> seeds_;
+  ::std::array<::std::uint16_t, Count> entry_indices_;
+  bool is_valid_;
+};
+
+} // namespace mapi
+
+#endif // SGMAPI_CXX_BACKEND_GAME_ADDRESS_TABLE_GAME_ADDRESS_HASH_INDEX_HPP_
@@ -49,6 +49,7 @@
 #include <array>
 
 #include "../../../../include/cxx/game_version.hpp"
+#include "game_address_hash_index.hpp"
 #include "game_address_locator/game_address_locator.hpp"
 #include "game_address_locator/game_exported_name_locator.hpp"
 #include "game_address_locator/game_offset_locator.hpp"
@@ -69,6 +70,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_00(
+    kGameAddressTable_1_00
+);
+
+static_assert(kGameAddressHashIndex_1_00.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_01 =
     MAPI_GAME_ADDRESS_TABLE_1_01;
 
@@ -80,6 +87,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_01(
+    kGameAddressTable_1_01
+);
+
+static_assert(kGameAddressHashIndex_1_01.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_02 =
     MAPI_GAME_ADDRESS_TABLE_1_02;
 
@@ -91,6 +104,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_02(
+    kGameAddressTable_1_02
+);
+
+static_assert(kGameAddressHashIndex_1_02.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_03 =
     MAPI_GAME_ADDRESS_TABLE_1_03;
 
@@ -102,6 +121,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_03(
+    kGameAddressTable_1_03
+);
+
+static_assert(kGameAddressHashIndex_1_03.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_04B_C =
     MAPI_GAME_ADDRESS_TABLE_1_04B_AND_C;
 
@@ -113,6 +138,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_04B_C(
+    kGameAddressTable_1_04B_C
+);
+
+static_assert(kGameAddressHashIndex_1_04B_C.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_05 =
     MAPI_GAME_ADDRESS_TABLE_1_05;
 
@@ -124,6 +155,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_05(
+    kGameAddressTable_1_05
+);
+
+static_assert(kGameAddressHashIndex_1_05.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_05B =
     MAPI_GAME_ADDRESS_TABLE_1_05B;
 
@@ -135,6 +172,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_05B(
+    kGameAddressTable_1_05B
+);
+
+static_assert(kGameAddressHashIndex_1_05B.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_06 =
     MAPI_GAME_ADDRESS_TABLE_1_06;
 
@@ -146,6 +189,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_06(
+    kGameAddressTable_1_06
+);
+
+static_assert(kGameAddressHashIndex_1_06.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_06B =
     MAPI_GAME_ADDRESS_TABLE_1_06B;
 
@@ -157,6 +206,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_06B(
+    kGameAddressTable_1_06B
+);
+
+static_assert(kGameAddressHashIndex_1_06B.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_07Beta =
     MAPI_GAME_ADDRESS_TABLE_1_07_BETA;
 
@@ -168,6 +223,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_07Beta(
+    kGameAddressTable_1_07Beta
+);
+
+static_assert(kGameAddressHashIndex_1_07Beta.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_07 =
     MAPI_GAME_ADDRESS_TABLE_1_07;
 
@@ -179,6 +240,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_07(
+    kGameAddressTable_1_07
+);
+
+static_assert(kGameAddressHashIndex_1_07.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_08 =
     MAPI_GAME_ADDRESS_TABLE_1_08;
 
@@ -190,6 +257,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_08(
+    kGameAddressTable_1_08
+);
+
+static_assert(kGameAddressHashIndex_1_08.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_09 =
     MAPI_GAME_ADDRESS_TABLE_1_09;
 
@@ -201,6 +274,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_09(
+    kGameAddressTable_1_09
+);
+
+static_assert(kGameAddressHashIndex_1_09.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_09B =
     MAPI_GAME_ADDRESS_TABLE_1_09B;
 
@@ -212,6 +291,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_09B(
+    kGameAddressTable_1_09B
+);
+
+static_assert(kGameAddressHashIndex_1_09B.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_09D =
     MAPI_GAME_ADDRESS_TABLE_1_09D;
 
@@ -223,6 +308,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_09D(
+    kGameAddressTable_1_09D
+);
+
+static_assert(kGameAddressHashIndex_1_09D.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_10Beta =
     MAPI_GAME_ADDRESS_TABLE_1_10_BETA;
 
@@ -234,6 +325,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_10Beta(
+    kGameAddressTable_1_10Beta
+);
+
+static_assert(kGameAddressHashIndex_1_10Beta.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_10SBeta =
     MAPI_GAME_ADDRESS_TABLE_1_10S_BETA;
 
@@ -245,6 +342,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_10SBeta(
+    kGameAddressTable_1_10SBeta
+);
+
+static_assert(kGameAddressHashIndex_1_10SBeta.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_10 =
     MAPI_GAME_ADDRESS_TABLE_1_10;
 
@@ -256,6 +359,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_10(
+    kGameAddressTable_1_10
+);
+
+static_assert(kGameAddressHashIndex_1_10.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_11 =
     MAPI_GAME_ADDRESS_TABLE_1_11;
 
@@ -267,6 +376,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_11(
+    kGameAddressTable_1_11
+);
+
+static_assert(kGameAddressHashIndex_1_11.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_11B =
     MAPI_GAME_ADDRESS_TABLE_1_11B;
 
@@ -278,6 +393,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_11B(
+    kGameAddressTable_1_11B
+);
+
+static_assert(kGameAddressHashIndex_1_11B.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_12A =
     MAPI_GAME_ADDRESS_TABLE_1_12A;
 
@@ -289,6 +410,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_12A(
+    kGameAddressTable_1_12A
+);
+
+static_assert(kGameAddressHashIndex_1_12A.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_13ABeta =
     MAPI_GAME_ADDRESS_TABLE_1_13A_BETA;
 
@@ -300,6 +427,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_13ABeta(
+    kGameAddressTable_1_13ABeta
+);
+
+static_assert(kGameAddressHashIndex_1_13ABeta.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_13C =
     MAPI_GAME_ADDRESS_TABLE_1_13C;
 
@@ -311,6 +444,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_13C(
+    kGameAddressTable_1_13C
+);
+
+static_assert(kGameAddressHashIndex_1_13C.is_valid());
+
 static constexpr const std::array kGameAddressTable_1_13D =
     MAPI_GAME_ADDRESS_TABLE_1_13D;
 
@@ -322,6 +461,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_1_13D(
+    kGameAddressTable_1_13D
+);
+
+static_assert(kGameAddressHashIndex_1_13D.is_valid());
+
 static constexpr const std::array kGameAddressTable_Classic1_14A =
     MAPI_GAME_ADDRESS_TABLE_CLASSIC_1_14A;
 
@@ -333,6 +478,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_Classic1_14A(
+    kGameAddressTable_Classic1_14A
+);
+
+static_assert(kGameAddressHashIndex_Classic1_14A.is_valid());
+
 static constexpr const std::array kGameAddressTable_Lod1_14A =
     MAPI_GAME_ADDRESS_TABLE_LOD_1_14A;
 
@@ -344,6 +495,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_Lod1_14A(
+    kGameAddressTable_Lod1_14A
+);
+
+static_assert(kGameAddressHashIndex_Lod1_14A.is_valid());
+
 static constexpr const std::array kGameAddressTable_Classic1_14B =
     MAPI_GAME_ADDRESS_TABLE_CLASSIC_1_14B;
 
@@ -355,6 +512,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_Classic1_14B(
+    kGameAddressTable_Classic1_14B
+);
+
+static_assert(kGameAddressHashIndex_Classic1_14B.is_valid());
+
 static constexpr const std::array kGameAddressTable_Lod1_14B =
     MAPI_GAME_ADDRESS_TABLE_LOD_1_14B;
 
@@ -366,6 +529,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_Lod1_14B(
+    kGameAddressTable_Lod1_14B
+);
+
+static_assert(kGameAddressHashIndex_Lod1_14B.is_valid());
+
 static constexpr const std::array kGameAddressTable_Classic1_14C =
     MAPI_GAME_ADDRESS_TABLE_CLASSIC_1_14C;
 
@@ -377,6 +546,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_Classic1_14C(
+    kGameAddressTable_Classic1_14C
+);
+
+static_assert(kGameAddressHashIndex_Classic1_14C.is_valid());
+
 static constexpr const std::array kGameAddressTable_Lod1_14C =
     MAPI_GAME_ADDRESS_TABLE_LOD_1_14C;
 
@@ -388,6 +563,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_Lod1_14C(
+    kGameAddressTable_Lod1_14C
+);
+
+static_assert(kGameAddressHashIndex_Lod1_14C.is_valid());
+
 static constexpr const std::array kGameAddressTable_Classic1_14D =
     MAPI_GAME_ADDRESS_TABLE_CLASSIC_1_14D;
 
@@ -399,6 +580,12 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_Classic1_14D(
+    kGameAddressTable_Classic1_14D
+);
+
+static_assert(kGameAddressHashIndex_Classic1_14D.is_valid());
+
 static constexpr const std::array kGameAddressTable_Lod1_14D =
     MAPI_GAME_ADDRESS_TABLE_LOD_1_14D;
 
@@ -410,234 +597,262 @@ static_assert(
     )
 );
 
+static constexpr const GameAddressHashIndex kGameAddressHashIndex_Lod1_14D(
+    kGameAddressTable_Lod1_14D
+);
+
+static_assert(kGameAddressHashIndex_Lod1_14D.is_valid());
+
 } // namespace
 
-GameAddressTable LoadGameAddressTable() {
-  switch (::d2::game_version::GetRunning()) {
+const GameAddressTableEntry* GameAddressTable::Find(
+    ::d2::DefaultLibrary library,
+    ::std::string_view address_name
+) const noexcept {
+  ::std::uint32_t hash = HashGameAddressKey(library, address_name);
+  ::std::uint16_t seed = this->seeds_[hash % this->bucket_count_];
+
+  ::std::size_t slot = MixGameAddressHash(hash, seed) % this->entries_count_;
+  const GameAddressTableEntry* entry =
+      &this->entries_[this->entry_indices_[slot]];
+
+  if (entry->first != ::std::make_tuple(library, address_name)) {
+    return nullptr;
+  }
+
+  return entry;
+}
+
+GameAddressTable GetGameAddressTable(::d2::GameVersion game_version) {
+  switch (game_version) {
     case d2::GameVersion::k1_00: {
-      return ::std::pair(
-          kGameAddressTable_1_00.data(),
-          kGameAddressTable_1_00.size()
+      return GameAddressTable(
+          kGameAddressTable_1_00,
+          kGameAddressHashIndex_1_00
       );
     }
 
     case d2::GameVersion::k1_01: {
-      return ::std::pair(
-          kGameAddressTable_1_01.data(),
-          kGameAddressTable_1_01.size()
+      return GameAddressTable(
+          kGameAddressTable_1_01,
+          kGameAddressHashIndex_1_01
       );
     }
 
     case d2::GameVersion::k1_02: {
-      return ::std::pair(
-          kGameAddressTable_1_02.data(),
-          kGameAddressTable_1_02.size()
+      return GameAddressTable(
+          kGameAddressTable_1_02,
+          kGameAddressHashIndex_1_02
       );
     }
 
     case d2::GameVersion::k1_03: {
-      return ::std::pair(
-          kGameAddressTable_1_03.data(),
-          kGameAddressTable_1_03.size()
+      return GameAddressTable(
+          kGameAddressTable_1_03,
+          kGameAddressHashIndex_1_03
       );
     }
 
     case d2::GameVersion::k1_04B_C: {
-      return ::std::pair(
-          kGameAddressTable_1_04B_C.data(),
-          kGameAddressTable_1_04B_C.size()
+      return GameAddressTable(
+          kGameAddressTable_1_04B_C,
+          kGameAddressHashIndex_1_04B_C
       );
     }
 
     case d2::GameVersion::k1_05: {
-      return ::std::pair(
-          kGameAddressTable_1_05.data(),
-          kGameAddressTable_1_05.size()
+      return GameAddressTable(
+          kGameAddressTable_1_05,
+          kGameAddressHashIndex_1_05
       );
     }
 
     case d2::GameVersion::k1_05B: {
-      return ::std::pair(
-          kGameAddressTable_1_05B.data(),
-          kGameAddressTable_1_05B.size()
+      return GameAddressTable(
+          kGameAddressTable_1_05B,
+          kGameAddressHashIndex_1_05B
       );
     }
 
     case d2::GameVersion::k1_06: {
-      return ::std::pair(
-          kGameAddressTable_1_06.data(),
-          kGameAddressTable_1_06.size()
+      return GameAddressTable(
+          kGameAddressTable_1_06,
+          kGameAddressHashIndex_1_06
       );
     }
 
     case d2::GameVersion::k1_06B: {
-      return ::std::pair(
-          kGameAddressTable_1_06B.data(),
-          kGameAddressTable_1_06B.size()
+      return GameAddressTable(
+          kGameAddressTable_1_06B,
+          kGameAddressHashIndex_1_06B
       );
     }
 
     case d2::GameVersion::k1_07Beta: {
-      return ::std::pair(
-          kGameAddressTable_1_07Beta.data(),
-          kGameAddressTable_1_07Beta.size()
+      return GameAddressTable(
+          kGameAddressTable_1_07Beta,
+          kGameAddressHashIndex_1_07Beta
       );
     }
 
     case d2::GameVersion::k1_07: {
-      return ::std::pair(
-          kGameAddressTable_1_07.data(),
-          kGameAddressTable_1_07.size()
+      return GameAddressTable(
+          kGameAddressTable_1_07,
+          kGameAddressHashIndex_1_07
       );
     }
 
     case d2::GameVersion::k1_08: {
-      return ::std::pair(
-          kGameAddressTable_1_08.data(),
-          kGameAddressTable_1_08.size()
+      return GameAddressTable(
+          kGameAddressTable_1_08,
+          kGameAddressHashIndex_1_08
       );
     }
 
     case d2::GameVersion::k1_09: {
-      return ::std::pair(
-          kGameAddressTable_1_09.data(),
-          kGameAddressTable_1_09.size()
+      return GameAddressTable(
+          kGameAddressTable_1_09,
+          kGameAddressHashIndex_1_09
       );
     }
 
     case d2::GameVersion::k1_09B: {
-      return ::std::pair(
-          kGameAddressTable_1_09B.data(),
-          kGameAddressTable_1_09B.size()
+      return GameAddressTable(
+          kGameAddressTable_1_09B,
+          kGameAddressHashIndex_1_09B
       );
     }
 
     case d2::GameVersion::k1_09D: {
-      return ::std::pair(
-          kGameAddressTable_1_09D.data(),
-          kGameAddressTable_1_09D.size()
+      return GameAddressTable(
+          kGameAddressTable_1_09D,
+          kGameAddressHashIndex_1_09D
       );
     }
 
     case d2::GameVersion::k1_10Beta: {
-      return ::std::pair(
-          kGameAddressTable_1_10Beta.data(),
-          kGameAddressTable_1_10Beta.size()
+      return GameAddressTable(
+          kGameAddressTable_1_10Beta,
+          kGameAddressHashIndex_1_10Beta
       );
     }
 
     case d2::GameVersion::k1_10SBeta: {
-      return ::std::pair(
-          kGameAddressTable_1_10SBeta.data(),
-          kGameAddressTable_1_10SBeta.size()
+      return GameAddressTable(
+          kGameAddressTable_1_10SBeta,
+          kGameAddressHashIndex_1_10SBeta
       );
     }
 
     case d2::GameVersion::k1_10: {
-      return ::std::pair(
-          kGameAddressTable_1_10.data(),
-          kGameAddressTable_1_10.size()
+      return GameAddressTable(
+          kGameAddressTable_1_10,
+          kGameAddressHashIndex_1_10
       );
     }
 
     case d2::GameVersion::k1_11: {
-      return ::std::pair(
-          kGameAddressTable_1_11.data(),
-          kGameAddressTable_1_11.size()
+      return GameAddressTable(
+          kGameAddressTable_1_11,
+          kGameAddressHashIndex_1_11
       );
     }
 
     case d2::GameVersion::k1_11B: {
-      return ::std::pair(
-          kGameAddressTable_1_11B.data(),
-          kGameAddressTable_1_11B.size()
+      return GameAddressTable(
+          kGameAddressTable_1_11B,
+          kGameAddressHashIndex_1_11B
       );
     }
 
     case d2::GameVersion::k1_12A: {
-      return ::std::pair(
-          kGameAddressTable_1_12A.data(),
-          kGameAddressTable_1_12A.size()
+      return GameAddressTable(
+          kGameAddressTable_1_12A,
+          kGameAddressHashIndex_1_12A
       );
     }
 
     case d2::GameVersion::k1_13ABeta: {
-      return ::std::pair(
-          kGameAddressTable_1_13ABeta.data(),
-          kGameAddressTable_1_13ABeta.size()
+      return GameAddressTable(
+          kGameAddressTable_1_13ABeta,
+          kGameAddressHashIndex_1_13ABeta
       );
     }
 
     case d2::GameVersion::k1_13C: {
-      return ::std::pair(
-          kGameAddressTable_1_13C.data(),
-          kGameAddressTable_1_13C.size()
+      return GameAddressTable(
+          kGameAddressTable_1_13C,
+          kGameAddressHashIndex_1_13C
       );
     }
 
     case d2::GameVersion::k1_13D: {
-      return ::std::pair(
-          kGameAddressTable_1_13D.data(),
-          kGameAddressTable_1_13D.size()
+      return GameAddressTable(
+          kGameAddressTable_1_13D,
+          kGameAddressHashIndex_1_13D
       );
     }
 
     case d2::GameVersion::kClassic1_14A: {
-      return ::std::pair(
-          kGameAddressTable_Classic1_14A.data(),
-          kGameAddressTable_Classic1_14A.size()
+      return GameAddressTable(
+          kGameAddressTable_Classic1_14A,
+          kGameAddressHashIndex_Classic1_14A
       );
     }
 
     case d2::GameVersion::kLod1_14A: {
-      return ::std::pair(
-          kGameAddressTable_Lod1_14A.data(),
-          kGameAddressTable_Lod1_14A.size()
+      return GameAddressTable(
+          kGameAddressTable_Lod1_14A,
+          kGameAddressHashIndex_Lod1_14A
       );
     }
 
     case d2::GameVersion::kClassic1_14B: {
-      return ::std::pair(
-          kGameAddressTable_Classic1_14B.data(),
-          kGameAddressTable_Classic1_14B.size()
+      return GameAddressTable(
+          kGameAddressTable_Classic1_14B,
+          kGameAddressHashIndex_Classic1_14B
       );
     }
 
     case d2::GameVersion::kLod1_14B: {
-      return ::std::pair(
-          kGameAddressTable_Lod1_14B.data(),
-          kGameAddressTable_Lod1_14B.size()
+      return GameAddressTable(
+          kGameAddressTable_Lod1_14B,
+          kGameAddressHashIndex_Lod1_14B
       );
     }
 
     case d2::GameVersion::kClassic1_14C: {
-      return ::std::pair(
-          kGameAddressTable_Classic1_14C.data(),
-          kGameAddressTable_Classic1_14C.size()
+      return GameAddressTable(
+          kGameAddressTable_Classic1_14C,
+          kGameAddressHashIndex_Classic1_14C
       );
     }
 
     case d2::GameVersion::kLod1_14C: {
-      return ::std::pair(
-          kGameAddressTable_Lod1_14C.data(),
-          kGameAddressTable_Lod1_14C.size()
+      return GameAddressTable(
+          kGameAddressTable_Lod1_14C,
+          kGameAddressHashIndex_Lod1_14C
       );
     }
 
     case d2::GameVersion::kClassic1_14D: {
-      return ::std::pair(
-          kGameAddressTable_Classic1_14D.data(),
-          kGameAddressTable_Classic1_14D.size()
+      return GameAddressTable(
+          kGameAddressTable_Classic1_14D,
+          kGameAddressHashIndex_Classic1_14D
       );
     }
 
     case d2::GameVersion::kLod1_14D: {
-      return ::std::pair(
-          kGameAddressTable_Lod1_14D.data(),
-          kGameAddressTable_Lod1_14D.size()
+      return GameAddressTable(
+          kGameAddressTable_Lod1_14D,
+          kGameAddressHashIndex_Lod1_14D
       );
     }
   }
 }
 
+GameAddressTable LoadGameAddressTable() {
+  return GetGameAddressTable(::d2::game_version::GetRunning());
+}
+
 } // namespace mapi
@@ -46,12 +46,17 @@
 #ifndef SGMAPI_CXX_BACKEND_GAME_ADDRESS_TABLE_GAME_ADDRESS_TABLE_IMPL_HPP_
 #define SGMAPI_CXX_BACKEND_GAME_ADDRESS_TABLE_GAME_ADDRESS_TABLE_IMPL_HPP_
 
+#include <cstddef>
+#include <cstdint>
+#include <array>
 #include <string_view>
 #include <tuple>
 #include <utility>
 #include <variant>
 
 #include "../../../../include/cxx/default_game_library.hpp"
+#include "../../../../include/cxx/game_version.hpp"
+#include "game_address_hash_index.hpp"
 #include "game_address_locator/game_address_locator.hpp"
 
 namespace mapi {
@@ -84,10 +89,72 @@ struct GameAddressTableEntryCompareKey {
   }
 };
 
-using GameAddressTable = ::std::pair<
-    const GameAddressTableEntry*,
-    std::size_t
->;
+struct GameAddressTableEntryCompareLibrary {
+  constexpr bool operator()(
+      ::d2::DefaultLibrary library,
+      const GameAddressTableEntry& entry
+  ) const noexcept {
+    return library < ::std::get<0>(entry.first);
+  }
+
+  constexpr bool operator()(
+      const GameAddressTableEntry& entry,
+      ::d2::DefaultLibrary library
+  ) const noexcept {
+    return ::std::get<0>(entry.first) < library;
+  }
+};
+
+/**
+ * A view of a version's game address table and its compile-time perfect
+ * hash index.
+ */
+class GameAddressTable {
+ public:
+  GameAddressTable() = delete;
+
+  template <std::size_t Count>
+  constexpr GameAddressTable(
+      const ::std::array<GameAddressTableEntry, Count>& entries,
+      const GameAddressHashIndex<Count>& hash_index
+  ) noexcept
+      : entries_(entries.data()),
+        entries_count_(Count),
+        seeds_(hash_index.seeds().data()),
+        bucket_count_(GameAddressHashIndex<Count>::kBucketCount),
+        entry_indices_(hash_index.entry_indices().data()) {
+  }
+
+  /**
+   * Returns the entry with the specified key, or nullptr if the table does
+   * not contain the key.
+   */
+  const GameAddressTableEntry* Find(
+      ::d2::DefaultLibrary library,
+      ::std::string_view address_name
+  ) const noexcept;
+
+  constexpr const GameAddressTableEntry* entries() const noexcept {
+    return this->entries_;
+  }
+
+  constexpr std::size_t size() const noexcept {
+    return this->entries_count_;
+  }
+
+ private:
+  const GameAddressTableEntry* entries_;
+  std::size_t entries_count_;
+  const ::std::uint16_t* seeds_;
+  std::size_t bucket_count_;
+  const ::std::uint16_t* entry_indices_;
+};
+
+/**
+ * Returns the game address table of the specified game version. The
+ * beta versions have no table.
+ */
+GameAddressTable GetGameAddressTable(::d2::GameVersion game_version);
 
 GameAddressTable LoadGameAddressTable();
 
@@ -0,0 +1,70 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Spellings of the x86-32 calling conventions that every supported
+ * compiler accepts. MSVC and MinGW have keywords for them. GCC and Clang
+ * targeting other systems only have attributes, which lets the calls be
+ * tested on x86-32 Linux.
+ */
+
+#ifndef SGMAPI_CXX_BACKEND_GAME_FUNCTION_CALLING_CONVENTION_HPP_
+#define SGMAPI_CXX_BACKEND_GAME_FUNCTION_CALLING_CONVENTION_HPP_
+
+#if defined(_WIN32)
+
+#define MAPI_STDCALL __stdcall
+#define MAPI_FASTCALL __fastcall
+#define MAPI_NAKED __declspec(naked)
+
+#else
+
+#define MAPI_STDCALL __attribute__((stdcall))
+#define MAPI_FASTCALL __attribute__((fastcall))
+#define MAPI_NAKED __attribute__((naked))
+
+#endif
+
+#endif // SGMAPI_CXX_BACKEND_GAME_FUNCTION_CALLING_CONVENTION_HPP_
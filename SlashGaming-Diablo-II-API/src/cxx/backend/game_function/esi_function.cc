@@ -49,53 +49,27 @@
 
 namespace mapi {
 
-__declspec(naked) void* __cdecl CallEsiFunction_Impl(
-    std::intptr_t func_ptr,
-    int num_params,
-    ...
+MAPI_NAKED void MAPI_FASTCALL CallEsiFunction_Thunk(
+    EsiCallFrame* frame,
+    std::intptr_t esi_value
 ) {
-  ASM_X86(push ebp);
-  ASM_X86(mov ebp, esp);
+  // Save esi, ebx and the return address into the frame in ecx. This pops
+  // the return address, so the stack arguments are in place for the call.
+  ASM_X86(mov dword ptr [ecx + 4], esi);
+  ASM_X86(mov dword ptr [ecx + 8], ebx);
+  ASM_X86(pop dword ptr [ecx + 12]);
 
-  ASM_X86(push esi);
-  ASM_X86(push ecx);
-  ASM_X86(push edx);
-
-  // Push all the stack arguments.
-
-  // Load num_params into ecx.
-  ASM_X86(mov ecx, dword ptr [ebp + 12]);
-
-  // Load pointer of num_params into eax, which will be used to get the
-  // pointer of the parameters after it.
-  ASM_X86(lea eax, dword ptr [ebp + 12]);
-  ASM_X86(lea eax, dword ptr [eax + ecx * 4]);
-ASM_X86_LABEL(CallEsiFunction_PushStackArgsLoop);
-  ASM_X86(cmp ecx, 2);
-  ASM_X86(jl CallEsiFunction_PushStackArgsLoopEnd);
-
-  ASM_X86(push dword ptr [eax]);
-  ASM_X86(sub ecx, 1);
-  ASM_X86(sub eax, 4);
-  ASM_X86(jmp CallEsiFunction_PushStackArgsLoop);
-ASM_X86_LABEL(CallEsiFunction_PushStackArgsLoopEnd);
-
-  // We do not conditionally branch when setting the esi register,
-  // because it incurs additional cost (in readability and execution)
-  // with no realistic benefit. the fact that if the called function
-  // has no parameters, the register values are overriden anyways.
-
-  // Set first parameter.
-  ASM_X86(mov esi, dword ptr [ebp + 16]);
+  // ebx is preserved by the called function, so it keeps the frame.
+  ASM_X86(mov ebx, ecx);
+  ASM_X86(mov esi, edx);
 
   // Call the function.
-  ASM_X86(call dword ptr [ebp + 8]);
+  ASM_X86(call dword ptr [ebx]);
 
-  ASM_X86(pop edx);
-  ASM_X86(pop ecx);
-  ASM_X86(pop esi);
+  ASM_X86(mov esi, dword ptr [ebx + 4]);
+  ASM_X86(push dword ptr [ebx + 12]);
+  ASM_X86(mov ebx, dword ptr [ebx + 8]);
 
-  ASM_X86(leave);
   ASM_X86(ret);
 }
 
@@ -48,20 +48,62 @@
 
 #include <cstdint>
 
+#include "calling_convention.hpp"
+#include "function_argument.hpp"
+
 namespace mapi {
 
-void* __cdecl CallEsiFunction_Impl(
-    std::intptr_t func_ptr,
-    int num_params,
-    ...
+/**
+ * The state that CallEsiFunction_Thunk preserves across the call, stored
+ * in the caller's frame so that the thunk does not need to know how many
+ * stack arguments there are.
+ */
+struct EsiCallFrame {
+  std::intptr_t func_ptr;
+  std::intptr_t saved_esi;
+  std::intptr_t saved_ebx;
+  std::intptr_t return_address;
+};
+
+/**
+ * Calls frame->func_ptr with esi set to esi_value, leaving any stack
+ * arguments in place. The called function must clean up its stack
+ * arguments, since the thunk does not know how many there are.
+ */
+void MAPI_FASTCALL CallEsiFunction_Thunk(
+    EsiCallFrame* frame,
+    std::intptr_t esi_value
 );
 
-template <typename ...Args>
-void* CallEsiFunction(
+template <typename Ret, typename Esi, typename ...Args>
+inline Ret CallEsiFunction(
     std::intptr_t func_ptr,
+    Esi esi_arg,
     Args... args
 ) {
-  return CallEsiFunction_Impl(func_ptr, sizeof...(args), args...);
+  // The thunk returns to the caller with a plain ret, so stack arguments
+  // are only removed if the game function cleans them up. None of the
+  // game's esi functions take stack arguments, and the ones that might
+  // must be checked before this is relaxed.
+  static_assert(
+      sizeof...(Args) == 0,
+      "CallEsiFunction does not support stack arguments."
+  );
+
+  using ThunkType = Ret (MAPI_FASTCALL*)(
+      EsiCallFrame*,
+      FunctionArgument_t<Esi>,
+      FunctionArgument_t<Args>...
+  );
+
+  EsiCallFrame frame;
+  frame.func_ptr = func_ptr;
+
+  return reinterpret_cast<ThunkType>(&CallEsiFunction_Thunk)(
+      &frame,
+      esi_arg,
+      args...
+  );
 }
 
 } // namespace mapi
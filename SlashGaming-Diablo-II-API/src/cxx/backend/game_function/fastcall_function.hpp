@@ -48,20 +48,19 @@
 
 #include <cstdint>
 
-namespace mapi {
+#include "calling_convention.hpp"
+#include "function_argument.hpp"
 
-void* __cdecl CallFastcallFunction_Impl(
-    std::intptr_t func_ptr,
-    int num_params,
-    ...
-);
+namespace mapi {
 
-template <typename ...Args>
-void* CallFastcallFunction(
+template <typename Ret, typename ...Args>
+inline Ret CallFastcallFunction(
     std::intptr_t func_ptr,
     Args... args
 ) {
-  return CallFastcallFunction_Impl(func_ptr, sizeof...(args), args...);
+  using FuncType = Ret (MAPI_FASTCALL*)(FunctionArgument_t<Args>...);
+
+  return reinterpret_cast<FuncType>(func_ptr)(args...);
 }
 
 } // namespace mapi
@@ -48,20 +48,19 @@
 
 #include <cstdint>
 
-namespace mapi {
+#include "calling_convention.hpp"
+#include "function_argument.hpp"
 
-void* __cdecl CallStdcallFunction_Impl(
-    std::intptr_t func_ptr,
-    int num_params,
-    ...
-);
+namespace mapi {
 
-template <typename ...Args>
-void* CallStdcallFunction(
+template <typename Ret, typename ...Args>
+inline Ret CallStdcallFunction(
     std::intptr_t func_ptr,
     Args... args
 ) {
-  return CallStdcallFunction_Impl(func_ptr, sizeof...(args), args...);
+  using FuncType = Ret (MAPI_STDCALL*)(FunctionArgument_t<Args>...);
+
+  return reinterpret_cast<FuncType>(func_ptr)(args...);
 }
 
 } // namespace mapi
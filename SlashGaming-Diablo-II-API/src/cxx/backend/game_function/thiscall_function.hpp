@@ -48,20 +48,27 @@
 
 #include <cstdint>
 
-namespace mapi {
+#include "calling_convention.hpp"
+#include "function_argument.hpp"
 
-void* __cdecl CallThiscallFunction_Impl(
-    std::intptr_t func_ptr,
-    int num_params,
-    ...
-);
+namespace mapi {
 
-template <typename ...Args>
-void* CallThiscallFunction(
+template <typename Ret, typename This, typename ...Args>
+inline Ret CallThiscallFunction(
     std::intptr_t func_ptr,
+    This this_arg,
     Args... args
 ) {
-  return CallThiscallFunction_Impl(func_ptr, sizeof...(args), args...);
+  // MSVC only allows __thiscall on member functions. A __fastcall function
+  // with an unused second parameter passes the first parameter in ecx and
+  // the rest on the stack, the same as __thiscall.
+  using FuncType = Ret (MAPI_FASTCALL*)(
+      FunctionArgument_t<This>,
+      std::intptr_t,
+      FunctionArgument_t<Args>...
+  );
+
+  return reinterpret_cast<FuncType>(func_ptr)(this_arg, 0, args...);
 }
 
 } // namespace mapi
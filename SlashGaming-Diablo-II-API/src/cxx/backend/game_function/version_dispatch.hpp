@@ -0,0 +1,170 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGMAPI_CXX_BACKEND_GAME_FUNCTION_VERSION_DISPATCH_HPP_
+#define SGMAPI_CXX_BACKEND_GAME_FUNCTION_VERSION_DISPATCH_HPP_
+
+#include <cstddef>
+#include <atomic>
+#include <utility>
+
+#include <mdc/error/exit_on_error.hpp>
+#include <mdc/wchar_t/filew.h>
+#include "../../../../include/cxx/game_version.hpp"
+
+namespace mapi {
+
+/**
+ * An implementation of a generic function, and the inclusive range of
+ * game versions that it is used for.
+ */
+template <typename Function>
+struct VersionedFunction {
+  ::d2::GameVersion first_version;
+  ::d2::GameVersion last_version;
+  Function* function;
+};
+
+/**
+ * Returns whether every game version, from the first to the last, is in
+ * the range of at least one of the functions.
+ */
+template <typename Function, std::size_t kCount>
+constexpr bool CoversAllGameVersions(
+    const VersionedFunction<Function> (&functions)[kCount]
+) noexcept {
+  for (int i = static_cast<int>(::d2::GameVersion::kBeta1_02);
+      i <= static_cast<int>(::d2::GameVersion::kLod1_14D);
+      i += 1) {
+    ::d2::GameVersion game_version = static_cast<::d2::GameVersion>(i);
+
+    bool is_covered = false;
+    for (const VersionedFunction<Function>& entry : functions) {
+      if (game_version >= entry.first_version
+          && game_version <= entry.last_version) {
+        is_covered = true;
+        break;
+      }
+    }
+
+    if (!is_covered) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Forwards calls of a generic function to the implementation for the
+ * running game version. The implementation is selected on the first
+ * call; every later call is a single indirect call, without querying the
+ * running game version or comparing it.
+ *
+ * Table declares the generic signature as Function, and the
+ * implementations as a constexpr array of VersionedFunction named
+ * kFunctions. The first entry whose range holds the running game
+ * version is selected, so the entries read like the if-else chain that
+ * they replace. Every game version must be in at least one range; this
+ * is checked at compile time.
+ */
+template <typename Table, typename Function = typename Table::Function>
+class VersionDispatch;
+
+template <typename Table, typename Ret, typename ...Args>
+class VersionDispatch<Table, Ret(Args...)> {
+ public:
+  using Function = Ret(Args...);
+
+  static_assert(
+      CoversAllGameVersions(Table::kFunctions),
+      "kFunctions must cover every game version."
+  );
+
+  static Ret Call(Args... args) {
+    // The pointer is only ever set to a function of the DLL, so relaxed
+    // ordering is enough, and it compiles to a plain load on x86.
+    Function* function = function_.load(std::memory_order_relaxed);
+
+    return function(std::forward<Args>(args)...);
+  }
+
+  /**
+   * Returns the implementation used for the specified game version.
+   */
+  static Function* Select(::d2::GameVersion game_version) {
+    for (const VersionedFunction<Function>& entry : Table::kFunctions) {
+      if (game_version >= entry.first_version
+          && game_version <= entry.last_version) {
+        return entry.function;
+      }
+    }
+
+    ::mdc::error::ExitOnGeneralError(
+        L"Error",
+        L"No implementation for game version with value %d.",
+        __FILEW__,
+        __LINE__,
+        static_cast<int>(game_version)
+    );
+
+    return nullptr;
+  }
+
+ private:
+  static Ret ResolveAndCall(Args... args) {
+    Function* function = Select(::d2::game_version::GetRunning());
+    function_.store(function, std::memory_order_relaxed);
+
+    return function(std::forward<Args>(args)...);
+  }
+
+  static constinit inline std::atomic<Function*> function_ =
+      &ResolveAndCall;
+};
+
+} // namespace mapi
+
+#endif // SGMAPI_CXX_BACKEND_GAME_FUNCTION_VERSION_DISPATCH_HPP_
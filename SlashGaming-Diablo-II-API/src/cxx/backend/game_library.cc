@@ -57,12 +57,14 @@ GameLibrary::GameLibrary(
     ::std::wstring path
 )
     : path_(std::move(path)),
-      base_address_(this->LoadGameLibraryBaseAddress(this->path().c_str())) {
+      base_address_(this->LoadGameLibraryBaseAddress(this->path().c_str())),
+      pe_image_(PeImage::FromLoadedModule(this->base_address())) {
 }
 
 GameLibrary::GameLibrary(GameLibrary&& rhs) noexcept
     : path_(std::move(rhs.path_)),
-      base_address_(std::move(rhs.base_address_)) {
+      base_address_(std::move(rhs.base_address_)),
+      pe_image_(std::move(rhs.pe_image_)) {
   rhs.base_address_ = reinterpret_cast<std::intptr_t>(nullptr);
 };
 
@@ -92,6 +94,7 @@ GameLibrary& GameLibrary::operator=(GameLibrary&& rhs) noexcept {
 
   this->path_ = std::move(rhs.path_);
   this->base_address_ = std::move(rhs.base_address_);
+  this->pe_image_ = std::move(rhs.pe_image_);
 
   rhs.base_address_ = reinterpret_cast<std::intptr_t>(nullptr);
 
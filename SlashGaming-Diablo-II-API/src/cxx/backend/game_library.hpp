@@ -50,6 +50,8 @@
 #include <map>
 #include <string>
 
+#include "file/pe_image.hpp"
+
 namespace mapi {
 
 /**
@@ -88,9 +90,17 @@ class GameLibrary {
     return this->path_;
   }
 
+  /**
+   * Returns the export index of this GameLibrary's loaded image.
+   */
+  constexpr const PeImage& pe_image() const noexcept {
+    return this->pe_image_;
+  }
+
  private:
   ::std::wstring path_;
   std::intptr_t base_address_;
+  PeImage pe_image_;
 
   static std::map<::std::wstring, GameLibrary>& GetLibrariesByPaths();
 
@@ -47,10 +47,29 @@
 #define SGMAPI_CXX_BACKEND_GAME_VERSION_GAME_VERSION_FILE_SIGNATURE_HPP_
 
 #include "../../../../include/cxx/game_version.hpp"
+#include "../file/mapped_file.hpp"
 
 namespace d2::intern::file_signature {
 
-GameVersion GuessGameVersion(bool is_game_version_at_least_1_14);
+/**
+ * Validates a game version guess against the signature of the game
+ * executable for 1.14 and above, or of Storm.dll otherwise. The game
+ * executable is read from the caller's mapping.
+ */
+GameVersion GuessGameVersion(
+    bool is_game_version_at_least_1_14,
+    const ::mapi::MappedFile& game_executable_file
+);
+
+/**
+ * Determines the game version from the fingerprint of the mapped game
+ * executable's PE header, without reading its file version. Returns false
+ * if the fingerprint does not identify a game version.
+ */
+bool DetermineGameVersionFromExecutable(
+    const ::mapi::MappedFile& game_executable_file,
+    GameVersion* game_version
+);
 
 constexpr bool HasCheck(GameVersion game_version) {
   switch (game_version) {
@@ -0,0 +1,495 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * The PE signatures that identify each game version, and the fingerprint
+ * index used to search them. None of it reads files, so it can be tested
+ * on its own.
+ */
+
+#ifndef SGMAPI_CXX_BACKEND_GAME_VERSION_GAME_VERSION_FILE_SIGNATURE_TABLE_HPP_
+#define SGMAPI_CXX_BACKEND_GAME_VERSION_GAME_VERSION_FILE_SIGNATURE_TABLE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <utility>
+
+#include "../../../../include/cxx/file/file_pe_signature.hpp"
+#include "../../../../include/cxx/game_version.hpp"
+
+namespace d2::intern::file_signature {
+
+inline constexpr ::std::size_t kSignatureCount = 64;
+
+using FilePeSignature = ::mapi::FilePeSignature<kSignatureCount>;
+
+using FileSignatureTableEntry = ::std::pair<
+    FilePeSignature,
+    GameVersion
+>;
+
+struct FileSignatureTableEntryCompareKey {
+  constexpr bool operator()(
+      const FileSignatureTableEntry& entry1,
+      const FileSignatureTableEntry& entry2
+  ) const noexcept {
+    return entry1.first < entry2.first;
+  }
+
+  constexpr bool operator()(
+      const FileSignatureTableEntry& entry,
+      const FileSignatureTableEntry::first_type& file_signature
+  ) const noexcept {
+    return entry.first < file_signature;
+  }
+
+  constexpr bool operator()(
+      const FileSignatureTableEntry::first_type& file_signature,
+      const FileSignatureTableEntry& entry
+  ) const noexcept {
+    return file_signature < entry.first;
+  }
+};
+
+inline constexpr ::std::array kFilePeSignatureSortedTable =
+    ::std::to_array<FileSignatureTableEntry>({
+        {
+            FilePeSignature({
+                0x50, 0x45, 0x00, 0x00, 0x4C, 0x01, 0x05, 0x00,
+                0x34, 0x81, 0xD4, 0x56, 0x00, 0x00, 0x00, 0x00,
+
+                0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x02, 0x01,
+                0x0B, 0x01, 0x08, 0x00, 0x00, 0xC0, 0x2C, 0x00,
+
+                0x00, 0xE0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0x42, 0x13, 0x29, 0x00, 0x00, 0x10, 0x00, 0x00,
+
+                0x00, 0xD0, 0x2C, 0x00, 0x00, 0x00, 0x40, 0x00,
+                0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+            }),
+            GameVersion::kLod1_14A
+        },
+        {
+            FilePeSignature({
+                0x50, 0x45, 0x00, 0x00, 0x4C, 0x01, 0x05, 0x00,
+                0x38, 0x81, 0xD4, 0x56, 0x00, 0x00, 0x00, 0x00,
+
+                0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x02, 0x01,
+                0x0B, 0x01, 0x08, 0x00, 0x00, 0xC0, 0x2C, 0x00,
+
+                0x00, 0xD0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0x82, 0xFB, 0x28, 0x00, 0x00, 0x10, 0x00, 0x00,
+
+                0x00, 0xD0, 0x2C, 0x00, 0x00, 0x00, 0x40, 0x00,
+                0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+            }),
+            GameVersion::kClassic1_14A
+        },
+        {
+            FilePeSignature({
+                0x50, 0x45, 0x00, 0x00, 0x4C, 0x01, 0x05, 0x00,
+                0x4D, 0xDF, 0x2C, 0x57, 0x00, 0x00, 0x00, 0x00,
+
+                0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x02, 0x01,
+                0x0B, 0x01, 0x08, 0x00, 0x00, 0xC0, 0x2C, 0x00,
+
+                0x00, 0xD0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0xE2, 0x50, 0x28, 0x00, 0x00, 0x10, 0x00, 0x00,
+
+                0x00, 0xD0, 0x2C, 0x00, 0x00, 0x00, 0x40, 0x00,
+                0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+            }),
+            GameVersion::kLod1_14C
+        },
+        {
+            FilePeSignature({
+                0x50, 0x45, 0x00, 0x00, 0x4C, 0x01, 0x05, 0x00,
+                0x52, 0xDF, 0x2C, 0x57, 0x00, 0x00, 0x00, 0x00,
+
+                0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x02, 0x01,
+                0x0B, 0x01, 0x08, 0x00, 0x00, 0xC0, 0x2C, 0x00,
+
+                0x00, 0xC0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0x82, 0xF9, 0x28, 0x00, 0x00, 0x10, 0x00, 0x00,
+
+                0x00, 0xD0, 0x2C, 0x00, 0x00, 0x00, 0x40, 0x00,
+                0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+            }),
+            GameVersion::kClassic1_14C
+        },
+        {
+            FilePeSignature({
+                0x50, 0x45, 0x00, 0x00, 0x4C, 0x01, 0x05, 0x00,
+                0xA8, 0x78, 0xFC, 0x56, 0x00, 0x00, 0x00, 0x00,
+
+                0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x02, 0x01,
+                0x0B, 0x01, 0x08, 0x00, 0x00, 0xC0, 0x2C, 0x00,
+
+                0x00, 0xE0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0xF2, 0x54, 0x28, 0x00, 0x00, 0x10, 0x00, 0x00,
+
+                0x00, 0xD0, 0x2C, 0x00, 0x00, 0x00, 0x40, 0x00,
+                0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+            }),
+            GameVersion::kLod1_14B
+        },
+        {
+            FilePeSignature({
+                0x50, 0x45, 0x00, 0x00, 0x4C, 0x01, 0x05, 0x00,
+                0xAE, 0x78, 0xFC, 0x56, 0x00, 0x00, 0x00, 0x00,
+
+                0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x02, 0x01,
+                0x0B, 0x01, 0x08, 0x00, 0x00, 0xC0, 0x2C, 0x00,
+
+                0x00, 0xD0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0x92, 0xFD, 0x28, 0x00, 0x00, 0x10, 0x00, 0x00,
+
+                0x00, 0xD0, 0x2C, 0x00, 0x00, 0x00, 0x40, 0x00,
+                0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+            }),
+            GameVersion::kClassic1_14B
+        },
+        {
+            FilePeSignature({
+                0x50, 0x45, 0x00, 0x00, 0x4C, 0x01, 0x05, 0x00,
+                0xBC, 0xDF, 0x4D, 0x57, 0x00, 0x00, 0x00, 0x00,
+
+                0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x02, 0x01,
+                0x0B, 0x01, 0x08, 0x00, 0x00, 0xB0, 0x2C, 0x00,
+
+                0x00, 0x60, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0x85, 0x29, 0x28, 0x00, 0x00, 0x10, 0x00, 0x00,
+
+                0x00, 0xC0, 0x2C, 0x00, 0x00, 0x00, 0x40, 0x00,
+                0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+            }),
+            GameVersion::kLod1_14D
+        },
+        {
+            FilePeSignature({
+                0x50, 0x45, 0x00, 0x00, 0x4C, 0x01, 0x05, 0x00,
+                0xC4, 0xDF, 0x4D, 0x57, 0x00, 0x00, 0x00, 0x00,
+
+                0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x02, 0x01,
+                0x0B, 0x01, 0x08, 0x00, 0x00, 0xB0, 0x2C, 0x00,
+
+                0x00, 0x50, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0xB5, 0xCC, 0x28, 0x00, 0x00, 0x10, 0x00, 0x00,
+
+                0x00, 0xC0, 0x2C, 0x00, 0x00, 0x00, 0x40, 0x00,
+                0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+            }),
+            GameVersion::kClassic1_14D
+        },
+        {
+            FilePeSignature({
+                0x50, 0x45, 0x00, 0x00, 0x4C, 0x01, 0x06, 0x00,
+                0x25, 0x47, 0x52, 0x39, 0x00, 0x00, 0x00, 0x00,
+
+                0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x21,
+                0x0B, 0x01, 0x06, 0x00, 0x00, 0xF0, 0x02, 0x00,
+
+                0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0x20, 0xA4, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00,
+
+                0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x10,
+                0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+            }),
+            GameVersion::k1_01
+        },
+        {
+            FilePeSignature({
+                0x50, 0x45, 0x00, 0x00, 0x4C, 0x01, 0x06, 0x00,
+                0x32, 0xA6, 0xDC, 0x3A, 0x00, 0x00, 0x00, 0x00,
+
+                0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x21,
+                0x0B, 0x01, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00,
+
+                0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0x50, 0xA7, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00,
+
+                0x00, 0x10, 0x03, 0x00, 0x00, 0x00, 0xFB, 0x6F,
+                0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+            }),
+            GameVersion::k1_07Beta
+        },
+        {
+            FilePeSignature({
+                0x50, 0x45, 0x00, 0x00, 0x4C, 0x01, 0x06, 0x00,
+                0x43, 0x0C, 0xD6, 0x3A, 0x00, 0x00, 0x00, 0x00,
+
+                0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x21,
+                0x0B, 0x01, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00,
+
+                0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0x50, 0xA7, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00,
+
+                0x00, 0x10, 0x03, 0x00, 0x00, 0x00, 0xFB, 0x6F,
+                0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+            }),
+            GameVersion::k1_06
+        },
+        {
+            FilePeSignature({
+                0x50, 0x45, 0x00, 0x00, 0x4C, 0x01, 0x06, 0x00,
+                0x79, 0xBD, 0x20, 0x39, 0x00, 0x00, 0x00, 0x00,
+
+                0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x21,
+                0x0B, 0x01, 0x06, 0x00, 0x00, 0xF0, 0x02, 0x00,
+
+                0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0x20, 0xA4, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00,
+
+                0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x10,
+                0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+            }),
+            GameVersion::kBeta1_02StressTest
+        },
+        {
+            FilePeSignature({
+                0x50, 0x45, 0x00, 0x00, 0x4C, 0x01, 0x06, 0x00,
+                0xB5, 0x92, 0xF5, 0x3A, 0x00, 0x00, 0x00, 0x00,
+
+                0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x21,
+                0x0B, 0x01, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00,
+
+                0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0x50, 0xA7, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00,
+
+                0x00, 0x10, 0x03, 0x00, 0x00, 0x00, 0xFB, 0x6F,
+                0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+            }),
+            GameVersion::k1_07
+        },
+        {
+            FilePeSignature({
+                0x50, 0x45, 0x00, 0x00, 0x4C, 0x01, 0x06, 0x00,
+                0xB7, 0x70, 0xD0, 0x38, 0x00, 0x00, 0x00, 0x00,
+
+                0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x21,
+                0x0B, 0x01, 0x06, 0x00, 0x00, 0xF0, 0x02, 0x00,
+
+                0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0x70, 0x9A, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00,
+
+                0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x10,
+                0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+            }),
+            GameVersion::kBeta1_02
+        },
+        {
+            FilePeSignature({
+                0x50, 0x45, 0x00, 0x00, 0x4C, 0x01, 0x06, 0x00,
+                0xBC, 0xC7, 0x2E, 0x39, 0x00, 0x00, 0x00, 0x00,
+
+                0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x21,
+                0x0B, 0x01, 0x06, 0x00, 0x00, 0xF0, 0x02, 0x00,
+
+                0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0x20, 0xA4, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00,
+
+                0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x10,
+                0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+            }),
+            GameVersion::k1_00
+        },
+        {
+            FilePeSignature({
+                0x50, 0x45, 0x00, 0x00, 0x4C, 0x01, 0x06, 0x00,
+                0xC1, 0x7B, 0xE0, 0x3A, 0x00, 0x00, 0x00, 0x00,
+
+                0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x21,
+                0x0B, 0x01, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00,
+
+                0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0x50, 0xA7, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00,
+
+                0x00, 0x10, 0x03, 0x00, 0x00, 0x00, 0xFB, 0x6F,
+                0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+            }),
+            GameVersion::k1_06B
+        },
+    });
+
+// If this assertion compiles but produces a linter error, ignore it.
+static_assert(
+    ::std::is_sorted(
+        kFilePeSignatureSortedTable.cbegin(),
+        kFilePeSignatureSortedTable.cend(),
+        FileSignatureTableEntryCompareKey()
+    )
+);
+
+/**
+ * Returns the fingerprint of a PE header signature. The signature covers
+ * the COFF header, including its TimeDateStamp, and the start of the
+ * optional header. The bytes are hashed as 64-bit words in the manner of
+ * FNV-1a, which takes an eighth of the multiplications of hashing byte by
+ * byte. The table is fingerprinted by the same function at compile time,
+ * so the byte order of the words does not matter.
+ */
+constexpr ::std::uint64_t HashFilePeSignature(
+    const FilePeSignature& file_signature
+) noexcept {
+  constexpr ::std::uint64_t kFnvOffsetBasis = 0xCBF29CE484222325;
+  constexpr ::std::uint64_t kFnvPrime = 0x00000100000001B3;
+
+  using SignatureWords = ::std::array<
+      ::std::uint64_t,
+      FilePeSignature::kSignatureSize / sizeof(::std::uint64_t)
+  >;
+
+  static_assert(
+      sizeof(SignatureWords) == sizeof(FilePeSignature::SignatureType)
+  );
+
+  SignatureWords signature_words =
+      ::std::bit_cast<SignatureWords>(file_signature.signature());
+
+  ::std::uint64_t hash = kFnvOffsetBasis;
+
+  for (::std::uint64_t signature_word : signature_words) {
+    hash ^= signature_word;
+    hash *= kFnvPrime;
+  }
+
+  // The multiplications only carry upward, so fold the high bits into
+  // the low bits that select the slot.
+  hash ^= hash >> 32;
+
+  return hash;
+}
+
+constexpr bool AreFingerprintsUnique() noexcept {
+  for (::std::size_t i = 0; i < kFilePeSignatureSortedTable.size(); i += 1) {
+    for (::std::size_t j = i + 1;
+        j < kFilePeSignatureSortedTable.size();
+        j += 1) {
+      if (HashFilePeSignature(kFilePeSignatureSortedTable[i].first)
+          == HashFilePeSignature(kFilePeSignatureSortedTable[j].first)) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+static_assert(AreFingerprintsUnique());
+
+/**
+ * An open addressing hash table that maps a signature fingerprint to the
+ * index of its entry in the sorted signature table.
+ */
+struct FingerprintTable {
+  static constexpr ::std::size_t kCapacity = ::std::bit_ceil(
+      kFilePeSignatureSortedTable.size() * 2
+  );
+
+  ::std::array<::std::uint64_t, kCapacity> fingerprints;
+
+  // A slot stores the entry index plus 1, so that 0 marks an empty slot.
+  ::std::array<::std::size_t, kCapacity> entry_indices;
+};
+
+constexpr FingerprintTable MakeFingerprintTable() noexcept {
+  FingerprintTable fingerprint_table = {};
+
+  for (::std::size_t i = 0; i < kFilePeSignatureSortedTable.size(); i += 1) {
+    ::std::uint64_t fingerprint =
+        HashFilePeSignature(kFilePeSignatureSortedTable[i].first);
+
+    ::std::size_t slot = fingerprint % FingerprintTable::kCapacity;
+    while (fingerprint_table.entry_indices[slot] != 0) {
+      slot = (slot + 1) % FingerprintTable::kCapacity;
+    }
+
+    fingerprint_table.fingerprints[slot] = fingerprint;
+    fingerprint_table.entry_indices[slot] = i + 1;
+  }
+
+  return fingerprint_table;
+}
+
+inline constexpr FingerprintTable kFingerprintTable =
+    MakeFingerprintTable();
+
+/**
+ * Returns the table entry with the specified signature, or nullptr if no
+ * entry has the signature.
+ */
+constexpr const FileSignatureTableEntry* FindTableEntry(
+    const FilePeSignature& file_signature
+) {
+  ::std::uint64_t fingerprint = HashFilePeSignature(file_signature);
+
+  for (::std::size_t slot = fingerprint % FingerprintTable::kCapacity;
+      kFingerprintTable.entry_indices[slot] != 0;
+      slot = (slot + 1) % FingerprintTable::kCapacity) {
+    if (kFingerprintTable.fingerprints[slot] != fingerprint) {
+      continue;
+    }
+
+    const FileSignatureTableEntry& entry =
+        kFilePeSignatureSortedTable[kFingerprintTable.entry_indices[slot] - 1];
+
+    // Compare the full signature to rule out a foreign file that shares
+    // the fingerprint.
+    if (entry.first != file_signature) {
+      return nullptr;
+    }
+
+    return &entry;
+  }
+
+  return nullptr;
+}
+
+} // namespace d2::intern::file_signature
+
+#endif // SGMAPI_CXX_BACKEND_GAME_VERSION_GAME_VERSION_FILE_SIGNATURE_TABLE_HPP_
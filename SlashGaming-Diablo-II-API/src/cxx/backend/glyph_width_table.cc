@@ -43,58 +43,56 @@
  *  work.
  */
 
-#include "thiscall_function.hpp"
+#include "glyph_width_table.hpp"
 
-#include "../../../asm_x86_macro.h"
+#include <algorithm>
 
 namespace mapi {
+namespace {
 
-__declspec(naked) void* __cdecl CallThiscallFunction_Impl(
-    std::intptr_t func_ptr,
-    int num_params,
-    ...
-) {
-  ASM_X86(push ebp);
-  ASM_X86(mov ebp, esp);
+// The game starts a color code with U+00FF, followed by 'c' and the
+// color's character.
+static constexpr ::std::uint16_t kColorCodeLead = 0xFF;
+static constexpr ::std::uint16_t kLineBreak = u'\n';
 
-  ASM_X86(push ecx);
-  ASM_X86(push edx);
+} // namespace
 
-  // Push all the stack arguments.
+GlyphWidthTable::GlyphWidthTable() = default;
 
-  // Load num_params into ecx.
-  ASM_X86(mov ecx, dword ptr [ebp + 12]);
+GlyphWidthTable::GlyphWidthTable(GlyphWidthTable&& table) noexcept = default;
 
-  // Load pointer of num_params into eax, which will be used to get the
-  // pointer of the parameters after it.
-  ASM_X86(lea eax, dword ptr [ebp + 12]);
-  ASM_X86(lea eax, dword ptr [eax + ecx * 4]);
-ASM_X86_LABEL(CallThiscallFunction_PushStackArgsLoop);
-  ASM_X86(cmp ecx, 2);
-  ASM_X86(jl CallThiscallFunction_PushStackArgsLoopEnd);
+GlyphWidthTable::~GlyphWidthTable() = default;
 
-  ASM_X86(push dword ptr [eax]);
-  ASM_X86(sub ecx, 1);
-  ASM_X86(sub eax, 4);
-  ASM_X86(jmp CallThiscallFunction_PushStackArgsLoop);
-ASM_X86_LABEL(CallThiscallFunction_PushStackArgsLoopEnd);
+GlyphWidthTable& GlyphWidthTable::operator=(
+    GlyphWidthTable&& table
+) noexcept = default;
 
-  // We do not conditionally branch when setting the ecx register, because it
-  // incurs additional cost (in readability and execution) with no realistic
-  // benefit. the fact that if the called function has no parameters, the
-  // register values are overriden anyways.
+bool GlyphWidthTable::IsMeasurable(
+    const ::std::uint16_t* text,
+    ::std::size_t length
+) noexcept {
+  const ::std::uint16_t* text_end = &text[length];
 
-  // Set first parameter.
-  ASM_X86(mov ecx, dword ptr [ebp + 16]);
+  return ::std::none_of(
+      text,
+      text_end,
+      [](::std::uint16_t ch) {
+        return ch == kColorCodeLead || ch == kLineBreak;
+      }
+  );
+}
 
-  // Call the function.
-  ASM_X86(call dword ptr [ebp + 8]);
+void GlyphWidthTable::Clear() noexcept {
+  for (::std::unique_ptr<Page>& page : this->pages_) {
+    page.reset();
+  }
+}
 
-  ASM_X86(pop edx);
-  ASM_X86(pop ecx);
+::std::unique_ptr<GlyphWidthTable::Page> GlyphWidthTable::MakePage() {
+  ::std::unique_ptr<Page> page = ::std::make_unique<Page>();
+  page->fill(kUnknownWidth);
 
-  ASM_X86(leave);
-  ASM_X86(ret);
+  return page;
 }
 
 } // namespace mapi
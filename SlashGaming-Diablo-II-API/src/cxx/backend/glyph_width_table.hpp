@@ -0,0 +1,141 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_BACKEND_GLYPH_WIDTH_TABLE_HPP_
+#define SGD2MAPI_CXX_BACKEND_GLYPH_WIDTH_TABLE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace mapi {
+
+/**
+ * A lazily filled table of glyph advances for a single font. Each code
+ * unit's width is queried once, and strings are then measured by summing
+ * table entries. The table knows nothing about the game; the query that
+ * supplies the widths is passed to Measure.
+ */
+class GlyphWidthTable {
+ public:
+  static constexpr const ::std::size_t kPageLength = 256;
+  static constexpr const ::std::size_t kPageCount = 256;
+
+  GlyphWidthTable();
+
+  GlyphWidthTable(const GlyphWidthTable& table) = delete;
+  GlyphWidthTable(GlyphWidthTable&& table) noexcept;
+
+  ~GlyphWidthTable();
+
+  GlyphWidthTable& operator=(const GlyphWidthTable& table) = delete;
+  GlyphWidthTable& operator=(GlyphWidthTable&& table) noexcept;
+
+  /**
+   * Returns whether the text can be measured by summing glyph widths.
+   * Text with color codes or line breaks is measured differently by the
+   * game and must not be measured with the table.
+   */
+  static bool IsMeasurable(
+      const ::std::uint16_t* text,
+      ::std::size_t length
+  ) noexcept;
+
+  /**
+   * Returns the sum of the widths of the code units in the text. The
+   * query is called with each code unit whose width is not yet known and
+   * must return that code unit's width.
+   */
+  template <typename GlyphWidthQuery>
+  int Measure(
+      const ::std::uint16_t* text,
+      ::std::size_t length,
+      GlyphWidthQuery&& query
+  ) {
+    int width = 0;
+
+    for (::std::size_t i = 0; i < length; i += 1) {
+      ::std::uint16_t ch = text[i];
+      ::std::int16_t& glyph_width = this->GetEntry(ch);
+
+      if (glyph_width == kUnknownWidth) {
+        glyph_width = static_cast<::std::int16_t>(query(ch));
+      }
+
+      width += glyph_width;
+    }
+
+    return width;
+  }
+
+  /**
+   * Forgets every known glyph width.
+   */
+  void Clear() noexcept;
+
+ private:
+  using Page = ::std::array<::std::int16_t, kPageLength>;
+
+  static constexpr const ::std::int16_t kUnknownWidth = -1;
+
+  ::std::array<::std::unique_ptr<Page>, kPageCount> pages_;
+
+  ::std::int16_t& GetEntry(::std::uint16_t ch) {
+    ::std::unique_ptr<Page>& page = this->pages_[ch / kPageLength];
+
+    if (page == nullptr) {
+      page = this->MakePage();
+    }
+
+    return (*page)[ch % kPageLength];
+  }
+
+  static ::std::unique_ptr<Page> MakePage();
+};
+
+} // namespace mapi
+
+#endif // SGD2MAPI_CXX_BACKEND_GLYPH_WIDTH_TABLE_HPP_
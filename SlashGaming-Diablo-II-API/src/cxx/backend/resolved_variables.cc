@@ -43,50 +43,37 @@
  *  work.
  */
 
-#include "stdcall_function.hpp"
-
-#include "../../../asm_x86_macro.h"
+#include "resolved_variables.hpp"
 
 namespace mapi {
+namespace {
 
-__declspec(naked) void* __cdecl CallStdcallFunction_Impl(
-    std::intptr_t func_ptr,
-    int num_params,
-    ...
-) {
-  ASM_X86(push ebp);
-  ASM_X86(mov ebp, esp);
-
-  ASM_X86(push ecx);
-  ASM_X86(push edx);
+#define MAPI_RESOLVED_VARIABLE(library, address_name, member, type) \
+    .member = { ::d2::DefaultLibrary::library, address_name },
 
-  // Push all the stack arguments.
+constinit static const ResolvedVariables resolved_variables = {
+  MAPI_RESOLVED_VARIABLE_LIST(MAPI_RESOLVED_VARIABLE)
+};
 
-  // Load num_params into ecx.
-  ASM_X86(mov ecx, dword ptr [ebp + 12]);
+#undef MAPI_RESOLVED_VARIABLE
 
-  // Load pointer of num_params into eax, which will be used to get the
-  // pointer of the parameters after it.
-  ASM_X86(lea eax, dword ptr [ebp + 12]);
-  ASM_X86(lea eax, dword ptr [eax + ecx * 4]);
-ASM_X86_LABEL(CallStdcallFunction_PushStackArgsLoop);
-  ASM_X86(test ecx, ecx);
-  ASM_X86(jz CallStdcallFunction_PushStackArgsLoopEnd);
+} // namespace
 
-  ASM_X86(push dword ptr [eax]);
-  ASM_X86(sub ecx, 1);
-  ASM_X86(sub eax, 4);
-  ASM_X86(jmp CallStdcallFunction_PushStackArgsLoop);
-ASM_X86_LABEL(CallStdcallFunction_PushStackArgsLoopEnd);
+::std::intptr_t ResolveVariableRawAddress(
+    ::d2::DefaultLibrary library,
+    const char* address_name
+) {
+  if (!HasGameAddress(library, address_name)) {
+    return -1;
+  }
 
-  // Call the function.
-  ASM_X86(call dword ptr [ebp + 8]);
+  GameAddress game_address = LoadGameAddress(library, address_name);
 
-  ASM_X86(pop edx);
-  ASM_X86(pop ecx);
+  return game_address.raw_address();
+}
 
-  ASM_X86(leave);
-  ASM_X86(ret);
+const ResolvedVariables& GetResolvedVariables() {
+  return resolved_variables;
 }
 
 } // namespace mapi
@@ -0,0 +1,283 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_BACKEND_RESOLVED_VARIABLES_HPP_
+#define SGD2MAPI_CXX_BACKEND_RESOLVED_VARIABLES_HPP_
+
+#include <windows.h>
+#include <cstdint>
+#include <atomic>
+
+#include "../../../include/cxx/default_game_library.hpp"
+#include "../../../include/cxx/game_bool.hpp"
+#include "../../../include/cxx/game_constant/d2_difficulty_level.hpp"
+#include "../../../include/cxx/game_constant/d2_screen_open_mode.hpp"
+#include "../../../include/cxx/game_constant/d2_video_mode.hpp"
+#include "../../../include/cxx/game_struct/d2_belt_record/d2_belt_record_struct.hpp"
+#include "../../../include/cxx/game_struct/d2_inventory_record/d2_inventory_record_struct.hpp"
+#include "game_address_table.hpp"
+
+/**
+ * Every game variable, as its library, address name, member name in
+ * ResolvedVariables, and the type stored at its address. Variables whose
+ * type changes between game versions are listed by their representation.
+ */
+#define MAPI_RESOLVED_VARIABLE_LIST(MAPI_RESOLVED_VARIABLE) \
+    MAPI_RESOLVED_VARIABLE(kBNClient, "GatewayDomainName", \
+        bnclient_gateway_domain_name, char) \
+    MAPI_RESOLVED_VARIABLE(kBNClient, "GatewayIpV4Address", \
+        bnclient_gateway_ip_v4_address, char) \
+    MAPI_RESOLVED_VARIABLE(kD2Client, "DifficultyLevel", \
+        d2client_difficulty_level, ::d2::DifficultyLevel_1_00) \
+    MAPI_RESOLVED_VARIABLE(kD2Client, "GameType", \
+        d2client_game_type, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2Client, "GeneralDisplayHeight", \
+        d2client_general_display_height, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2Client, "GeneralDisplayWidth", \
+        d2client_general_display_width, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2Client, "GeneralPlayAreaCameraShiftX", \
+        d2client_general_play_area_camera_shift_x, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2Client, "IngameMousePositionX", \
+        d2client_ingame_mouse_position_x, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2Client, "IngameMousePositionY", \
+        d2client_ingame_mouse_position_y, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2Client, "InventoryArrangeMode", \
+        d2client_inventory_arrange_mode, ::std::uint32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2Client, "IsAutomapOpen", \
+        d2client_is_automap_open, ::mapi::bool32) \
+    MAPI_RESOLVED_VARIABLE(kD2Client, "IsGameMenuOpen", \
+        d2client_is_game_menu_open, ::mapi::bool32) \
+    MAPI_RESOLVED_VARIABLE(kD2Client, "IsHelpScreenOpen", \
+        d2client_is_help_screen_open, ::mapi::bool32) \
+    MAPI_RESOLVED_VARIABLE(kD2Client, "IsNewSkillButtonPressed", \
+        d2client_is_new_skill_button_pressed, ::mapi::bool32) \
+    MAPI_RESOLVED_VARIABLE(kD2Client, "IsNewStatsButtonPressed", \
+        d2client_is_new_stats_button_pressed, ::mapi::bool32) \
+    MAPI_RESOLVED_VARIABLE(kD2Client, "ScreenOpenMode", \
+        d2client_screen_open_mode, ::d2::ScreenOpenMode_1_07) \
+    MAPI_RESOLVED_VARIABLE(kD2Client, "ScreenShiftX", \
+        d2client_screen_shift_x, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2Client, "ScreenShiftY", \
+        d2client_screen_shift_y, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2Common, "GlobalBeltsTxt", \
+        d2common_global_belts_txt, ::d2::BeltRecord_1_00*) \
+    MAPI_RESOLVED_VARIABLE(kD2Common, "GlobalInventoryTxt", \
+        d2common_global_inventory_txt, ::d2::InventoryRecord_1_00*) \
+    MAPI_RESOLVED_VARIABLE(kD2Common, "GlobalInventoryTxtRecordsCount", \
+        d2common_global_inventory_txt_records_count, ::std::uint32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2DDraw, "BitBlockHeight", \
+        d2ddraw_bit_block_height, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2DDraw, "BitBlockWidth", \
+        d2ddraw_bit_block_width, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2DDraw, "CelDisplayLeft", \
+        d2ddraw_cel_display_left, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2DDraw, "CelDisplayRight", \
+        d2ddraw_cel_display_right, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2DDraw, "DisplayHeight", \
+        d2ddraw_display_height, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2DDraw, "DisplayWidth", \
+        d2ddraw_display_width, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2Direct3D, "DisplayHeight", \
+        d2direct3d_display_height, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2Direct3D, "DisplayWidth", \
+        d2direct3d_display_width, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2GDI, "BitBlockHeight", \
+        d2gdi_bit_block_height, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2GDI, "BitBlockWidth", \
+        d2gdi_bit_block_width, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2GDI, "CelDisplayLeft", \
+        d2gdi_cel_display_left, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2GDI, "CelDisplayRight", \
+        d2gdi_cel_display_right, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2GFX, "IsWindowedMode", \
+        d2gfx_is_windowed_mode, ::mapi::bool32) \
+    MAPI_RESOLVED_VARIABLE(kD2GFX, "ResolutionMode", \
+        d2gfx_resolution_mode, ::std::uint32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2GFX, "VideoMode", \
+        d2gfx_video_mode, ::d2::VideoMode_1_00) \
+    MAPI_RESOLVED_VARIABLE(kD2GFX, "WindowHandle", \
+        d2gfx_window_handle, HWND) \
+    MAPI_RESOLVED_VARIABLE(kD2Glide, "DisplayHeight", \
+        d2glide_display_height, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2Glide, "DisplayWidth", \
+        d2glide_display_width, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2Win, "MainMenuMousePositionX", \
+        d2win_main_menu_mouse_position_x, ::std::int32_t) \
+    MAPI_RESOLVED_VARIABLE(kD2Win, "MainMenuMousePositionY", \
+        d2win_main_menu_mouse_position_y, ::std::int32_t)
+
+namespace mapi {
+
+/**
+ * Returns the raw address of a game variable, or -1 if the running game
+ * version's address table does not have it.
+ */
+::std::intptr_t ResolveVariableRawAddress(
+    ::d2::DefaultLibrary library,
+    const char* address_name
+);
+
+/**
+ * The address of one game variable, located on first use. Every
+ * variable is located separately, so that reading one variable never
+ * loads the library of another.
+ *
+ * Once located, an accessor costs an acquire load of the stored address
+ * and a compare against each of the two marker values. Missing
+ * variables are remembered too, so they are not looked up again.
+ */
+template <typename T>
+class ResolvedVariable {
+ public:
+  constexpr ResolvedVariable(
+      ::d2::DefaultLibrary library,
+      const char* address_name
+  ) noexcept
+      : library_(library),
+        address_name_(address_name),
+        raw_address_(kUnresolvedRawAddress) {
+  }
+
+  ResolvedVariable(const ResolvedVariable& rhs) = delete;
+
+  ResolvedVariable& operator=(const ResolvedVariable& rhs) = delete;
+
+  /**
+   * Returns the address of the variable, or nullptr if the running game
+   * version does not have it. The variable's library is loaded if it is
+   * not loaded yet.
+   */
+  T* Find() const {
+    ::std::intptr_t raw_address =
+        this->raw_address_.load(::std::memory_order_acquire);
+
+    if (raw_address == kUnresolvedRawAddress) {
+      raw_address = ResolveVariableRawAddress(
+          this->library_,
+          this->address_name_
+      );
+      this->raw_address_.store(raw_address, ::std::memory_order_release);
+    }
+
+    return ToAddress(raw_address);
+  }
+
+  /**
+   * Returns the address of the variable, or nullptr if the running game
+   * version does not have it or its library is not loaded yet. While
+   * the library is not loaded, each call also costs the check in
+   * IsGameLibraryLoaded.
+   */
+  T* FindIfLoaded() const {
+    ::std::intptr_t raw_address =
+        this->raw_address_.load(::std::memory_order_acquire);
+
+    if (raw_address != kUnresolvedRawAddress) {
+      return ToAddress(raw_address);
+    }
+
+    if (!IsGameLibraryLoaded(this->library_)) {
+      return nullptr;
+    }
+
+    return this->Find();
+  }
+
+  /**
+   * Returns the address of the variable. If the running game version
+   * does not have the variable, exits with the same error that
+   * LoadGameAddress reports for a missing address.
+   */
+  T* Require() const {
+    T* address = this->Find();
+
+    if (address == nullptr) {
+      LoadGameAddress(this->library_, this->address_name_);
+    }
+
+    return address;
+  }
+
+ private:
+  static constexpr ::std::intptr_t kUnresolvedRawAddress = 0;
+  static constexpr ::std::intptr_t kMissingRawAddress = -1;
+
+  ::d2::DefaultLibrary library_;
+  const char* address_name_;
+
+  // Two threads may both resolve the same variable, but they store the
+  // same address.
+  mutable ::std::atomic<::std::intptr_t> raw_address_;
+
+  static T* ToAddress(::std::intptr_t raw_address) noexcept {
+    if (raw_address == kMissingRawAddress) {
+      return nullptr;
+    }
+
+    return reinterpret_cast<T*>(raw_address);
+  }
+};
+
+/**
+ * Every game variable, each located on its first use.
+ */
+struct ResolvedVariables {
+#define MAPI_RESOLVED_VARIABLE(library, address_name, member, type) \
+    ResolvedVariable<type> member;
+
+  MAPI_RESOLVED_VARIABLE_LIST(MAPI_RESOLVED_VARIABLE)
+
+#undef MAPI_RESOLVED_VARIABLE
+};
+
+/**
+ * Returns the game variables. Nothing is located by this call; each
+ * variable is located by its own first Find, FindIfLoaded or Require.
+ */
+const ResolvedVariables& GetResolvedVariables();
+
+} // namespace mapi
+
+#endif // SGD2MAPI_CXX_BACKEND_RESOLVED_VARIABLES_HPP_
@@ -0,0 +1,346 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "unicode_string_kernel.hpp"
+
+#include <bit>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SGD2MAPI_UNICODE_STRING_KERNEL_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace mapi {
+namespace {
+
+/**
+ * Describes the letters that a case conversion changes: one range in
+ * Basic Latin, one range in Latin-1 Supplement with a single excluded
+ * symbol, and the amount added to each converted letter.
+ */
+struct CaseMapping {
+  ::std::uint16_t basic_latin_first;
+  ::std::uint16_t latin_1_first;
+  ::std::uint16_t latin_1_excluded;
+  ::std::uint16_t delta;
+};
+
+// A-Z and U+00C0 to U+00DE, except the multiplication sign.
+static constexpr CaseMapping kToLowerMapping = { 0x41, 0xC0, 0xD7, 0x20 };
+
+// a-z and U+00E0 to U+00FE, except the division sign.
+static constexpr CaseMapping kToUpperMapping = {
+    0x61,
+    0xE0,
+    0xF7,
+    static_cast<::std::uint16_t>(-0x20)
+};
+
+static constexpr ::std::uint16_t kBasicLatinRangeLast = 25;
+static constexpr ::std::uint16_t kLatin1RangeLast = 30;
+
+static constexpr ::std::uint16_t MapCase(
+    ::std::uint16_t ch,
+    const CaseMapping& mapping
+) noexcept {
+  ::std::uint16_t basic_latin_index = ch - mapping.basic_latin_first;
+  ::std::uint16_t latin_1_index = ch - mapping.latin_1_first;
+
+  bool is_letter = (basic_latin_index <= kBasicLatinRangeLast)
+      || (latin_1_index <= kLatin1RangeLast
+          && ch != mapping.latin_1_excluded);
+
+  return is_letter
+      ? static_cast<::std::uint16_t>(ch + mapping.delta)
+      : ch;
+}
+
+#if defined(SGD2MAPI_UNICODE_STRING_KERNEL_SSE2)
+
+static constexpr ::std::uintptr_t kPageSize = 4096;
+static constexpr ::std::size_t kBlockLength = 8;
+
+/**
+ * Returns whether an unaligned block load at the address stays within a
+ * single page, and so cannot fault past the end of a string.
+ */
+static bool IsBlockWithinPage(const ::std::uint16_t* ptr) noexcept {
+  ::std::uintptr_t page_offset =
+      reinterpret_cast<::std::uintptr_t>(ptr) & (kPageSize - 1);
+
+  return page_offset <= kPageSize - sizeof(__m128i);
+}
+
+/**
+ * Returns a mask of the lanes whose unsigned value lies within
+ * [first, first + last_index].
+ */
+static __m128i InRangeMask(
+    __m128i block,
+    ::std::uint16_t first,
+    ::std::uint16_t last_index
+) noexcept {
+  __m128i index = _mm_sub_epi16(block, _mm_set1_epi16(first));
+  __m128i overshoot = _mm_subs_epu16(index, _mm_set1_epi16(last_index));
+
+  return _mm_cmpeq_epi16(overshoot, _mm_setzero_si128());
+}
+
+static __m128i MapCaseBlock(
+    __m128i block,
+    const CaseMapping& mapping
+) noexcept {
+  __m128i basic_latin_mask = InRangeMask(
+      block,
+      mapping.basic_latin_first,
+      kBasicLatinRangeLast
+  );
+  __m128i latin_1_mask = _mm_andnot_si128(
+      _mm_cmpeq_epi16(block, _mm_set1_epi16(mapping.latin_1_excluded)),
+      InRangeMask(block, mapping.latin_1_first, kLatin1RangeLast)
+  );
+
+  __m128i letter_mask = _mm_or_si128(basic_latin_mask, latin_1_mask);
+
+  return _mm_add_epi16(
+      block,
+      _mm_and_si128(letter_mask, _mm_set1_epi16(mapping.delta))
+  );
+}
+
+#endif // defined(SGD2MAPI_UNICODE_STRING_KERNEL_SSE2)
+
+static void MapCaseString(
+    const ::std::uint16_t* src,
+    ::std::uint16_t* dest,
+    ::std::size_t count,
+    const CaseMapping& mapping
+) noexcept {
+  ::std::size_t i = 0;
+
+#if defined(SGD2MAPI_UNICODE_STRING_KERNEL_SSE2)
+  for (; i + kBlockLength <= count; i += kBlockLength) {
+    __m128i block = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(&src[i])
+    );
+
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(&dest[i]),
+        MapCaseBlock(block, mapping)
+    );
+  }
+#endif
+
+  for (; i < count; i += 1) {
+    dest[i] = MapCase(src[i], mapping);
+  }
+}
+
+} // namespace
+
+::std::size_t UnicodeStrlen(const ::std::uint16_t* str) noexcept {
+#if defined(SGD2MAPI_UNICODE_STRING_KERNEL_SSE2)
+  ::std::uintptr_t address = reinterpret_cast<::std::uintptr_t>(str);
+
+  // Aligned loads never cross a page, so reading the whole block that
+  // holds the terminator is safe. This requires the lanes to line up
+  // with the code units.
+  if ((address & 1) == 0) {
+    ::std::uintptr_t block_offset = address & (sizeof(__m128i) - 1);
+    const __m128i* block_ptr =
+        reinterpret_cast<const __m128i*>(address - block_offset);
+
+    const __m128i zero = _mm_setzero_si128();
+
+    unsigned int null_mask = _mm_movemask_epi8(
+        _mm_cmpeq_epi16(_mm_load_si128(block_ptr), zero)
+    );
+    null_mask &= ~0U << block_offset;
+
+    while (null_mask == 0) {
+      block_ptr += 1;
+      null_mask = _mm_movemask_epi8(
+          _mm_cmpeq_epi16(_mm_load_si128(block_ptr), zero)
+      );
+    }
+
+    ::std::uintptr_t null_address =
+        reinterpret_cast<::std::uintptr_t>(block_ptr)
+            + ::std::countr_zero(null_mask);
+
+    return (null_address - address) / sizeof(::std::uint16_t);
+  }
+#endif
+
+  ::std::size_t length = 0;
+  while (str[length] != 0) {
+    length += 1;
+  }
+
+  return length;
+}
+
+int UnicodeStrcmp(
+    const ::std::uint16_t* str1,
+    const ::std::uint16_t* str2
+) noexcept {
+  return UnicodeStrncmp(
+      str1,
+      str2,
+      ::std::numeric_limits<::std::size_t>::max()
+  );
+}
+
+int UnicodeStrncmp(
+    const ::std::uint16_t* str1,
+    const ::std::uint16_t* str2,
+    ::std::size_t count
+) noexcept {
+  ::std::size_t i = 0;
+
+#if defined(SGD2MAPI_UNICODE_STRING_KERNEL_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+
+  while (count - i >= kBlockLength) {
+    // Near the end of a page, step one code unit at a time so that the
+    // block loads cannot read into the next page.
+    if (!IsBlockWithinPage(&str1[i]) || !IsBlockWithinPage(&str2[i])) {
+      int diff = str1[i] - str2[i];
+
+      if (diff != 0 || str1[i] == 0) {
+        return diff;
+      }
+
+      i += 1;
+      continue;
+    }
+
+    __m128i block1 = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(&str1[i])
+    );
+    __m128i block2 = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(&str2[i])
+    );
+
+    unsigned int equal_mask =
+        _mm_movemask_epi8(_mm_cmpeq_epi16(block1, block2));
+    unsigned int null_mask =
+        _mm_movemask_epi8(_mm_cmpeq_epi16(block1, zero));
+    unsigned int stop_mask = (~equal_mask & 0xFFFF) | null_mask;
+
+    if (stop_mask != 0) {
+      ::std::size_t stop_index =
+          i + (::std::countr_zero(stop_mask) / sizeof(::std::uint16_t));
+
+      return str1[stop_index] - str2[stop_index];
+    }
+
+    i += kBlockLength;
+  }
+#endif
+
+  for (; i < count; i += 1) {
+    int diff = str1[i] - str2[i];
+
+    if (diff != 0) {
+      return diff;
+    }
+
+    if (str1[i] == 0) {
+      return 0;
+    }
+  }
+
+  return 0;
+}
+
+::std::uint16_t* UnicodeStrcpy(
+    ::std::uint16_t* dest,
+    const ::std::uint16_t* src
+) noexcept {
+  ::std::size_t length = UnicodeStrlen(src);
+
+  ::std::memcpy(dest, src, (length + 1) * sizeof(::std::uint16_t));
+
+  return dest;
+}
+
+::std::uint16_t* UnicodeStrcat(
+    ::std::uint16_t* dest,
+    const ::std::uint16_t* src
+) noexcept {
+  UnicodeStrcpy(&dest[UnicodeStrlen(dest)], src);
+
+  return dest;
+}
+
+::std::uint16_t UnicodeCharToLower(::std::uint16_t ch) noexcept {
+  return MapCase(ch, kToLowerMapping);
+}
+
+::std::uint16_t UnicodeCharToUpper(::std::uint16_t ch) noexcept {
+  return MapCase(ch, kToUpperMapping);
+}
+
+void UnicodeToLower(
+    const ::std::uint16_t* src,
+    ::std::uint16_t* dest,
+    ::std::size_t count
+) noexcept {
+  MapCaseString(src, dest, count, kToLowerMapping);
+}
+
+void UnicodeToUpper(
+    const ::std::uint16_t* src,
+    ::std::uint16_t* dest,
+    ::std::size_t count
+) noexcept {
+  MapCaseString(src, dest, count, kToUpperMapping);
+}
+
+} // namespace mapi
@@ -0,0 +1,131 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_BACKEND_UNICODE_STRING_KERNEL_HPP_
+#define SGD2MAPI_CXX_BACKEND_UNICODE_STRING_KERNEL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace mapi {
+
+/**
+ * Returns the number of code units before the null terminator.
+ */
+::std::size_t UnicodeStrlen(const ::std::uint16_t* str) noexcept;
+
+/**
+ * Compares two null-terminated strings. Returns the difference between
+ * the first pair of code units that differ, or 0 if the strings are
+ * equal. This matches the game's Unicode_strcmp and Unicode_strncmp.
+ */
+int UnicodeStrcmp(
+    const ::std::uint16_t* str1,
+    const ::std::uint16_t* str2
+) noexcept;
+
+/**
+ * Compares at most count code units of two null-terminated strings, with
+ * the same result as UnicodeStrcmp.
+ */
+int UnicodeStrncmp(
+    const ::std::uint16_t* str1,
+    const ::std::uint16_t* str2,
+    ::std::size_t count
+) noexcept;
+
+/**
+ * Copies the source string and its null terminator into the destination.
+ * Returns the destination.
+ */
+::std::uint16_t* UnicodeStrcpy(
+    ::std::uint16_t* dest,
+    const ::std::uint16_t* src
+) noexcept;
+
+/**
+ * Appends the source string to the end of the destination string.
+ * Returns the destination.
+ */
+::std::uint16_t* UnicodeStrcat(
+    ::std::uint16_t* dest,
+    const ::std::uint16_t* src
+) noexcept;
+
+/**
+ * Converts a code unit to lowercase. Only letters in the Basic Latin and
+ * Latin-1 Supplement blocks are converted.
+ */
+::std::uint16_t UnicodeCharToLower(::std::uint16_t ch) noexcept;
+
+/**
+ * Converts a code unit to uppercase. Only letters in the Basic Latin and
+ * Latin-1 Supplement blocks are converted.
+ */
+::std::uint16_t UnicodeCharToUpper(::std::uint16_t ch) noexcept;
+
+/**
+ * Converts count code units to lowercase. The source and destination may
+ * be the same.
+ */
+void UnicodeToLower(
+    const ::std::uint16_t* src,
+    ::std::uint16_t* dest,
+    ::std::size_t count
+) noexcept;
+
+/**
+ * Converts count code units to uppercase. The source and destination may
+ * be the same.
+ */
+void UnicodeToUpper(
+    const ::std::uint16_t* src,
+    ::std::uint16_t* dest,
+    ::std::size_t count
+) noexcept;
+
+} // namespace mapi
+
+#endif // SGD2MAPI_CXX_BACKEND_UNICODE_STRING_KERNEL_HPP_
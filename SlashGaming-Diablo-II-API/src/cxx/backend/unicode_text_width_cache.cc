@@ -0,0 +1,127 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "unicode_text_width_cache.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../../include/cxx/game_function/d2win/d2win_get_unicode_text_n_draw_width.hpp"
+#include "../../../include/cxx/game_function/d2win/d2win_set_unicode_text_font.hpp"
+#include "glyph_width_table.hpp"
+
+namespace mapi {
+namespace {
+
+// TextFont_1_00 values run from 0 to kFormal_11.
+static constexpr ::std::size_t kFontCount =
+    static_cast<::std::size_t>(::d2::TextFont_1_00::kFormal_11) + 1;
+
+using GlyphWidthTables = ::std::array<GlyphWidthTable, kFontCount>;
+
+/**
+ * Text is only drawn from the game's main thread, so the cache is not
+ * synchronized.
+ */
+static GlyphWidthTables& GetGlyphWidthTables() {
+  static GlyphWidthTables glyph_width_tables;
+
+  return glyph_width_tables;
+}
+
+static int GetGameGlyphWidth(::std::uint16_t ch) {
+  ::d2::UnicodeChar_1_00 glyph = { ch };
+
+  return ::d2::d2win::GetUnicodeTextNDrawWidth_1_00(&glyph, 1);
+}
+
+} // namespace
+
+int GetCachedUnicodeTextNDrawWidth(
+    ::d2::TextFont_1_00 text_font,
+    const ::d2::UnicodeChar_1_00* text,
+    int length
+) {
+  int font_index = static_cast<int>(text_font);
+  const ::std::uint16_t* actual_text =
+      reinterpret_cast<const ::std::uint16_t*>(text);
+
+  if (font_index < 0
+      || font_index >= static_cast<int>(kFontCount)
+      || !GlyphWidthTable::IsMeasurable(actual_text, length)) {
+    return ::d2::d2win::GetUnicodeTextNDrawWidth_1_00(text, length);
+  }
+
+  GlyphWidthTable& glyph_width_table = GetGlyphWidthTables()[font_index];
+
+  return glyph_width_table.Measure(actual_text, length, &GetGameGlyphWidth);
+}
+
+int GetCachedUnicodeTextGlyphWidth(
+    ::d2::TextFont_1_00 text_font,
+    ::std::uint16_t ch
+) {
+  int font_index = static_cast<int>(text_font);
+
+  auto query_glyph_width = [text_font](::std::uint16_t ch) {
+    ::d2::TextFont_1_00 previous_font =
+        ::d2::d2win::SetUnicodeTextFont_1_00(text_font);
+    int glyph_width = GetGameGlyphWidth(ch);
+    ::d2::d2win::SetUnicodeTextFont_1_00(previous_font);
+
+    return glyph_width;
+  };
+
+  if (font_index < 0 || font_index >= static_cast<int>(kFontCount)) {
+    return query_glyph_width(ch);
+  }
+
+  GlyphWidthTable& glyph_width_table = GetGlyphWidthTables()[font_index];
+
+  return glyph_width_table.Measure(&ch, 1, query_glyph_width);
+}
+
+} // namespace mapi
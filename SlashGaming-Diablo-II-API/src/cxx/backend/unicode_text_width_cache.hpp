@@ -0,0 +1,87 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_BACKEND_UNICODE_TEXT_WIDTH_CACHE_HPP_
+#define SGD2MAPI_CXX_BACKEND_UNICODE_TEXT_WIDTH_CACHE_HPP_
+
+#include <cstdint>
+
+#include "../../../include/cxx/game_constant/d2_text_font.hpp"
+#include "../../../include/cxx/game_struct/d2_unicode_char/d2_unicode_char_struct.hpp"
+
+namespace mapi {
+
+/**
+ * Returns the draw width of the text in the specified font. Widths are
+ * summed from a per-font glyph table, which is filled by asking the game
+ * for the width of each new glyph. Text that the game does not measure
+ * as a plain sum is measured by the game.
+ *
+ * The game switches fonts on its own, so the font that it draws with
+ * cannot be tracked from the outside. The caller must have just set the
+ * specified font through SetUnicodeTextFont, or the table is filled with
+ * the widths of another font.
+ */
+int GetCachedUnicodeTextNDrawWidth(
+    ::d2::TextFont_1_00 text_font,
+    const ::d2::UnicodeChar_1_00* text,
+    int length
+);
+
+/**
+ * Returns the draw width of a single code unit in the specified font,
+ * from the same per-font glyph tables. Unlike
+ * GetCachedUnicodeTextNDrawWidth, this does not depend on the font the
+ * game is drawing with: a width that is not yet known is measured by
+ * setting the font, and then restoring the previous one.
+ */
+int GetCachedUnicodeTextGlyphWidth(
+    ::d2::TextFont_1_00 text_font,
+    ::std::uint16_t ch
+);
+
+} // namespace mapi
+
+#endif // SGD2MAPI_CXX_BACKEND_UNICODE_TEXT_WIDTH_CACHE_HPP_
@@ -0,0 +1,454 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "utf8_transcoder.hpp"
+
+// Defining SGD2MAPI_UTF8_TRANSCODER_NO_SIMD builds only the scalar
+// path, so that the tests can check it against the vector paths.
+#if defined(SGD2MAPI_UTF8_TRANSCODER_NO_SIMD)
+#elif defined(__AVX2__)
+#define SGD2MAPI_UTF8_TRANSCODER_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SGD2MAPI_UTF8_TRANSCODER_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace mapi {
+namespace {
+
+static constexpr char32_t kReplacementChar = 0xFFFD;
+
+static constexpr bool IsContinuationByte(char8_t ch) noexcept {
+  return (ch & 0xC0) == 0x80;
+}
+
+static constexpr bool IsHighSurrogate(::std::uint16_t ch) noexcept {
+  return ch >= 0xD800 && ch <= 0xDBFF;
+}
+
+static constexpr bool IsLowSurrogate(::std::uint16_t ch) noexcept {
+  return ch >= 0xDC00 && ch <= 0xDFFF;
+}
+
+/**
+ * Decodes the code point at the start of the source, storing the number of
+ * bytes that it takes up. An invalid byte decodes as one replacement
+ * character.
+ */
+static char32_t DecodeUtf8CodePoint(
+    const char8_t* src,
+    ::std::size_t src_length,
+    ::std::size_t* size
+) noexcept {
+  char8_t lead = src[0];
+
+  ::std::size_t sequence_size;
+  char32_t code_point;
+  char8_t min_second = 0x80;
+  char8_t max_second = 0xBF;
+
+  if (lead >= 0xC2 && lead <= 0xDF) {
+    sequence_size = 2;
+    code_point = lead & 0x1F;
+  } else if (lead >= 0xE0 && lead <= 0xEF) {
+    sequence_size = 3;
+    code_point = lead & 0x0F;
+    min_second = (lead == 0xE0) ? 0xA0 : 0x80;
+    max_second = (lead == 0xED) ? 0x9F : 0xBF;
+  } else if (lead >= 0xF0 && lead <= 0xF4) {
+    sequence_size = 4;
+    code_point = lead & 0x07;
+    min_second = (lead == 0xF0) ? 0x90 : 0x80;
+    max_second = (lead == 0xF4) ? 0x8F : 0xBF;
+  } else {
+    *size = 1;
+    return kReplacementChar;
+  }
+
+  if (src_length < sequence_size
+      || src[1] < min_second
+      || src[1] > max_second) {
+    *size = 1;
+    return kReplacementChar;
+  }
+
+  for (::std::size_t i = 1; i < sequence_size; i += 1) {
+    if (!IsContinuationByte(src[i])) {
+      *size = 1;
+      return kReplacementChar;
+    }
+
+    code_point = (code_point << 6) | (src[i] & 0x3F);
+  }
+
+  *size = sequence_size;
+  return code_point;
+}
+
+/**
+ * Returns the length of the run of ASCII bytes at the start of the
+ * source, counted in whole vector blocks. If dest is not null, the run is
+ * widened into it.
+ */
+static ::std::size_t WidenAsciiBlocks(
+    const char8_t* src,
+    ::std::size_t src_length,
+    ::std::uint16_t* dest
+) noexcept {
+  ::std::size_t i = 0;
+
+#if defined(SGD2MAPI_UTF8_TRANSCODER_AVX2)
+  for (; i + 32 <= src_length; i += 32) {
+    __m256i block = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(&src[i])
+    );
+
+    if (_mm256_movemask_epi8(block) != 0) {
+      break;
+    }
+
+    if (dest != nullptr) {
+      _mm256_storeu_si256(
+          reinterpret_cast<__m256i*>(&dest[i]),
+          _mm256_cvtepu8_epi16(_mm256_castsi256_si128(block))
+      );
+      _mm256_storeu_si256(
+          reinterpret_cast<__m256i*>(&dest[i + 16]),
+          _mm256_cvtepu8_epi16(_mm256_extracti128_si256(block, 1))
+      );
+    }
+  }
+#elif defined(SGD2MAPI_UTF8_TRANSCODER_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+
+  for (; i + 16 <= src_length; i += 16) {
+    __m128i block = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(&src[i])
+    );
+
+    if (_mm_movemask_epi8(block) != 0) {
+      break;
+    }
+
+    if (dest != nullptr) {
+      _mm_storeu_si128(
+          reinterpret_cast<__m128i*>(&dest[i]),
+          _mm_unpacklo_epi8(block, zero)
+      );
+      _mm_storeu_si128(
+          reinterpret_cast<__m128i*>(&dest[i + 8]),
+          _mm_unpackhi_epi8(block, zero)
+      );
+    }
+  }
+#endif
+
+  return i;
+}
+
+/**
+ * Returns the length of the run of ASCII code units at the start of the
+ * source, counted in whole vector blocks. If dest is not null, the run is
+ * narrowed into it.
+ */
+static ::std::size_t NarrowAsciiBlocks(
+    const ::std::uint16_t* src,
+    ::std::size_t src_length,
+    char8_t* dest
+) noexcept {
+  ::std::size_t i = 0;
+
+#if defined(SGD2MAPI_UTF8_TRANSCODER_AVX2)
+  const __m256i non_ascii_mask = _mm256_set1_epi16(
+      static_cast<short>(0xFF80)
+  );
+
+  for (; i + 16 <= src_length; i += 16) {
+    __m256i block = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(&src[i])
+    );
+
+    if (!_mm256_testz_si256(block, non_ascii_mask)) {
+      break;
+    }
+
+    if (dest != nullptr) {
+      _mm_storeu_si128(
+          reinterpret_cast<__m128i*>(&dest[i]),
+          _mm_packus_epi16(
+              _mm256_castsi256_si128(block),
+              _mm256_extracti128_si256(block, 1)
+          )
+      );
+    }
+  }
+#elif defined(SGD2MAPI_UTF8_TRANSCODER_SSE2)
+  const __m128i non_ascii_mask = _mm_set1_epi16(static_cast<short>(0xFF80));
+  const __m128i zero = _mm_setzero_si128();
+
+  for (; i + 8 <= src_length; i += 8) {
+    __m128i block = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(&src[i])
+    );
+
+    __m128i is_ascii = _mm_cmpeq_epi16(
+        _mm_and_si128(block, non_ascii_mask),
+        zero
+    );
+
+    if (_mm_movemask_epi8(is_ascii) != 0xFFFF) {
+      break;
+    }
+
+    if (dest != nullptr) {
+      _mm_storel_epi64(
+          reinterpret_cast<__m128i*>(&dest[i]),
+          _mm_packus_epi16(block, block)
+      );
+    }
+  }
+#endif
+
+  return i;
+}
+
+} // namespace
+
+::std::size_t GetUtf8ToUtf16Length(
+    const char8_t* src,
+    ::std::size_t src_length
+) noexcept {
+  ::std::size_t dest_length = 0;
+  ::std::size_t i = 0;
+
+  while (i < src_length) {
+    ::std::size_t ascii_length = WidenAsciiBlocks(
+        &src[i],
+        src_length - i,
+        nullptr
+    );
+
+    i += ascii_length;
+    dest_length += ascii_length;
+
+    if (i >= src_length) {
+      break;
+    }
+
+    if (src[i] < 0x80) {
+      i += 1;
+      dest_length += 1;
+      continue;
+    }
+
+    ::std::size_t sequence_size;
+    char32_t code_point = DecodeUtf8CodePoint(
+        &src[i],
+        src_length - i,
+        &sequence_size
+    );
+
+    i += sequence_size;
+    dest_length += (code_point >= 0x10000) ? 2 : 1;
+  }
+
+  return dest_length;
+}
+
+::std::size_t TranscodeUtf8ToUtf16(
+    const char8_t* src,
+    ::std::size_t src_length,
+    ::std::uint16_t* dest
+) noexcept {
+  ::std::size_t dest_length = 0;
+  ::std::size_t i = 0;
+
+  while (i < src_length) {
+    ::std::size_t ascii_length = WidenAsciiBlocks(
+        &src[i],
+        src_length - i,
+        &dest[dest_length]
+    );
+
+    i += ascii_length;
+    dest_length += ascii_length;
+
+    if (i >= src_length) {
+      break;
+    }
+
+    if (src[i] < 0x80) {
+      dest[dest_length] = src[i];
+      i += 1;
+      dest_length += 1;
+      continue;
+    }
+
+    ::std::size_t sequence_size;
+    char32_t code_point = DecodeUtf8CodePoint(
+        &src[i],
+        src_length - i,
+        &sequence_size
+    );
+
+    i += sequence_size;
+
+    if (code_point >= 0x10000) {
+      code_point -= 0x10000;
+      dest[dest_length] = 0xD800 | (code_point >> 10);
+      dest[dest_length + 1] = 0xDC00 | (code_point & 0x3FF);
+      dest_length += 2;
+    } else {
+      dest[dest_length] = static_cast<::std::uint16_t>(code_point);
+      dest_length += 1;
+    }
+  }
+
+  return dest_length;
+}
+
+::std::size_t GetUtf16ToUtf8Length(
+    const ::std::uint16_t* src,
+    ::std::size_t src_length
+) noexcept {
+  ::std::size_t dest_length = 0;
+  ::std::size_t i = 0;
+
+  while (i < src_length) {
+    ::std::size_t ascii_length = NarrowAsciiBlocks(
+        &src[i],
+        src_length - i,
+        nullptr
+    );
+
+    i += ascii_length;
+    dest_length += ascii_length;
+
+    if (i >= src_length) {
+      break;
+    }
+
+    ::std::uint16_t ch = src[i];
+
+    if (ch < 0x80) {
+      dest_length += 1;
+    } else if (ch < 0x800) {
+      dest_length += 2;
+    } else if (IsHighSurrogate(ch)
+        && i + 1 < src_length
+        && IsLowSurrogate(src[i + 1])) {
+      dest_length += 4;
+      i += 1;
+    } else {
+      dest_length += 3;
+    }
+
+    i += 1;
+  }
+
+  return dest_length;
+}
+
+::std::size_t TranscodeUtf16ToUtf8(
+    const ::std::uint16_t* src,
+    ::std::size_t src_length,
+    char8_t* dest
+) noexcept {
+  ::std::size_t dest_length = 0;
+  ::std::size_t i = 0;
+
+  while (i < src_length) {
+    ::std::size_t ascii_length = NarrowAsciiBlocks(
+        &src[i],
+        src_length - i,
+        &dest[dest_length]
+    );
+
+    i += ascii_length;
+    dest_length += ascii_length;
+
+    if (i >= src_length) {
+      break;
+    }
+
+    char32_t code_point = src[i];
+    i += 1;
+
+    if (IsHighSurrogate(code_point)
+        && i < src_length
+        && IsLowSurrogate(src[i])) {
+      code_point = 0x10000
+          + ((code_point - 0xD800) << 10)
+          + (src[i] - 0xDC00);
+      i += 1;
+    }
+
+    if (code_point < 0x80) {
+      dest[dest_length] = static_cast<char8_t>(code_point);
+      dest_length += 1;
+    } else if (code_point < 0x800) {
+      dest[dest_length] = 0xC0 | (code_point >> 6);
+      dest[dest_length + 1] = 0x80 | (code_point & 0x3F);
+      dest_length += 2;
+    } else if (code_point < 0x10000) {
+      dest[dest_length] = 0xE0 | (code_point >> 12);
+      dest[dest_length + 1] = 0x80 | ((code_point >> 6) & 0x3F);
+      dest[dest_length + 2] = 0x80 | (code_point & 0x3F);
+      dest_length += 3;
+    } else {
+      dest[dest_length] = 0xF0 | (code_point >> 18);
+      dest[dest_length + 1] = 0x80 | ((code_point >> 12) & 0x3F);
+      dest[dest_length + 2] = 0x80 | ((code_point >> 6) & 0x3F);
+      dest[dest_length + 3] = 0x80 | (code_point & 0x3F);
+      dest_length += 4;
+    }
+  }
+
+  return dest_length;
+}
+
+} // namespace mapi
@@ -0,0 +1,97 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_BACKEND_UTF8_TRANSCODER_HPP_
+#define SGD2MAPI_CXX_BACKEND_UTF8_TRANSCODER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace mapi {
+
+/**
+ * Returns the number of UTF-16 code units needed to store the UTF-8
+ * source. Each invalid byte in the source is counted as one replacement
+ * character.
+ */
+::std::size_t GetUtf8ToUtf16Length(
+    const char8_t* src,
+    ::std::size_t src_length
+) noexcept;
+
+/**
+ * Converts the UTF-8 source into UTF-16 code units. The destination must
+ * have room for the number of code units returned by GetUtf8ToUtf16Length.
+ * Returns the number of code units written.
+ */
+::std::size_t TranscodeUtf8ToUtf16(
+    const char8_t* src,
+    ::std::size_t src_length,
+    ::std::uint16_t* dest
+) noexcept;
+
+/**
+ * Returns the number of UTF-8 bytes needed to store the UTF-16 source.
+ * Unpaired surrogates are encoded as their own three byte sequences.
+ */
+::std::size_t GetUtf16ToUtf8Length(
+    const ::std::uint16_t* src,
+    ::std::size_t src_length
+) noexcept;
+
+/**
+ * Converts the UTF-16 source into UTF-8. The destination must have room
+ * for the number of bytes returned by GetUtf16ToUtf8Length. Returns the
+ * number of bytes written.
+ */
+::std::size_t TranscodeUtf16ToUtf8(
+    const ::std::uint16_t* src,
+    ::std::size_t src_length,
+    char8_t* dest
+) noexcept;
+
+} // namespace mapi
+
+#endif // SGD2MAPI_CXX_BACKEND_UTF8_TRANSCODER_HPP_
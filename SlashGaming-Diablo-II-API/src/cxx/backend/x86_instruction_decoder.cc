@@ -0,0 +1,684 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "x86_instruction_decoder.hpp"
+
+#include <array>
+#include <cstring>
+
+namespace mapi {
+namespace {
+
+enum OpcodeFlag : ::std::uint16_t {
+  kNone = 0,
+  kModRm = 1 << 0,
+  kImm8 = 1 << 1,
+  kImm16 = 1 << 2,
+
+  // 16-bit or 32-bit immediate, depending on the operand size.
+  kImmZ = 1 << 3,
+  kRel8 = 1 << 4,
+
+  // 16-bit or 32-bit displacement, depending on the operand size.
+  kRelZ = 1 << 5,
+
+  // Memory offset, sized by the address size.
+  kMoffs = 1 << 6,
+  kFarPointer = 1 << 7,
+  kPrefix = 1 << 8,
+
+  // F6 and F7 take an immediate only for the TEST encodings.
+  kGroup3 = 1 << 9,
+  kEscape = 1 << 10,
+  kEscape38 = 1 << 11,
+  kEscape3A = 1 << 12,
+  kFlowEnd = 1 << 13,
+  kInvalid = 1 << 14,
+};
+
+static constexpr ::std::uint16_t N = kNone;
+static constexpr ::std::uint16_t M = kModRm;
+static constexpr ::std::uint16_t MI8 = kModRm | kImm8;
+static constexpr ::std::uint16_t MIZ = kModRm | kImmZ;
+static constexpr ::std::uint16_t I8 = kImm8;
+static constexpr ::std::uint16_t I16 = kImm16;
+static constexpr ::std::uint16_t IZ = kImmZ;
+static constexpr ::std::uint16_t R8 = kRel8;
+static constexpr ::std::uint16_t RZ = kRelZ;
+static constexpr ::std::uint16_t MO = kMoffs;
+static constexpr ::std::uint16_t FP = kFarPointer;
+static constexpr ::std::uint16_t P = kPrefix;
+static constexpr ::std::uint16_t G3 = kModRm | kGroup3;
+static constexpr ::std::uint16_t E = kEscape;
+static constexpr ::std::uint16_t X = kInvalid;
+static constexpr ::std::uint16_t F = kFlowEnd;
+static constexpr ::std::uint16_t RTI = kImm16 | kFlowEnd;
+static constexpr ::std::uint16_t JR8 = kRel8 | kFlowEnd;
+static constexpr ::std::uint16_t JRZ = kRelZ | kFlowEnd;
+static constexpr ::std::uint16_t JFP = kFarPointer | kFlowEnd;
+static constexpr ::std::uint16_t ENT = kImm16 | kImm8;
+static constexpr ::std::uint16_t E38 = kEscape38;
+static constexpr ::std::uint16_t E3A = kEscape3A;
+
+static constexpr ::std::array<::std::uint16_t, 256> kOneByteOpcodeFlags = {
+  /*        0   1   2   3   4   5   6   7   8   9   A   B   C   D   E   F */
+  /* 0 */   M,  M,  M,  M, I8, IZ,  N,  N,  M,  M,  M,  M, I8, IZ,  N,  E,
+  /* 1 */   M,  M,  M,  M, I8, IZ,  N,  N,  M,  M,  M,  M, I8, IZ,  N,  N,
+  /* 2 */   M,  M,  M,  M, I8, IZ,  P,  N,  M,  M,  M,  M, I8, IZ,  P,  N,
+  /* 3 */   M,  M,  M,  M, I8, IZ,  P,  N,  M,  M,  M,  M, I8, IZ,  P,  N,
+  /* 4 */   N,  N,  N,  N,  N,  N,  N,  N,  N,  N,  N,  N,  N,  N,  N,  N,
+  /* 5 */   N,  N,  N,  N,  N,  N,  N,  N,  N,  N,  N,  N,  N,  N,  N,  N,
+  /* 6 */   N,  N,  M,  M,  P,  P,  P,  P, IZ,MIZ, I8,MI8,  N,  N,  N,  N,
+  /* 7 */  R8, R8, R8, R8, R8, R8, R8, R8, R8, R8, R8, R8, R8, R8, R8, R8,
+  /* 8 */ MI8,MIZ,MI8,MI8,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,
+  /* 9 */   N,  N,  N,  N,  N,  N,  N,  N,  N,  N, FP,  N,  N,  N,  N,  N,
+  /* A */  MO, MO, MO, MO,  N,  N,  N,  N, I8, IZ,  N,  N,  N,  N,  N,  N,
+  /* B */  I8, I8, I8, I8, I8, I8, I8, I8, IZ, IZ, IZ, IZ, IZ, IZ, IZ, IZ,
+  /* C */ MI8,MI8,RTI,  F,  M,  M,MI8,MIZ,ENT,  N,RTI,  F,  F, I8,  N,  F,
+  /* D */   M,  M,  M,  M, I8, I8,  N,  N,  M,  M,  M,  M,  M,  M,  M,  M,
+  /* E */  R8, R8, R8, R8, I8, I8, I8, I8, RZ,JRZ,JFP,JR8,  N,  N,  N,  N,
+  /* F */   P,  N,  P,  P,  F,  N, G3, G3,  N,  N,  N,  N,  N,  N,  M,  M,
+};
+
+static constexpr ::std::array<::std::uint16_t, 256> kTwoByteOpcodeFlags = {
+  /*        0   1   2   3   4   5   6   7   8   9   A   B   C   D   E   F */
+  /* 0 */   M,  M,  M,  M,  X,  N,  N,  N,  N,  N,  X,  F,  X,  M,  N,MI8,
+  /* 1 */   M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,
+  /* 2 */   M,  M,  M,  M,  M,  X,  M,  X,  M,  M,  M,  M,  M,  M,  M,  M,
+  /* 3 */   N,  N,  N,  N,  N,  N,  X,  N,E38,  X,E3A,  X,  X,  X,  X,  X,
+  /* 4 */   M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,
+  /* 5 */   M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,
+  /* 6 */   M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,
+  /* 7 */ MI8,MI8,MI8,MI8,  M,  M,  M,  N,  M,  M,  X,  X,  M,  M,  M,  M,
+  /* 8 */  RZ, RZ, RZ, RZ, RZ, RZ, RZ, RZ, RZ, RZ, RZ, RZ, RZ, RZ, RZ, RZ,
+  /* 9 */   M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,
+  /* A */   N,  N,  N,  M,MI8,  M,  X,  X,  N,  N,  N,  M,MI8,  M,  M,  M,
+  /* B */   M,  M,  M,  M,  M,  M,  M,  M,  M,  M,MI8,  M,  M,  M,  M,  M,
+  /* C */   M,  M,MI8,  M,MI8,MI8,MI8,  M,  N,  N,  N,  N,  N,  N,  N,  N,
+  /* D */   M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,
+  /* E */   M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,
+  /* F */   M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,
+};
+
+static constexpr ::std::uint8_t kOperandSizePrefix = 0x66;
+static constexpr ::std::uint8_t kAddressSizePrefix = 0x67;
+
+static constexpr ::std::uint8_t kJumpRel8Opcode = 0xEB;
+static constexpr ::std::uint8_t kJumpRel32Opcode = 0xE9;
+static constexpr ::std::uint8_t kJccRel8FirstOpcode = 0x70;
+static constexpr ::std::uint8_t kJccRel8LastOpcode = 0x7F;
+static constexpr ::std::uint8_t kJccRel32FirstOpcode = 0x80;
+
+static constexpr ::std::size_t kJumpRel32Size = 5;
+
+/**
+ * Returns the number of bytes following the ModR/M byte, including the
+ * SIB byte and displacement, or -1 if the bytes are truncated.
+ */
+static int GetModRmOperandSize(
+    const ::std::uint8_t* modrm,
+    ::std::size_t max_size,
+    bool is_address_size_16
+) noexcept {
+  ::std::uint8_t mod = modrm[0] >> 6;
+  ::std::uint8_t rm = modrm[0] & 0x7;
+
+  if (mod == 3) {
+    return 0;
+  }
+
+  if (is_address_size_16) {
+    if (mod == 0) {
+      return (rm == 6) ? 2 : 0;
+    }
+
+    return (mod == 1) ? 1 : 2;
+  }
+
+  int size = 0;
+  ::std::uint8_t base = rm;
+
+  if (rm == 4) {
+    if (max_size < 2) {
+      return -1;
+    }
+
+    size += 1;
+    base = modrm[1] & 0x7;
+  }
+
+  if (mod == 0) {
+    size += (base == 5) ? 4 : 0;
+  } else {
+    size += (mod == 1) ? 1 : 4;
+  }
+
+  return size;
+}
+
+template <typename T>
+static T ReadLittleEndian(const ::std::uint8_t* ptr) noexcept {
+  T value = 0;
+
+  for (::std::size_t i = 0; i < sizeof(T); i += 1) {
+    value |= static_cast<T>(ptr[i]) << (i * 8);
+  }
+
+  return value;
+}
+
+static void WriteRel32(::std::uint8_t* ptr, ::std::int32_t value) noexcept {
+  ::std::uint32_t unsigned_value = static_cast<::std::uint32_t>(value);
+
+  for (::std::size_t i = 0; i < sizeof(unsigned_value); i += 1) {
+    ptr[i] = (unsigned_value >> (i * 8)) & 0xFF;
+  }
+}
+
+/**
+ * Returns the branch destination of a decoded relative branch that is
+ * located at the specified address.
+ */
+static ::std::intptr_t GetBranchTarget(
+    const ::std::uint8_t* code,
+    ::std::intptr_t code_address,
+    const X86Instruction& instruction
+) noexcept {
+  const ::std::uint8_t* displacement = &code[instruction.relative_offset];
+  ::std::intptr_t next_address = code_address + instruction.length;
+
+  switch (instruction.relative_size) {
+    case 1: {
+      return next_address + static_cast<::std::int8_t>(displacement[0]);
+    }
+
+    case 2: {
+      return next_address
+          + static_cast<::std::int16_t>(
+              ReadLittleEndian<::std::uint16_t>(displacement)
+          );
+    }
+
+    default: {
+      return next_address
+          + static_cast<::std::int32_t>(
+              ReadLittleEndian<::std::uint32_t>(displacement)
+          );
+    }
+  }
+}
+
+/**
+ * Returns whether the decoded instruction, located at the specified
+ * address, is a relative branch into the middle of the range. A branch to
+ * the start of the range is allowed, since the patch keeps that boundary.
+ */
+static bool IsBranchIntoRange(
+    const ::std::uint8_t* code,
+    ::std::intptr_t code_address,
+    const X86Instruction& instruction,
+    ::std::intptr_t range_begin,
+    ::std::intptr_t range_end
+) noexcept {
+  if (instruction.relative_size == 0) {
+    return false;
+  }
+
+  ::std::intptr_t target = GetBranchTarget(code, code_address, instruction);
+
+  return target > range_begin && target < range_end;
+}
+
+} // namespace
+
+bool DecodeX86Instruction(
+    const ::std::uint8_t* code,
+    ::std::size_t max_size,
+    X86Instruction* instruction
+) noexcept {
+  if (max_size > kX86MaxInstructionLength) {
+    max_size = kX86MaxInstructionLength;
+  }
+
+  bool is_operand_size_16 = false;
+  bool is_address_size_16 = false;
+  bool is_two_byte_opcode = false;
+  ::std::size_t i = 0;
+
+  // Prefixes.
+  for (; i < max_size; i += 1) {
+    if ((kOneByteOpcodeFlags[code[i]] & kPrefix) != kPrefix) {
+      break;
+    }
+
+    if (code[i] == kOperandSizePrefix) {
+      is_operand_size_16 = true;
+    } else if (code[i] == kAddressSizePrefix) {
+      is_address_size_16 = true;
+    }
+  }
+
+  if (i >= max_size) {
+    return false;
+  }
+
+  instruction->opcode_offset = i;
+  instruction->relative_offset = 0;
+  instruction->relative_size = 0;
+
+  // Opcode.
+  ::std::uint8_t opcode = code[i];
+  ::std::uint16_t flags = kOneByteOpcodeFlags[opcode];
+  i += 1;
+
+  if ((flags & kEscape) == kEscape) {
+    if (i >= max_size) {
+      return false;
+    }
+
+    opcode = code[i];
+    flags = kTwoByteOpcodeFlags[opcode];
+    is_two_byte_opcode = true;
+    i += 1;
+
+    if ((flags & (kEscape38 | kEscape3A)) != 0) {
+      if (i >= max_size) {
+        return false;
+      }
+
+      flags = ((flags & kEscape3A) == kEscape3A)
+          ? (kModRm | kImm8)
+          : kModRm;
+      i += 1;
+    }
+  }
+
+  if ((flags & kInvalid) == kInvalid) {
+    return false;
+  }
+
+  // ModR/M, SIB and displacement.
+  ::std::size_t immediate_size = 0;
+
+  if ((flags & kModRm) == kModRm) {
+    if (i >= max_size) {
+      return false;
+    }
+
+    int operand_size = GetModRmOperandSize(
+        &code[i],
+        max_size - i,
+        is_address_size_16
+    );
+
+    if (operand_size < 0) {
+      return false;
+    }
+
+    ::std::uint8_t modrm_reg = (code[i] >> 3) & 0x7;
+
+    // TEST is the only group 3 encoding with an immediate.
+    if ((flags & kGroup3) == kGroup3 && modrm_reg < 2) {
+      flags |= (opcode == 0xF6) ? kImm8 : kImmZ;
+    }
+
+    // Indirect JMP is FF /4 and FF /5.
+    if (!is_two_byte_opcode
+        && opcode == 0xFF
+        && (modrm_reg == 4 || modrm_reg == 5)) {
+      flags |= kFlowEnd;
+    }
+
+    i += 1 + operand_size;
+  }
+
+  // Immediates and relative displacements.
+  if ((flags & kImm8) == kImm8) {
+    immediate_size += 1;
+  }
+
+  if ((flags & kImm16) == kImm16) {
+    immediate_size += 2;
+  }
+
+  if ((flags & kImmZ) == kImmZ) {
+    immediate_size += is_operand_size_16 ? 2 : 4;
+  }
+
+  if ((flags & kMoffs) == kMoffs) {
+    immediate_size += is_address_size_16 ? 2 : 4;
+  }
+
+  if ((flags & kFarPointer) == kFarPointer) {
+    immediate_size += is_operand_size_16 ? 4 : 6;
+  }
+
+  if ((flags & (kRel8 | kRelZ)) != 0) {
+    instruction->relative_offset = i;
+    instruction->relative_size = ((flags & kRel8) == kRel8)
+        ? 1
+        : (is_operand_size_16 ? 2 : 4);
+    immediate_size += instruction->relative_size;
+  }
+
+  i += immediate_size;
+
+  if (i > max_size) {
+    return false;
+  }
+
+  instruction->length = i;
+  instruction->is_flow_end = ((flags & kFlowEnd) == kFlowEnd);
+
+  return true;
+}
+
+::std::size_t GetX86PatchSize(
+    const ::std::uint8_t* code,
+    ::std::size_t min_size
+) noexcept {
+  ::std::size_t patch_size = 0;
+
+  while (patch_size < min_size) {
+    X86Instruction instruction;
+
+    if (!DecodeX86Instruction(
+        &code[patch_size],
+        kX86MaxInstructionLength,
+        &instruction
+    )) {
+      return 0;
+    }
+
+    patch_size += instruction.length;
+
+    // Code after a return or jump may be padding or another function.
+    if (instruction.is_flow_end && patch_size < min_size) {
+      return 0;
+    }
+  }
+
+  return patch_size;
+}
+
+bool IsX86PatchRangeBranchTarget(
+    const ::std::uint8_t* code,
+    ::std::intptr_t code_address,
+    ::std::size_t patch_size,
+    ::std::size_t scan_before_size,
+    ::std::size_t scan_after_size
+) noexcept {
+  ::std::intptr_t patch_begin = code_address;
+  ::std::intptr_t patch_end = code_address + patch_size;
+  ::std::size_t scan_end = patch_size + scan_after_size;
+
+  for (::std::size_t offset = 0; offset < scan_end; ) {
+    X86Instruction instruction;
+
+    if (!DecodeX86Instruction(
+        &code[offset],
+        kX86MaxInstructionLength,
+        &instruction
+    )) {
+      break;
+    }
+
+    if (IsBranchIntoRange(
+        &code[offset],
+        code_address + offset,
+        instruction,
+        patch_begin,
+        patch_end
+    )) {
+      return true;
+    }
+
+    offset += instruction.length;
+
+    if (instruction.is_flow_end && offset >= patch_size) {
+      break;
+    }
+  }
+
+  // Instructions cannot be decoded backward, so try each start in the
+  // window before the patch, farthest first. The first start whose
+  // instructions end exactly at the patch is taken to be on the real
+  // instruction boundaries, since a misaligned start usually fails to
+  // decode or overshoots the patch.
+  for (::std::size_t start = scan_before_size; start > 0; start -= 1) {
+    const ::std::uint8_t* window = code - start;
+    ::std::intptr_t window_address = code_address - start;
+
+    ::std::size_t offset = 0;
+    bool is_branch_into_range = false;
+
+    while (offset < start) {
+      X86Instruction instruction;
+
+      if (!DecodeX86Instruction(
+          &window[offset],
+          kX86MaxInstructionLength,
+          &instruction
+      )) {
+        break;
+      }
+
+      if (IsBranchIntoRange(
+          &window[offset],
+          window_address + offset,
+          instruction,
+          patch_begin,
+          patch_end
+      )) {
+        is_branch_into_range = true;
+      }
+
+      offset += instruction.length;
+    }
+
+    if (offset == start) {
+      return is_branch_into_range;
+    }
+  }
+
+  return false;
+}
+
+::std::size_t RelocateX86Instructions(
+    const ::std::uint8_t* source,
+    ::std::intptr_t source_address,
+    ::std::size_t source_size,
+    ::std::uint8_t* destination,
+    ::std::intptr_t destination_address,
+    ::std::size_t destination_capacity
+) noexcept {
+  ::std::size_t source_offset = 0;
+  ::std::size_t destination_offset = 0;
+
+  while (source_offset < source_size) {
+    X86Instruction instruction;
+
+    if (!DecodeX86Instruction(
+        &source[source_offset],
+        source_size - source_offset,
+        &instruction
+    )) {
+      return 0;
+    }
+
+    const ::std::uint8_t* source_instruction = &source[source_offset];
+    ::std::uint8_t* destination_instruction =
+        &destination[destination_offset];
+
+    if (instruction.relative_size == 0) {
+      if (destination_offset + instruction.length > destination_capacity) {
+        return 0;
+      }
+
+      ::std::memcpy(
+          destination_instruction,
+          source_instruction,
+          instruction.length
+      );
+
+      source_offset += instruction.length;
+      destination_offset += instruction.length;
+
+      continue;
+    }
+
+    // 16-bit displacements cannot reach arbitrary trampoline addresses.
+    if (instruction.relative_size == 2) {
+      return 0;
+    }
+
+    ::std::intptr_t target = GetBranchTarget(
+        source_instruction,
+        source_address + source_offset,
+        instruction
+    );
+
+    // Branches into the relocated range would land in the patched bytes.
+    ::std::intptr_t source_end = source_address + source_size;
+
+    if (target >= source_address && target < source_end) {
+      return 0;
+    }
+
+    ::std::uint8_t opcode = source_instruction[instruction.opcode_offset];
+    ::std::size_t prefix_size = instruction.opcode_offset;
+    ::std::size_t relocated_size;
+    ::std::size_t relocated_opcode_size;
+
+    if (instruction.relative_size == 4) {
+      relocated_size = instruction.length;
+      relocated_opcode_size = instruction.relative_offset - prefix_size;
+    } else if (opcode == kJumpRel8Opcode) {
+      relocated_size = prefix_size + kJumpRel32Size;
+      relocated_opcode_size = 1;
+    } else if (opcode >= kJccRel8FirstOpcode
+        && opcode <= kJccRel8LastOpcode) {
+      relocated_size = prefix_size + kJumpRel32Size + 1;
+      relocated_opcode_size = 2;
+    } else {
+      // LOOP and JECXZ have no rel32 form.
+      return 0;
+    }
+
+    if (destination_offset + relocated_size > destination_capacity) {
+      return 0;
+    }
+
+    ::std::memcpy(destination_instruction, source_instruction, prefix_size);
+
+    if (instruction.relative_size == 4) {
+      ::std::memcpy(
+          &destination_instruction[prefix_size],
+          &source_instruction[prefix_size],
+          relocated_opcode_size
+      );
+    } else if (opcode == kJumpRel8Opcode) {
+      destination_instruction[prefix_size] = kJumpRel32Opcode;
+    } else {
+      destination_instruction[prefix_size] = 0x0F;
+      destination_instruction[prefix_size + 1] =
+          kJccRel32FirstOpcode + (opcode - kJccRel8FirstOpcode);
+    }
+
+    ::std::intptr_t next_address =
+        destination_address + destination_offset + relocated_size;
+
+    WriteRel32(
+        &destination_instruction[prefix_size + relocated_opcode_size],
+        static_cast<::std::int32_t>(target - next_address)
+    );
+
+    source_offset += instruction.length;
+    destination_offset += relocated_size;
+  }
+
+  return destination_offset;
+}
+
+::std::size_t BuildX86Trampoline(
+    const ::std::uint8_t* source,
+    ::std::intptr_t source_address,
+    ::std::size_t source_size,
+    ::std::uint8_t* destination,
+    ::std::intptr_t destination_address,
+    ::std::size_t destination_capacity
+) noexcept {
+  if (destination_capacity < kJumpRel32Size) {
+    return 0;
+  }
+
+  ::std::size_t relocated_size = RelocateX86Instructions(
+      source,
+      source_address,
+      source_size,
+      destination,
+      destination_address,
+      destination_capacity - kJumpRel32Size
+  );
+
+  if (relocated_size == 0) {
+    return 0;
+  }
+
+  ::std::intptr_t jump_address = destination_address + relocated_size;
+  ::std::intptr_t return_address = source_address + source_size;
+
+  destination[relocated_size] = kJumpRel32Opcode;
+  WriteRel32(
+      &destination[relocated_size + 1],
+      static_cast<::std::int32_t>(
+          return_address - (jump_address + kJumpRel32Size)
+      )
+  );
+
+  return relocated_size + kJumpRel32Size;
+}
+
+} // namespace mapi
@@ -0,0 +1,150 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#ifndef SGD2MAPI_CXX_BACKEND_X86_INSTRUCTION_DECODER_HPP_
+#define SGD2MAPI_CXX_BACKEND_X86_INSTRUCTION_DECODER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace mapi {
+
+/**
+ * The maximum length of a single x86 instruction, in bytes.
+ */
+constexpr const ::std::size_t kX86MaxInstructionLength = 15;
+
+/**
+ * The decoded layout of a single x86-32 instruction. Only the information
+ * required to size and relocate patches is decoded.
+ */
+struct X86Instruction {
+  ::std::size_t length;
+
+  // Offset of the first opcode byte, after any prefixes.
+  ::std::size_t opcode_offset;
+
+  // Offset and size of the relative branch displacement. The size is 0 if
+  // the instruction is not a relative branch.
+  ::std::size_t relative_offset;
+  ::std::size_t relative_size;
+
+  // Set if execution never falls through to the next instruction, such as
+  // for returns and unconditional jumps.
+  bool is_flow_end;
+};
+
+/**
+ * Decodes the instruction at the start of the code, reading no more than
+ * max_size bytes. Returns false if the bytes do not form a valid
+ * instruction within that size.
+ */
+bool DecodeX86Instruction(
+    const ::std::uint8_t* code,
+    ::std::size_t max_size,
+    X86Instruction* instruction
+) noexcept;
+
+/**
+ * Returns the smallest size that is at least min_size and ends on an
+ * instruction boundary. Returns 0 if an instruction in the range could not
+ * be decoded, or if an instruction ends the flow of execution before
+ * min_size is reached.
+ */
+::std::size_t GetX86PatchSize(
+    const ::std::uint8_t* code,
+    ::std::size_t min_size
+) noexcept;
+
+/**
+ * Returns whether a relative branch near the patch range jumps into the
+ * middle of it. Overwriting such a range would corrupt the branch's
+ * destination. The patch range and the scan_after_size bytes following it
+ * are decoded forward from the patch. The scan_before_size bytes before
+ * it cannot be decoded reliably, since x86 instructions have no backward
+ * boundaries, so back edges are found on a best-effort basis. Branches
+ * from farther away are not found.
+ */
+bool IsX86PatchRangeBranchTarget(
+    const ::std::uint8_t* code,
+    ::std::intptr_t code_address,
+    ::std::size_t patch_size,
+    ::std::size_t scan_before_size,
+    ::std::size_t scan_after_size
+) noexcept;
+
+/**
+ * Copies the whole instructions in the source range into the destination,
+ * which will be executed at destination_address. Relative branches are
+ * rewritten to reach their original targets, and short branches are
+ * widened to rel32. Returns the number of bytes written, or 0 if the code
+ * cannot be relocated or does not fit in the destination.
+ */
+::std::size_t RelocateX86Instructions(
+    const ::std::uint8_t* source,
+    ::std::intptr_t source_address,
+    ::std::size_t source_size,
+    ::std::uint8_t* destination,
+    ::std::intptr_t destination_address,
+    ::std::size_t destination_capacity
+) noexcept;
+
+/**
+ * Builds a trampoline that executes the relocated source instructions, then
+ * jumps back to the instruction following the source range. Returns the
+ * size of the trampoline, or 0 if it could not be built.
+ */
+::std::size_t BuildX86Trampoline(
+    const ::std::uint8_t* source,
+    ::std::intptr_t source_address,
+    ::std::size_t source_size,
+    ::std::uint8_t* destination,
+    ::std::intptr_t destination_address,
+    ::std::size_t destination_capacity
+) noexcept;
+
+} // namespace mapi
+
+#endif // SGD2MAPI_CXX_BACKEND_X86_INSTRUCTION_DECODER_HPP_
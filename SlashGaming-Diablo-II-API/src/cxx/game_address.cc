@@ -53,6 +53,7 @@
 #include <mdc/error/exit_on_error.hpp>
 #include <mdc/wchar_t/filew.h>
 #include <mdc/wchar_t/wide_decoding.hpp>
+#include "backend/game_address_table.hpp"
 #include "backend/game_library.hpp"
 
 namespace mapi {
@@ -76,6 +77,15 @@ GameAddress GameAddress::FromExportedName(
 
   const GameLibrary& game_library = GameLibrary::GetGameLibrary(path);
 
+  ::std::uint32_t export_rva = game_library.pe_image().FindExportByName(
+      exported_name
+  );
+
+  if (export_rva != 0) {
+    return GameAddress(game_library.base_address() + export_rva);
+  }
+
+  // Forwarded exports and malformed images are left to the OS loader.
   FARPROC raw_address = GetProcAddress(
       reinterpret_cast<HMODULE>(game_library.base_address()),
       exported_name
@@ -148,6 +158,15 @@ GameAddress GameAddress::FromOrdinal(
 ) {
   const GameLibrary& game_library = GameLibrary::GetGameLibrary(path);
 
+  ::std::uint32_t export_rva = game_library.pe_image().FindExportByOrdinal(
+      static_cast<::std::uint16_t>(ordinal)
+  );
+
+  if (export_rva != 0) {
+    return GameAddress(game_library.base_address() + export_rva);
+  }
+
+  // Forwarded exports and malformed images are left to the OS loader.
   FARPROC func_address = GetProcAddress(
       reinterpret_cast<HMODULE>(game_library.base_address()),
       reinterpret_cast<const char*>(ordinal)
@@ -172,4 +191,12 @@ GameAddress GameAddress::FromOrdinal(
   return GameAddress(reinterpret_cast<std::intptr_t>(func_address));
 }
 
+void ResolveAllAddresses(::d2::DefaultLibrary library) {
+  ResolveGameAddresses(library);
+}
+
+void ResolveAllAddresses() {
+  ResolveGameAddresses();
+}
+
 } // namespace mapi
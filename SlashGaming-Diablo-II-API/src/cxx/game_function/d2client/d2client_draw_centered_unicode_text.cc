@@ -54,6 +54,7 @@
 #include "../../../asm_x86_macro.h"
 #include "../../backend/game_address_table.hpp"
 #include "../../backend/game_function/fastcall_function.hpp"
+#include "../../backend/game_function/version_dispatch.hpp"
 
 namespace d2::d2client {
 namespace {
@@ -100,6 +101,63 @@ static const mapi::GameAddress& GetGameAddress() {
   return game_address;
 }
 
+static void DrawCenteredUnicodeText_1_00_Adapter(
+    int left,
+    int position_y,
+    const UnicodeChar* text,
+    int right,
+    TextColor text_color
+) {
+  DrawCenteredUnicodeText_1_00(
+      left,
+      position_y,
+      reinterpret_cast<const UnicodeChar_1_00*>(text),
+      right,
+      static_cast<TextColor_1_00>(text_color)
+  );
+}
+
+static void DrawCenteredUnicodeText_1_12A_Adapter(
+    int left,
+    int position_y,
+    const UnicodeChar* text,
+    int right,
+    TextColor text_color
+) {
+  DrawCenteredUnicodeText_1_12A(
+      left,
+      position_y,
+      reinterpret_cast<const UnicodeChar_1_00*>(text),
+      right,
+      static_cast<TextColor_1_00>(text_color)
+  );
+}
+
+struct DrawCenteredUnicodeTextDispatchTable {
+  using Function = void(int, int, const UnicodeChar*, int, TextColor);
+
+  static constexpr mapi::VersionedFunction<Function> kFunctions[] = {
+      {
+          GameVersion::kBeta1_02,
+          GameVersion::k1_10,
+          &DrawCenteredUnicodeText_1_00_Adapter
+      },
+      {
+          GameVersion::k1_11,
+          GameVersion::k1_13D,
+          &DrawCenteredUnicodeText_1_12A_Adapter
+      },
+      {
+          GameVersion::kClassic1_14A,
+          GameVersion::kLod1_14D,
+          &DrawCenteredUnicodeText_1_00_Adapter
+      }
+  };
+};
+
+using DrawCenteredUnicodeTextDispatch =
+    mapi::VersionDispatch<DrawCenteredUnicodeTextDispatchTable>;
+
 } // namespace
 
 void DrawCenteredUnicodeText(
@@ -109,29 +167,13 @@ void DrawCenteredUnicodeText(
     int right,
     TextColor text_color
 ) {
-  int text_color_game_value = text_color::ToGameValue(text_color);
-
-  GameVersion running_game_version = ::d2::game_version::GetRunning();
-
-  if (running_game_version <= GameVersion::k1_10
-      || running_game_version >= GameVersion::kClassic1_14A) {
-    DrawCenteredUnicodeText_1_00(
-        left,
-        position_y,
-        reinterpret_cast<const UnicodeChar_1_00*>(text),
-        right,
-        static_cast<TextColor_1_00>(text_color)
-    );
-  } else /* if (running_game_version >= GameVersion::k1_11
-      && running_game_version <= GameVersion::k1_13D) */ {
-    DrawCenteredUnicodeText_1_12A(
-        left,
-        position_y,
-        reinterpret_cast<const UnicodeChar_1_00*>(text),
-        right,
-        static_cast<TextColor_1_00>(text_color)
-    );
-  }
+  DrawCenteredUnicodeTextDispatch::Call(
+      left,
+      position_y,
+      text,
+      right,
+      text_color
+  );
 }
 
 void DrawCenteredUnicodeText_1_00(
@@ -141,7 +183,7 @@ void DrawCenteredUnicodeText_1_00(
     std::int32_t right,
     TextColor_1_00 text_color
 ) {
-  mapi::CallFastcallFunction(
+  mapi::CallFastcallFunction<void>(
       GetGameAddress().raw_address(),
       left,
       position_y,
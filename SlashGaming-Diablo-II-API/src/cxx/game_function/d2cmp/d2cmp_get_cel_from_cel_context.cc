@@ -56,6 +56,7 @@
 #include "../../../asm_x86_macro.h"
 #include "../../backend/game_address_table.hpp"
 #include "../../backend/game_function/stdcall_function.hpp"
+#include "../../backend/game_function/version_dispatch.hpp"
 
 namespace d2::d2cmp {
 namespace {
@@ -69,69 +70,85 @@ static const mapi::GameAddress& GetGameAddress() {
   return game_address;
 }
 
+static Cel* GetCelFromCelContext_1_00_Adapter(CelContext* cel_context) {
+  auto* actual_cel_context = reinterpret_cast<CelContext_1_00*>(cel_context);
+
+  return reinterpret_cast<Cel*>(
+      GetCelFromCelContext_1_00(actual_cel_context)
+  );
+}
+
+static Cel* GetCelFromCelContext_1_12A_Adapter(CelContext* cel_context) {
+  auto* actual_cel_context = reinterpret_cast<CelContext_1_12A*>(cel_context);
+
+  return reinterpret_cast<Cel*>(
+      GetCelFromCelContext_1_12A(actual_cel_context)
+  );
+}
+
+static Cel* GetCelFromCelContext_1_13C_Adapter(CelContext* cel_context) {
+  auto* actual_cel_context = reinterpret_cast<CelContext_1_13C*>(cel_context);
+
+  return reinterpret_cast<Cel*>(
+      GetCelFromCelContext_1_13C(actual_cel_context)
+  );
+}
+
+struct GetCelFromCelContextDispatchTable {
+  using Function = Cel*(CelContext*);
+
+  static constexpr mapi::VersionedFunction<Function> kFunctions[] = {
+      {
+          GameVersion::kBeta1_02,
+          GameVersion::k1_10,
+          &GetCelFromCelContext_1_00_Adapter
+      },
+      {
+          GameVersion::k1_12A,
+          GameVersion::k1_12A,
+          &GetCelFromCelContext_1_12A_Adapter
+      },
+      {
+          GameVersion::k1_11,
+          GameVersion::kLod1_14D,
+          &GetCelFromCelContext_1_13C_Adapter
+      }
+  };
+};
+
+using GetCelFromCelContextDispatch =
+    mapi::VersionDispatch<GetCelFromCelContextDispatchTable>;
+
 } // namespace
 
 Cel* GetCelFromCelContext(CelContext* cel_context) {
-  GameVersion running_game_version = ::d2::game_version::GetRunning();
-
-  if (running_game_version <= GameVersion::k1_10) {
-    auto* actual_cel_context = reinterpret_cast<CelContext_1_00*>(
-        cel_context
-    );
-
-    return reinterpret_cast<Cel*>(
-        GetCelFromCelContext_1_00(actual_cel_context)
-    );
-  } else if (running_game_version == GameVersion::k1_12A) {
-    auto* actual_cel_context = reinterpret_cast<CelContext_1_12A*>(
-        cel_context
-    );
-
-    return reinterpret_cast<Cel*>(
-        GetCelFromCelContext_1_12A(actual_cel_context)
-    );
-  } else /* if (running_game_version >= GameVersion::k1_13C
-      && running_game_version <= GameVersion::kLod1_14D) */ {
-    auto* actual_cel_context = reinterpret_cast<CelContext_1_13C*>(
-        cel_context
-    );
-
-    return reinterpret_cast<Cel*>(
-        GetCelFromCelContext_1_13C(actual_cel_context)
-    );
-  }
+  return GetCelFromCelContextDispatch::Call(cel_context);
 }
 
 Cel_1_00* GetCelFromCelContext_1_00(
     CelContext_1_00* cel_context
 ) {
-  return reinterpret_cast<Cel_1_00*>(
-      mapi::CallStdcallFunction(
-          GetGameAddress().raw_address(),
-          cel_context
-      )
+  return mapi::CallStdcallFunction<Cel_1_00*>(
+      GetGameAddress().raw_address(),
+      cel_context
   );
 }
 
 Cel_1_00* GetCelFromCelContext_1_12A(
     CelContext_1_12A* cel_context
 ) {
-  return reinterpret_cast<Cel_1_00*>(
-      mapi::CallStdcallFunction(
-          GetGameAddress().raw_address(),
-          cel_context
-      )
+  return mapi::CallStdcallFunction<Cel_1_00*>(
+      GetGameAddress().raw_address(),
+      cel_context
   );
 }
 
 Cel_1_00* GetCelFromCelContext_1_13C(
     CelContext_1_13C* cel_context
 ) {
-  return reinterpret_cast<Cel_1_00*>(
-      mapi::CallStdcallFunction(
-          GetGameAddress().raw_address(),
-          cel_context
-      )
+  return mapi::CallStdcallFunction<Cel_1_00*>(
+      GetGameAddress().raw_address(),
+      cel_context
   );
 }
 
@@ -54,6 +54,7 @@
 #include "../../../asm_x86_macro.h"
 #include "../../backend/game_address_table.hpp"
 #include "../../backend/game_function/stdcall_function.hpp"
+#include "../../backend/game_function/version_dispatch.hpp"
 
 namespace d2::d2common {
 namespace {
@@ -67,6 +68,49 @@ static const mapi::GameAddress& GetGameAddress() {
   return game_address;
 }
 
+static void GetGlobalBeltRecord_1_00_Adapter(
+    unsigned int belt_record_index,
+    unsigned int inventory_arrange_mode,
+    BeltRecord* out_belt_record
+) {
+  GetGlobalBeltRecord_1_00(
+      belt_record_index,
+      reinterpret_cast<BeltRecord_1_00*>(out_belt_record)
+  );
+}
+
+static void GetGlobalBeltRecord_1_07_Adapter(
+    unsigned int belt_record_index,
+    unsigned int inventory_arrange_mode,
+    BeltRecord* out_belt_record
+) {
+  GetGlobalBeltRecord_1_07(
+      belt_record_index,
+      inventory_arrange_mode,
+      reinterpret_cast<BeltRecord_1_00*>(out_belt_record)
+  );
+}
+
+struct GetGlobalBeltRecordDispatchTable {
+  using Function = void(unsigned int, unsigned int, BeltRecord*);
+
+  static constexpr mapi::VersionedFunction<Function> kFunctions[] = {
+      {
+          GameVersion::kBeta1_02,
+          GameVersion::k1_06B,
+          &GetGlobalBeltRecord_1_00_Adapter
+      },
+      {
+          GameVersion::k1_07Beta,
+          GameVersion::kLod1_14D,
+          &GetGlobalBeltRecord_1_07_Adapter
+      }
+  };
+};
+
+using GetGlobalBeltRecordDispatch =
+    mapi::VersionDispatch<GetGlobalBeltRecordDispatchTable>;
+
 } // namespace
 
 void GetGlobalBeltRecord(
@@ -74,27 +118,18 @@ void GetGlobalBeltRecord(
     unsigned int inventory_arrange_mode,
     BeltRecord* out_belt_record
 ) {
-  GameVersion running_game_version = ::d2::game_version::GetRunning();
-
-  if (running_game_version <= GameVersion::k1_06B) {
-    GetGlobalBeltRecord_1_00(
-        belt_record_index,
-        reinterpret_cast<BeltRecord_1_00*>(out_belt_record)
-    );
-  } else /* if (running_game_version >= GameVersion::k1_07Beta) */ {
-    GetGlobalBeltRecord_1_07(
-        belt_record_index,
-        inventory_arrange_mode,
-        reinterpret_cast<BeltRecord_1_00*>(out_belt_record)
-    );
-  }
+  GetGlobalBeltRecordDispatch::Call(
+      belt_record_index,
+      inventory_arrange_mode,
+      out_belt_record
+  );
 }
 
 void GetGlobalBeltRecord_1_00(
     std::uint32_t belt_record_index,
     BeltRecord_1_00* out_belt_record
 ) {
-  mapi::CallStdcallFunction(
+  mapi::CallStdcallFunction<void>(
       GetGameAddress().raw_address(),
       belt_record_index,
       out_belt_record
@@ -106,7 +141,7 @@ void GetGlobalBeltRecord_1_07(
     std::uint32_t inventory_arrange_mode,
     BeltRecord_1_00* out_belt_record
 ) {
-  mapi::CallStdcallFunction(
+  mapi::CallStdcallFunction<void>(
       GetGameAddress().raw_address(),
       belt_record_index,
       inventory_arrange_mode,
@@ -54,6 +54,7 @@
 #include "../../../asm_x86_macro.h"
 #include "../../backend/game_address_table.hpp"
 #include "../../backend/game_function/stdcall_function.hpp"
+#include "../../backend/game_function/version_dispatch.hpp"
 
 namespace d2::d2common {
 namespace {
@@ -67,6 +68,58 @@ static const mapi::GameAddress& GetGameAddress() {
   return game_address;
 }
 
+static void GetGlobalBeltSlotPosition_1_00_Adapter(
+    unsigned int belt_record_index,
+    unsigned int inventory_arrange_mode,
+    PositionalRectangle* out_belt_slot,
+    unsigned int belt_slot_index
+) {
+  GetGlobalBeltSlotPosition_1_00(
+      belt_record_index,
+      reinterpret_cast<PositionalRectangle_1_00*>(out_belt_slot),
+      belt_slot_index
+  );
+}
+
+static void GetGlobalBeltSlotPosition_1_07_Adapter(
+    unsigned int belt_record_index,
+    unsigned int inventory_arrange_mode,
+    PositionalRectangle* out_belt_slot,
+    unsigned int belt_slot_index
+) {
+  GetGlobalBeltSlotPosition_1_07(
+      belt_record_index,
+      inventory_arrange_mode,
+      reinterpret_cast<PositionalRectangle_1_00*>(out_belt_slot),
+      belt_slot_index
+  );
+}
+
+struct GetGlobalBeltSlotPositionDispatchTable {
+  using Function = void(
+      unsigned int,
+      unsigned int,
+      PositionalRectangle*,
+      unsigned int
+  );
+
+  static constexpr mapi::VersionedFunction<Function> kFunctions[] = {
+      {
+          GameVersion::kBeta1_02,
+          GameVersion::k1_06B,
+          &GetGlobalBeltSlotPosition_1_00_Adapter
+      },
+      {
+          GameVersion::k1_07Beta,
+          GameVersion::kLod1_14D,
+          &GetGlobalBeltSlotPosition_1_07_Adapter
+      }
+  };
+};
+
+using GetGlobalBeltSlotPositionDispatch =
+    mapi::VersionDispatch<GetGlobalBeltSlotPositionDispatchTable>;
+
 } // namespace
 
 void GetGlobalBeltSlotPosition(
@@ -75,22 +128,12 @@ void GetGlobalBeltSlotPosition(
     PositionalRectangle* out_belt_slot,
     unsigned int belt_slot_index
 ) {
-  GameVersion running_game_version = ::d2::game_version::GetRunning();
-
-  if (running_game_version <= GameVersion::k1_06B) {
-    GetGlobalBeltSlotPosition_1_00(
-        belt_record_index,
-        reinterpret_cast<PositionalRectangle_1_00*>(out_belt_slot),
-        belt_slot_index
-    );
-  } else /* if (running_game_version >= GameVersion::k1_07Beta) */ {
-    GetGlobalBeltSlotPosition_1_07(
-        belt_record_index,
-        inventory_arrange_mode,
-        reinterpret_cast<PositionalRectangle_1_00*>(out_belt_slot),
-        belt_slot_index
-    );
-  }
+  GetGlobalBeltSlotPositionDispatch::Call(
+      belt_record_index,
+      inventory_arrange_mode,
+      out_belt_slot,
+      belt_slot_index
+  );
 }
 
 void GetGlobalBeltSlotPosition_1_00(
@@ -98,7 +141,7 @@ void GetGlobalBeltSlotPosition_1_00(
     PositionalRectangle_1_00* out_belt_slot,
     std::uint32_t belt_slot_index
 ) {
-  mapi::CallStdcallFunction(
+  mapi::CallStdcallFunction<void>(
       GetGameAddress().raw_address(),
       belt_record_index,
       out_belt_slot,
@@ -112,7 +155,7 @@ void GetGlobalBeltSlotPosition_1_07(
     PositionalRectangle_1_00* out_belt_slot,
     std::uint32_t belt_slot_index
 ) {
-  mapi::CallStdcallFunction(
+  mapi::CallStdcallFunction<void>(
       GetGameAddress().raw_address(),
       belt_record_index,
       inventory_arrange_mode,
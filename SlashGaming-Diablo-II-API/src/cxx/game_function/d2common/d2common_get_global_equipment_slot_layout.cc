@@ -54,6 +54,7 @@
 #include "../../../asm_x86_macro.h"
 #include "../../backend/game_address_table.hpp"
 #include "../../backend/game_function/stdcall_function.hpp"
+#include "../../backend/game_function/version_dispatch.hpp"
 
 namespace d2::d2common {
 namespace {
@@ -67,6 +68,58 @@ static const mapi::GameAddress& GetGameAddress() {
   return game_address;
 }
 
+static void GetGlobalEquipmentSlotLayout_1_00_Adapter(
+    unsigned int inventory_record_index,
+    unsigned int inventory_arrange_mode,
+    EquipmentLayout* out_equipment_slot_layout,
+    unsigned int equipment_slot_index
+) {
+  GetGlobalEquipmentSlotLayout_1_00(
+      inventory_record_index,
+      reinterpret_cast<EquipmentLayout_1_00*>(out_equipment_slot_layout),
+      equipment_slot_index
+  );
+}
+
+static void GetGlobalEquipmentSlotLayout_1_07_Adapter(
+    unsigned int inventory_record_index,
+    unsigned int inventory_arrange_mode,
+    EquipmentLayout* out_equipment_slot_layout,
+    unsigned int equipment_slot_index
+) {
+  GetGlobalEquipmentSlotLayout_1_07(
+      inventory_record_index,
+      inventory_arrange_mode,
+      reinterpret_cast<EquipmentLayout_1_00*>(out_equipment_slot_layout),
+      equipment_slot_index
+  );
+}
+
+struct GetGlobalEquipmentSlotLayoutDispatchTable {
+  using Function = void(
+      unsigned int,
+      unsigned int,
+      EquipmentLayout*,
+      unsigned int
+  );
+
+  static constexpr mapi::VersionedFunction<Function> kFunctions[] = {
+      {
+          GameVersion::kBeta1_02,
+          GameVersion::k1_06B,
+          &GetGlobalEquipmentSlotLayout_1_00_Adapter
+      },
+      {
+          GameVersion::k1_07Beta,
+          GameVersion::kLod1_14D,
+          &GetGlobalEquipmentSlotLayout_1_07_Adapter
+      }
+  };
+};
+
+using GetGlobalEquipmentSlotLayoutDispatch =
+    mapi::VersionDispatch<GetGlobalEquipmentSlotLayoutDispatchTable>;
+
 } // namespace
 
 void GetGlobalEquipmentSlotLayout(
@@ -75,22 +128,12 @@ void GetGlobalEquipmentSlotLayout(
     EquipmentLayout* out_equipment_slot_layout,
     unsigned int equipment_slot_index
 ) {
-  GameVersion running_game_version = ::d2::game_version::GetRunning();
-
-  if (running_game_version <= GameVersion::k1_06B) {
-    GetGlobalEquipmentSlotLayout_1_00(
-        inventory_record_index,
-        reinterpret_cast<EquipmentLayout_1_00*>(out_equipment_slot_layout),
-        equipment_slot_index
-    );
-  } else /* if (running_game_version >= GameVersion::k1_07Beta) */ {
-    GetGlobalEquipmentSlotLayout_1_07(
-        inventory_record_index,
-        inventory_arrange_mode,
-        reinterpret_cast<EquipmentLayout_1_00*>(out_equipment_slot_layout),
-        equipment_slot_index
-    );
-  }
+  GetGlobalEquipmentSlotLayoutDispatch::Call(
+      inventory_record_index,
+      inventory_arrange_mode,
+      out_equipment_slot_layout,
+      equipment_slot_index
+  );
 }
 
 void GetGlobalEquipmentSlotLayout_1_00(
@@ -98,7 +141,7 @@ void GetGlobalEquipmentSlotLayout_1_00(
     EquipmentLayout_1_00* out_equipment_slot_layout,
     std::uint32_t equipment_slot_index
 ) {
-  mapi::CallStdcallFunction(
+  mapi::CallStdcallFunction<void>(
       GetGameAddress().raw_address(),
       inventory_record_index,
       out_equipment_slot_layout,
@@ -112,7 +155,7 @@ void GetGlobalEquipmentSlotLayout_1_07(
     EquipmentLayout_1_00* out_equipment_slot_layout,
     std::uint32_t equipment_slot_index
 ) {
-  mapi::CallStdcallFunction(
+  mapi::CallStdcallFunction<void>(
       GetGameAddress().raw_address(),
       inventory_record_index,
       inventory_arrange_mode,
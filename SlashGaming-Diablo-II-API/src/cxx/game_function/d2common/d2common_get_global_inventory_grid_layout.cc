@@ -54,6 +54,7 @@
 #include "../../../asm_x86_macro.h"
 #include "../../backend/game_address_table.hpp"
 #include "../../backend/game_function/stdcall_function.hpp"
+#include "../../backend/game_function/version_dispatch.hpp"
 
 namespace d2::d2common {
 namespace {
@@ -67,6 +68,49 @@ static const mapi::GameAddress& GetGameAddress() {
   return game_address;
 }
 
+static void GetGlobalInventoryGridLayout_1_00_Adapter(
+    unsigned int inventory_record_index,
+    unsigned int inventory_arrange_mode,
+    GridLayout* out_grid_layout
+) {
+  GetGlobalInventoryGridLayout_1_00(
+      inventory_record_index,
+      reinterpret_cast<GridLayout_1_00*>(out_grid_layout)
+  );
+}
+
+static void GetGlobalInventoryGridLayout_1_07_Adapter(
+    unsigned int inventory_record_index,
+    unsigned int inventory_arrange_mode,
+    GridLayout* out_grid_layout
+) {
+  GetGlobalInventoryGridLayout_1_07(
+      inventory_record_index,
+      inventory_arrange_mode,
+      reinterpret_cast<GridLayout_1_00*>(out_grid_layout)
+  );
+}
+
+struct GetGlobalInventoryGridLayoutDispatchTable {
+  using Function = void(unsigned int, unsigned int, GridLayout*);
+
+  static constexpr mapi::VersionedFunction<Function> kFunctions[] = {
+      {
+          GameVersion::kBeta1_02,
+          GameVersion::k1_06B,
+          &GetGlobalInventoryGridLayout_1_00_Adapter
+      },
+      {
+          GameVersion::k1_07Beta,
+          GameVersion::kLod1_14D,
+          &GetGlobalInventoryGridLayout_1_07_Adapter
+      }
+  };
+};
+
+using GetGlobalInventoryGridLayoutDispatch =
+    mapi::VersionDispatch<GetGlobalInventoryGridLayoutDispatchTable>;
+
 } // namespace
 
 void GetGlobalInventoryGridLayout(
@@ -74,27 +118,18 @@ void GetGlobalInventoryGridLayout(
     unsigned int inventory_arrange_mode,
     GridLayout* out_grid_layout
 ) {
-  GameVersion running_game_version = ::d2::game_version::GetRunning();
-
-  if (running_game_version <= GameVersion::k1_06B) {
-    GetGlobalInventoryGridLayout_1_00(
-        inventory_record_index,
-        reinterpret_cast<GridLayout_1_00*>(out_grid_layout)
-    );
-  } else /* if (running_game_version >= GameVersion::k1_07Beta) */ {
-    GetGlobalInventoryGridLayout_1_07(
-        inventory_record_index,
-        inventory_arrange_mode,
-        reinterpret_cast<GridLayout_1_00*>(out_grid_layout)
-    );
-  }
+  GetGlobalInventoryGridLayoutDispatch::Call(
+      inventory_record_index,
+      inventory_arrange_mode,
+      out_grid_layout
+  );
 }
 
 void GetGlobalInventoryGridLayout_1_00(
     std::uint32_t inventory_record_index,
     GridLayout_1_00* out_grid_layout
 ) {
-  mapi::CallStdcallFunction(
+  mapi::CallStdcallFunction<void>(
       GetGameAddress().raw_address(),
       inventory_record_index,
       out_grid_layout
@@ -106,7 +141,7 @@ void GetGlobalInventoryGridLayout_1_07(
     std::uint32_t inventory_arrange_mode,
     GridLayout_1_00* out_grid_layout
 ) {
-  mapi::CallStdcallFunction(
+  mapi::CallStdcallFunction<void>(
       GetGameAddress().raw_address(),
       inventory_record_index,
       inventory_arrange_mode,
@@ -54,6 +54,7 @@
 #include "../../../asm_x86_macro.h"
 #include "../../backend/game_address_table.hpp"
 #include "../../backend/game_function/stdcall_function.hpp"
+#include "../../backend/game_function/version_dispatch.hpp"
 
 namespace d2::d2common {
 namespace {
@@ -67,6 +68,49 @@ static const mapi::GameAddress& GetGameAddress() {
   return game_address;
 }
 
+static void GetGlobalInventoryPosition_1_00_Adapter(
+    unsigned int inventory_record_index,
+    unsigned int inventory_arrange_mode,
+    PositionalRectangle* out_position
+) {
+  GetGlobalInventoryPosition_1_00(
+      inventory_record_index,
+      reinterpret_cast<PositionalRectangle_1_00*>(out_position)
+  );
+}
+
+static void GetGlobalInventoryPosition_1_07_Adapter(
+    unsigned int inventory_record_index,
+    unsigned int inventory_arrange_mode,
+    PositionalRectangle* out_position
+) {
+  GetGlobalInventoryPosition_1_07(
+      inventory_record_index,
+      inventory_arrange_mode,
+      reinterpret_cast<PositionalRectangle_1_00*>(out_position)
+  );
+}
+
+struct GetGlobalInventoryPositionDispatchTable {
+  using Function = void(unsigned int, unsigned int, PositionalRectangle*);
+
+  static constexpr mapi::VersionedFunction<Function> kFunctions[] = {
+      {
+          GameVersion::kBeta1_02,
+          GameVersion::k1_06B,
+          &GetGlobalInventoryPosition_1_00_Adapter
+      },
+      {
+          GameVersion::k1_07Beta,
+          GameVersion::kLod1_14D,
+          &GetGlobalInventoryPosition_1_07_Adapter
+      }
+  };
+};
+
+using GetGlobalInventoryPositionDispatch =
+    mapi::VersionDispatch<GetGlobalInventoryPositionDispatchTable>;
+
 } // namespace
 
 void GetGlobalInventoryPosition(
@@ -74,27 +118,18 @@ void GetGlobalInventoryPosition(
     unsigned int inventory_arrange_mode,
     PositionalRectangle* out_position
 ) {
-  GameVersion running_game_version = ::d2::game_version::GetRunning();
-
-  if (running_game_version <= GameVersion::k1_06B) {
-    GetGlobalInventoryPosition_1_00(
-        inventory_record_index,
-        reinterpret_cast<PositionalRectangle_1_00*>(out_position)
-    );
-  } else /* if (running_game_version >= GameVersion::k1_07Beta) */ {
-    GetGlobalInventoryPosition_1_07(
-        inventory_record_index,
-        inventory_arrange_mode,
-        reinterpret_cast<PositionalRectangle_1_00*>(out_position)
-    );
-  }
+  GetGlobalInventoryPositionDispatch::Call(
+      inventory_record_index,
+      inventory_arrange_mode,
+      out_position
+  );
 }
 
 void GetGlobalInventoryPosition_1_00(
     std::uint32_t inventory_record_index,
     PositionalRectangle_1_00* out_position
 ) {
-  mapi::CallStdcallFunction(
+  mapi::CallStdcallFunction<void>(
       GetGameAddress().raw_address(),
       inventory_record_index,
       out_position
@@ -106,7 +141,7 @@ void GetGlobalInventoryPosition_1_07(
     std::uint32_t inventory_arrange_mode,
     PositionalRectangle_1_00* out_position
 ) {
-  mapi::CallStdcallFunction(
+  mapi::CallStdcallFunction<void>(
       GetGameAddress().raw_address(),
       inventory_record_index,
       inventory_arrange_mode,
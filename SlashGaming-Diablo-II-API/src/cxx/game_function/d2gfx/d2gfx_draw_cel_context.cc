@@ -54,6 +54,7 @@
 #include "../../../asm_x86_macro.h"
 #include "../../backend/game_address_table.hpp"
 #include "../../backend/game_function/stdcall_function.hpp"
+#include "../../backend/game_function/version_dispatch.hpp"
 
 namespace d2::d2gfx {
 namespace {
@@ -67,6 +68,98 @@ static const mapi::GameAddress& GetGameAdress() {
   return game_address;
 }
 
+static bool DrawCelContext_1_00_Adapter(
+    CelContext* cel_context,
+    int position_x,
+    int position_y,
+    unsigned int bgrt_color,
+    DrawEffect draw_effect,
+    mapi::Undefined* unknown_06__set_to_nullptr
+) {
+  return static_cast<bool>(
+      DrawCelContext_1_00(
+          reinterpret_cast<CelContext_1_00*>(cel_context),
+          position_x,
+          position_y,
+          bgrt_color,
+          draw_effect::ToGameValue_1_00(draw_effect),
+          unknown_06__set_to_nullptr
+      )
+  );
+}
+
+static bool DrawCelContext_1_12A_Adapter(
+    CelContext* cel_context,
+    int position_x,
+    int position_y,
+    unsigned int bgrt_color,
+    DrawEffect draw_effect,
+    mapi::Undefined* unknown_06__set_to_nullptr
+) {
+  return static_cast<bool>(
+      DrawCelContext_1_12A(
+          reinterpret_cast<CelContext_1_12A*>(cel_context),
+          position_x,
+          position_y,
+          bgrt_color,
+          draw_effect::ToGameValue_1_00(draw_effect),
+          unknown_06__set_to_nullptr
+      )
+  );
+}
+
+static bool DrawCelContext_1_13C_Adapter(
+    CelContext* cel_context,
+    int position_x,
+    int position_y,
+    unsigned int bgrt_color,
+    DrawEffect draw_effect,
+    mapi::Undefined* unknown_06__set_to_nullptr
+) {
+  return static_cast<bool>(
+      DrawCelContext_1_13C(
+          reinterpret_cast<CelContext_1_13C*>(cel_context),
+          position_x,
+          position_y,
+          bgrt_color,
+          draw_effect::ToGameValue_1_00(draw_effect),
+          unknown_06__set_to_nullptr
+      )
+  );
+}
+
+struct DrawCelContextDispatchTable {
+  using Function = bool(
+      CelContext*,
+      int,
+      int,
+      unsigned int,
+      DrawEffect,
+      mapi::Undefined*
+  );
+
+  static constexpr mapi::VersionedFunction<Function> kFunctions[] = {
+      {
+          GameVersion::kBeta1_02,
+          GameVersion::k1_10,
+          &DrawCelContext_1_00_Adapter
+      },
+      {
+          GameVersion::k1_12A,
+          GameVersion::k1_12A,
+          &DrawCelContext_1_12A_Adapter
+      },
+      {
+          GameVersion::k1_11,
+          GameVersion::kLod1_14D,
+          &DrawCelContext_1_13C_Adapter
+      }
+  };
+};
+
+using DrawCelContextDispatch =
+    mapi::VersionDispatch<DrawCelContextDispatchTable>;
+
 } // namespace
 
 bool DrawCelContext(
@@ -77,42 +170,14 @@ bool DrawCelContext(
     DrawEffect draw_effect,
     mapi::Undefined* unknown_06__set_to_nullptr
 ) {
-  GameVersion running_game_version = ::d2::game_version::GetRunning();
-
-  if (running_game_version <= GameVersion::k1_10) {
-    return static_cast<bool>(
-        DrawCelContext_1_00(
-            reinterpret_cast<CelContext_1_00*>(cel_context),
-            position_x,
-            position_y,
-            bgrt_color,
-            draw_effect::ToGameValue_1_00(draw_effect),
-            unknown_06__set_to_nullptr
-        )
-    );
-  } else if (running_game_version == GameVersion::k1_12A) {
-    return static_cast<bool>(
-        DrawCelContext_1_12A(
-            reinterpret_cast<CelContext_1_12A*>(cel_context),
-            position_x,
-            position_y,
-            bgrt_color,
-            draw_effect::ToGameValue_1_00(draw_effect),
-            unknown_06__set_to_nullptr
-        )
-    );
-  } else /* if (running_game_version >= GameVersion::k1_13ABeta) */ {
-    return static_cast<bool>(
-        DrawCelContext_1_13C(
-            reinterpret_cast<CelContext_1_13C*>(cel_context),
-            position_x,
-            position_y,
-            bgrt_color,
-            draw_effect::ToGameValue_1_00(draw_effect),
-            unknown_06__set_to_nullptr
-        )
-    );
-  }
+  return DrawCelContextDispatch::Call(
+      cel_context,
+      position_x,
+      position_y,
+      bgrt_color,
+      draw_effect,
+      unknown_06__set_to_nullptr
+  );
 }
 
 mapi::bool32 DrawCelContext_1_00(
@@ -123,16 +188,14 @@ mapi::bool32 DrawCelContext_1_00(
     DrawEffect_1_00 draw_effect,
     mapi::Undefined* unknown_06__set_to_nullptr
 ) {
-  return reinterpret_cast<mapi::bool32>(
-      mapi::CallStdcallFunction(
-          GetGameAdress().raw_address(),
-          cel_context,
-          position_x,
-          position_y,
-          bgrt_color,
-          draw_effect,
-          unknown_06__set_to_nullptr
-      )
+  return mapi::CallStdcallFunction<mapi::bool32>(
+      GetGameAdress().raw_address(),
+      cel_context,
+      position_x,
+      position_y,
+      bgrt_color,
+      draw_effect,
+      unknown_06__set_to_nullptr
   );
 }
 
@@ -144,16 +207,14 @@ mapi::bool32 DrawCelContext_1_12A(
     DrawEffect_1_00 draw_effect,
     mapi::Undefined* unknown_06__set_to_nullptr
 ) {
-  return reinterpret_cast<mapi::bool32>(
-      mapi::CallStdcallFunction(
-          GetGameAdress().raw_address(),
-          cel_context,
-          position_x,
-          position_y,
-          bgrt_color,
-          draw_effect,
-          unknown_06__set_to_nullptr
-      )
+  return mapi::CallStdcallFunction<mapi::bool32>(
+      GetGameAdress().raw_address(),
+      cel_context,
+      position_x,
+      position_y,
+      bgrt_color,
+      draw_effect,
+      unknown_06__set_to_nullptr
   );
 }
 
@@ -165,16 +226,14 @@ mapi::bool32 DrawCelContext_1_13C(
     DrawEffect_1_00 draw_effect,
     mapi::Undefined* unknown_06__set_to_nullptr
 ) {
-  return reinterpret_cast<mapi::bool32>(
-      mapi::CallStdcallFunction(
-          GetGameAdress().raw_address(),
-          cel_context,
-          position_x,
-          position_y,
-          bgrt_color,
-          draw_effect,
-          unknown_06__set_to_nullptr
-      )
+  return mapi::CallStdcallFunction<mapi::bool32>(
+      GetGameAdress().raw_address(),
+      cel_context,
+      position_x,
+      position_y,
+      bgrt_color,
+      draw_effect,
+      unknown_06__set_to_nullptr
   );
 }
 
@@ -95,7 +95,7 @@ void DrawRectangle_1_00(
     std::int32_t primitive_color_id,
     DrawEffect_1_00 draw_effect_id
 ) {
-  mapi::CallStdcallFunction(
+  mapi::CallStdcallFunction<void>(
       GetGameAddress().raw_address(),
       left,
       top,
@@ -78,11 +78,9 @@ const UnicodeChar* GetStringByIndex(
 const UnicodeChar_1_00* GetStringByIndex_1_00(
     std::uint32_t id
 ) {
-  return reinterpret_cast<const UnicodeChar_1_00*>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          id
-      )
+  return mapi::CallFastcallFunction<const UnicodeChar_1_00*>(
+      GetGameAddress().raw_address(),
+      id
   );
 }
 
@@ -88,12 +88,10 @@ UnicodeChar_1_00* Unicode_AsciiToUnicode_1_00(
     const char* src,
     std::int32_t count_with_null_term
 ) {
-  return reinterpret_cast<UnicodeChar_1_00*>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          dest,
-          src
-      )
+  return mapi::CallFastcallFunction<UnicodeChar_1_00*>(
+      GetGameAddress().raw_address(),
+      dest,
+      src
   );
 }
 
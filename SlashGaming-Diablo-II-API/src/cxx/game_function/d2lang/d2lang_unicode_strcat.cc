@@ -49,11 +49,15 @@
 
 #include "../../../../include/cxx/game_function/d2lang/d2lang_unicode_strcat.hpp"
 
+#include <cstdint>
+
 #include "../../../../include/cxx/default_game_library.hpp"
 #include "../../../../include/cxx/game_version.hpp"
+#include "../../../../include/cxx/helper/d2_unicode_string_routine.hpp"
 #include "../../../asm_x86_macro.h"
 #include "../../backend/game_address_table.hpp"
 #include "../../backend/game_function/fastcall_function.hpp"
+#include "../../backend/unicode_string_kernel.hpp"
 
 namespace d2::d2lang {
 namespace {
@@ -73,6 +77,16 @@ UnicodeChar* Unicode_strcat(
     UnicodeChar* dest,
     const UnicodeChar* src
 ) {
+  if (GetUnicodeStringRoutine(UnicodeStringOperation::kStrcat)
+      == UnicodeStringRoutine::kNative) {
+    return reinterpret_cast<UnicodeChar*>(
+        mapi::UnicodeStrcat(
+            reinterpret_cast<std::uint16_t*>(dest),
+            reinterpret_cast<const std::uint16_t*>(src)
+        )
+    );
+  }
+
   return reinterpret_cast<UnicodeChar*>(
       Unicode_strcat_1_00(
           reinterpret_cast<UnicodeChar_1_00*>(dest),
@@ -85,12 +99,10 @@ UnicodeChar_1_00* Unicode_strcat_1_00(
     UnicodeChar_1_00* dest,
     const UnicodeChar_1_00* src
 ) {
-  return reinterpret_cast<UnicodeChar_1_00*>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          dest,
-          src
-      )
+  return mapi::CallFastcallFunction<UnicodeChar_1_00*>(
+      GetGameAddress().raw_address(),
+      dest,
+      src
   );
 }
 
@@ -49,11 +49,15 @@
 
 #include "../../../../include/cxx/game_function/d2lang/d2lang_unicode_strcmp.hpp"
 
+#include <cstdint>
+
 #include "../../../../include/cxx/default_game_library.hpp"
 #include "../../../../include/cxx/game_version.hpp"
+#include "../../../../include/cxx/helper/d2_unicode_string_routine.hpp"
 #include "../../../asm_x86_macro.h"
 #include "../../backend/game_address_table.hpp"
 #include "../../backend/game_function/fastcall_function.hpp"
+#include "../../backend/unicode_string_kernel.hpp"
 
 namespace d2::d2lang {
 namespace {
@@ -73,6 +77,14 @@ int Unicode_strcmp(
     const UnicodeChar* str1,
     const UnicodeChar* str2
 ) {
+  if (GetUnicodeStringRoutine(UnicodeStringOperation::kStrcmp)
+      == UnicodeStringRoutine::kNative) {
+    return mapi::UnicodeStrcmp(
+        reinterpret_cast<const std::uint16_t*>(str1),
+        reinterpret_cast<const std::uint16_t*>(str2)
+    );
+  }
+
   return Unicode_strcmp_1_00(
       reinterpret_cast<const UnicodeChar_1_00*>(str1),
       reinterpret_cast<const UnicodeChar_1_00*>(str2)
@@ -83,12 +95,10 @@ std::int32_t Unicode_strcmp_1_00(
     const UnicodeChar_1_00* str1,
     const UnicodeChar_1_00* str2
 ) {
-  return reinterpret_cast<std::int32_t>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          str1,
-          str2
-      )
+  return mapi::CallFastcallFunction<std::int32_t>(
+      GetGameAddress().raw_address(),
+      str1,
+      str2
   );
 }
 
@@ -49,11 +49,15 @@
 
 #include "../../../../include/cxx/game_function/d2lang/d2lang_unicode_strlen.hpp"
 
+#include <cstdint>
+
 #include "../../../../include/cxx/default_game_library.hpp"
 #include "../../../../include/cxx/game_version.hpp"
+#include "../../../../include/cxx/helper/d2_unicode_string_routine.hpp"
 #include "../../../asm_x86_macro.h"
 #include "../../backend/game_address_table.hpp"
 #include "../../backend/game_function/fastcall_function.hpp"
+#include "../../backend/unicode_string_kernel.hpp"
 
 namespace d2::d2lang {
 namespace {
@@ -70,17 +74,22 @@ static const mapi::GameAddress& GetGameAddress() {
 } // namespace
 
 int Unicode_strlen(const UnicodeChar* buffer) {
+  if (GetUnicodeStringRoutine(UnicodeStringOperation::kStrlen)
+      == UnicodeStringRoutine::kNative) {
+    return static_cast<int>(
+        mapi::UnicodeStrlen(reinterpret_cast<const std::uint16_t*>(buffer))
+    );
+  }
+
   return Unicode_strlen_1_00(
       reinterpret_cast<const UnicodeChar_1_00*>(buffer)
   );
 }
 
 std::int32_t Unicode_strlen_1_00(const UnicodeChar_1_00* buffer) {
-  return reinterpret_cast<std::int32_t>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          buffer
-      )
+  return mapi::CallFastcallFunction<std::int32_t>(
+      GetGameAddress().raw_address(),
+      buffer
   );
 }
 
@@ -49,11 +49,16 @@
 
 #include "../../../../include/cxx/game_function/d2lang/d2lang_unicode_strncmp.hpp"
 
+#include <cstdint>
+
 #include "../../../../include/cxx/default_game_library.hpp"
 #include "../../../../include/cxx/game_version.hpp"
+#include "../../../../include/cxx/helper/d2_unicode_string_routine.hpp"
 #include "../../../asm_x86_macro.h"
 #include "../../backend/game_address_table.hpp"
 #include "../../backend/game_function/fastcall_function.hpp"
+#include "../../backend/game_function/version_dispatch.hpp"
+#include "../../backend/unicode_string_kernel.hpp"
 
 namespace d2::d2lang {
 namespace {
@@ -76,19 +81,11 @@ static int Unicode_strncmp_1_00_Impl(
     const UnicodeChar_1_00* str2,
     std::size_t count
 ) {
-  for (std::size_t i = 0; i < count; i += 1) {
-    int diff = str1[i].ch - str2[i].ch;
-
-    if (diff != 0) {
-      return diff;
-    }
-
-    if (str1[i].ch == u'\0') {
-      return 0;
-    }
-  }
-
-  return 0;
+  return mapi::UnicodeStrncmp(
+      reinterpret_cast<const std::uint16_t*>(str1),
+      reinterpret_cast<const std::uint16_t*>(str2),
+      count
+  );
 }
 
 static std::int32_t Unicode_strncmp_1_10(
@@ -96,16 +93,58 @@ static std::int32_t Unicode_strncmp_1_10(
     const UnicodeChar_1_00* str2,
     std::size_t count
 ) {
-  return reinterpret_cast<std::int32_t>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          str1,
-          str2,
-          count
-      )
+  return mapi::CallFastcallFunction<std::int32_t>(
+      GetGameAddress().raw_address(),
+      str1,
+      str2,
+      count
+  );
+}
+
+static int Unicode_strncmp_1_00_Adapter(
+    const UnicodeChar* str1,
+    const UnicodeChar* str2,
+    std::size_t count
+) {
+  return Unicode_strncmp_1_00_Impl(
+      reinterpret_cast<const UnicodeChar_1_00*>(str1),
+      reinterpret_cast<const UnicodeChar_1_00*>(str2),
+      count
   );
 }
 
+static int Unicode_strncmp_1_10_Adapter(
+    const UnicodeChar* str1,
+    const UnicodeChar* str2,
+    std::size_t count
+) {
+  return Unicode_strncmp_1_10(
+      reinterpret_cast<const UnicodeChar_1_00*>(str1),
+      reinterpret_cast<const UnicodeChar_1_00*>(str2),
+      count
+  );
+}
+
+struct Unicode_strncmpDispatchTable {
+  using Function = int(const UnicodeChar*, const UnicodeChar*, std::size_t);
+
+  static constexpr mapi::VersionedFunction<Function> kFunctions[] = {
+      {
+          GameVersion::kBeta1_02,
+          GameVersion::k1_09D,
+          &Unicode_strncmp_1_00_Adapter
+      },
+      {
+          GameVersion::k1_10Beta,
+          GameVersion::kLod1_14D,
+          &Unicode_strncmp_1_10_Adapter
+      }
+  };
+};
+
+using Unicode_strncmpDispatch =
+    mapi::VersionDispatch<Unicode_strncmpDispatchTable>;
+
 } // namespace
 
 int Unicode_strncmp(
@@ -113,21 +152,16 @@ int Unicode_strncmp(
     const UnicodeChar* str2,
     std::size_t count
 ) {
-  GameVersion running_game_version = ::d2::game_version::GetRunning();
-
-  if (running_game_version <= GameVersion::k1_09D) {
+  if (GetUnicodeStringRoutine(UnicodeStringOperation::kStrncmp)
+      == UnicodeStringRoutine::kNative) {
     return Unicode_strncmp_1_00_Impl(
         reinterpret_cast<const UnicodeChar_1_00*>(str1),
         reinterpret_cast<const UnicodeChar_1_00*>(str2),
         count
     );
-  } else /* if (running_game_version >= GameVersion::k1_10) */ {
-    return Unicode_strncmp_1_10(
-        reinterpret_cast<const UnicodeChar_1_00*>(str1),
-        reinterpret_cast<const UnicodeChar_1_00*>(str2),
-        count
-    );
   }
+
+  return Unicode_strncmpDispatch::Call(str1, str2, count);
 }
 
 std::int32_t Unicode_strncmp_1_00(
@@ -135,13 +169,11 @@ std::int32_t Unicode_strncmp_1_00(
     const UnicodeChar_1_00* str2,
     std::uint32_t count
 ) {
-  return reinterpret_cast<std::int32_t>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          str1,
-          str2,
-          count
-      )
+  return mapi::CallFastcallFunction<std::int32_t>(
+      GetGameAddress().raw_address(),
+      str1,
+      str2,
+      count
   );
 }
 
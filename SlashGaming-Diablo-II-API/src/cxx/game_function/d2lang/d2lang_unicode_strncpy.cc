@@ -90,13 +90,11 @@ UnicodeChar_1_00* Unicode_strncpy_1_00(
     const UnicodeChar_1_00* src,
     std::uint32_t count
 ) {
-  return reinterpret_cast<UnicodeChar_1_00*>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          dest,
-          src,
-          count
-      )
+  return mapi::CallFastcallFunction<UnicodeChar_1_00*>(
+      GetGameAddress().raw_address(),
+      dest,
+      src,
+      count
   );
 }
 
@@ -51,9 +51,11 @@
 
 #include "../../../../include/cxx/default_game_library.hpp"
 #include "../../../../include/cxx/game_version.hpp"
+#include "../../../../include/cxx/helper/d2_unicode_string_routine.hpp"
 #include "../../../asm_x86_macro.h"
 #include "../../backend/game_address_table.hpp"
 #include "../../backend/game_function/thiscall_function.hpp"
+#include "../../backend/unicode_string_kernel.hpp"
 
 namespace d2::d2lang {
 namespace {
@@ -73,6 +75,17 @@ UnicodeChar* Unicode_tolower(
     const UnicodeChar* src,
     UnicodeChar* dest
 ) {
+  if (GetUnicodeStringRoutine(UnicodeStringOperation::kToLower)
+      == UnicodeStringRoutine::kNative) {
+    const UnicodeChar_1_00* actual_src =
+        reinterpret_cast<const UnicodeChar_1_00*>(src);
+    UnicodeChar_1_00* actual_dest = reinterpret_cast<UnicodeChar_1_00*>(dest);
+
+    actual_dest->ch = mapi::UnicodeCharToLower(actual_src->ch);
+
+    return dest;
+  }
+
   return reinterpret_cast<UnicodeChar*>(
       Unicode_tolower_1_00(
           reinterpret_cast<const UnicodeChar_1_00*>(src),
@@ -85,12 +98,10 @@ UnicodeChar_1_00* Unicode_tolower_1_00(
     const UnicodeChar_1_00* src,
     UnicodeChar_1_00* dest
 ) {
-  return reinterpret_cast<UnicodeChar_1_00*>(
-      mapi::CallThiscallFunction(
-          GetGameAddress().raw_address(),
-          src,
-          dest
-      )
+  return mapi::CallThiscallFunction<UnicodeChar_1_00*>(
+      GetGameAddress().raw_address(),
+      src,
+      dest
   );
 }
 
@@ -86,13 +86,11 @@ char8_t* Unicode_UnicodeToUtf8_1_00(
     const UnicodeChar_1_00* src,
     std::int32_t count_with_null_term
 ) {
-  return reinterpret_cast<char8_t*>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          dest,
-          src,
-          count_with_null_term
-      )
+  return mapi::CallFastcallFunction<char8_t*>(
+      GetGameAddress().raw_address(),
+      dest,
+      src,
+      count_with_null_term
   );
 }
 
@@ -88,13 +88,11 @@ UnicodeChar_1_00* Unicode_Utf8ToUnicode_1_00(
     const char8_t* src,
     std::int32_t count_with_null_term
 ) {
-  return reinterpret_cast<UnicodeChar_1_00*>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          dest,
-          src,
-          count_with_null_term
-      )
+  return mapi::CallFastcallFunction<UnicodeChar_1_00*>(
+      GetGameAddress().raw_address(),
+      dest,
+      src,
+      count_with_null_term
   );
 }
 
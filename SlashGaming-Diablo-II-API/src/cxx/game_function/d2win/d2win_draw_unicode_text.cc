@@ -92,7 +92,7 @@ void DrawUnicodeText_1_00(
     TextColor_1_00 text_color,
     mapi::bool32 is_indented
 ) {
-  mapi::CallFastcallFunction(
+  mapi::CallFastcallFunction<void>(
       GetGameAddress().raw_address(),
       text,
       position_x,
@@ -86,7 +86,7 @@ void GetPopUpUnicodeTextWidthAndHeight_1_00(
     std::int32_t* width,
     std::int32_t* height
 ) {
-  mapi::CallFastcallFunction(
+  mapi::CallFastcallFunction<void>(
       GetGameAddress().raw_address(),
       text,
       width,
@@ -79,11 +79,9 @@ int GetUnicodeTextDrawWidth(
 std::int32_t GetUnicodeTextDrawWidth_1_00(
     const UnicodeChar_1_00* text
 ) {
-  return reinterpret_cast<std::int32_t>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          text
-      )
+  return mapi::CallFastcallFunction<std::int32_t>(
+      GetGameAddress().raw_address(),
+      text
   );
 }
 
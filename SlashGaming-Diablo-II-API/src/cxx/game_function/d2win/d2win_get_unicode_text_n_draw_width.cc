@@ -83,12 +83,10 @@ std::int32_t GetUnicodeTextNDrawWidth_1_00(
     const UnicodeChar_1_00* text,
     std::int32_t length
 ) {
-  return reinterpret_cast<std::int32_t>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          text,
-          length
-      )
+  return mapi::CallFastcallFunction<std::int32_t>(
+      GetGameAddress().raw_address(),
+      text,
+      length
   );
 }
 
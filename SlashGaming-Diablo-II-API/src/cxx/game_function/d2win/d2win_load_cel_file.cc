@@ -84,12 +84,10 @@ CelFile_1_00* LoadCelFile_1_00(
     const char* cel_file_name,
     mapi::bool32 is_dcc_else_dc6
 ) {
-  return reinterpret_cast<CelFile_1_00*>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          cel_file_name,
-          is_dcc_else_dc6
-      )
+  return mapi::CallFastcallFunction<CelFile_1_00*>(
+      GetGameAddress().raw_address(),
+      cel_file_name,
+      is_dcc_else_dc6
   );
 }
 
@@ -54,6 +54,7 @@
 #include "../../../asm_x86_macro.h"
 #include "../../backend/game_address_table.hpp"
 #include "../../backend/game_function/fastcall_function.hpp"
+#include "../../backend/game_function/version_dispatch.hpp"
 
 namespace d2::d2win {
 namespace {
@@ -98,6 +99,133 @@ LoadMpq_1_11_Shim(
   ASM_X86(ret);
 }
 
+static MpqArchiveHandle* LoadMpq_1_00_Adapter(
+    const char* mpq_file_name,
+    bool is_set_err_on_drive_query_fail,
+    void* (*on_fail_callback)(void),
+    int priority
+) {
+  return reinterpret_cast<MpqArchiveHandle*>(
+      LoadMpq_1_00(
+          "SGD2MAPI",
+          mpq_file_name,
+          "SGD2MAPI",
+          nullptr,
+          on_fail_callback
+      )
+  );
+}
+
+static MpqArchiveHandle* LoadMpq_1_03_Adapter(
+    const char* mpq_file_name,
+    bool is_set_err_on_drive_query_fail,
+    void* (*on_fail_callback)(void),
+    int priority
+) {
+  return reinterpret_cast<MpqArchiveHandle*>(
+      LoadMpq_1_03(
+          "SGD2MAPI",
+          mpq_file_name,
+          "SGD2MAPI",
+          nullptr,
+          is_set_err_on_drive_query_fail,
+          on_fail_callback
+      )
+  );
+}
+
+static MpqArchiveHandle* LoadMpq_1_07_Adapter(
+    const char* mpq_file_name,
+    bool is_set_err_on_drive_query_fail,
+    void* (*on_fail_callback)(void),
+    int priority
+) {
+  return reinterpret_cast<MpqArchiveHandle*>(
+      LoadMpq_1_07(
+          "SGD2MAPI",
+          mpq_file_name,
+          "SGD2MAPI",
+          nullptr,
+          is_set_err_on_drive_query_fail,
+          on_fail_callback,
+          priority
+      )
+  );
+}
+
+static MpqArchiveHandle* LoadMpq_1_11_Adapter(
+    const char* mpq_file_name,
+    bool is_set_err_on_drive_query_fail,
+    void* (*on_fail_callback)(void),
+    int priority
+) {
+  return reinterpret_cast<MpqArchiveHandle*>(
+      LoadMpq_1_11(
+          "SGD2MAPI",
+          mpq_file_name,
+          "SGD2MAPI",
+          is_set_err_on_drive_query_fail,
+          on_fail_callback,
+          priority
+      )
+  );
+}
+
+static MpqArchiveHandle* LoadMpq_1_14A_Adapter(
+    const char* mpq_file_name,
+    bool is_set_err_on_drive_query_fail,
+    void* (*on_fail_callback)(void),
+    int priority
+) {
+  return reinterpret_cast<MpqArchiveHandle*>(
+      LoadMpq_1_14A(
+          mpq_file_name,
+          is_set_err_on_drive_query_fail,
+          on_fail_callback,
+          priority
+      )
+  );
+}
+
+struct LoadMpqDispatchTable {
+  using Function = MpqArchiveHandle*(
+      const char*,
+      bool,
+      void* (*)(void),
+      int
+  );
+
+  static constexpr mapi::VersionedFunction<Function> kFunctions[] = {
+      {
+          GameVersion::kBeta1_02,
+          GameVersion::k1_02,
+          &LoadMpq_1_00_Adapter
+      },
+      {
+          GameVersion::k1_03,
+          GameVersion::k1_06B,
+          &LoadMpq_1_03_Adapter
+      },
+      {
+          GameVersion::k1_07Beta,
+          GameVersion::k1_10,
+          &LoadMpq_1_07_Adapter
+      },
+      {
+          GameVersion::k1_11,
+          GameVersion::k1_13D,
+          &LoadMpq_1_11_Adapter
+      },
+      {
+          GameVersion::kClassic1_14A,
+          GameVersion::kLod1_14D,
+          &LoadMpq_1_14A_Adapter
+      }
+  };
+};
+
+using LoadMpqDispatch = mapi::VersionDispatch<LoadMpqDispatchTable>;
+
 } // namespace
 
 MpqArchiveHandle* LoadMpq(
@@ -106,65 +234,12 @@ MpqArchiveHandle* LoadMpq(
     void* (*on_fail_callback)(void),
     int priority
 ) {
-  d2::GameVersion running_game_version = ::d2::game_version::GetRunning();
-
-  if (running_game_version <= d2::GameVersion::k1_02) {
-    return reinterpret_cast<MpqArchiveHandle*>(
-        LoadMpq_1_00(
-            "SGD2MAPI",
-            mpq_file_name,
-            "SGD2MAPI",
-            nullptr,
-            on_fail_callback
-        )
-    );
-  } else if (running_game_version >= d2::GameVersion::k1_03
-      && running_game_version <= d2::GameVersion::k1_06B) {
-    return reinterpret_cast<MpqArchiveHandle*>(
-        LoadMpq_1_03(
-            "SGD2MAPI",
-            mpq_file_name,
-            "SGD2MAPI",
-            nullptr,
-            is_set_err_on_drive_query_fail,
-            on_fail_callback
-        )
-    );
-  } else if (running_game_version >= d2::GameVersion::k1_07
-      && running_game_version <= d2::GameVersion::k1_10) {
-    return reinterpret_cast<MpqArchiveHandle*>(
-        LoadMpq_1_07(
-            "SGD2MAPI",
-            mpq_file_name,
-            "SGD2MAPI",
-            nullptr,
-            is_set_err_on_drive_query_fail,
-            on_fail_callback,
-            priority
-        )
-    );
-  } else if (running_game_version >= d2::GameVersion::k1_11
-      && running_game_version <= d2::GameVersion::k1_13D) {
-    return reinterpret_cast<MpqArchiveHandle*>(
-        LoadMpq_1_11(
-            "SGD2MAPI",
-            mpq_file_name,
-            "SGD2MAPI",
-            is_set_err_on_drive_query_fail,
-            on_fail_callback,
-            priority
-        )
-    );
-  } else /* if (running_game_version >= d2::GameVersion::kClassic1_14A) */ {
-    return reinterpret_cast<MpqArchiveHandle*>(
-        LoadMpq_1_14A(
-            mpq_file_name,
-            is_set_err_on_drive_query_fail,
-            on_fail_callback,
-            priority
-        )
-    );
-  }
+  return LoadMpqDispatch::Call(
+      mpq_file_name,
+      is_set_err_on_drive_query_fail,
+      on_fail_callback,
+      priority
+  );
 }
 
 MpqArchiveHandle_1_00* LoadMpq_1_00(
@@ -174,15 +249,13 @@ MpqArchiveHandle_1_00* LoadMpq_1_00(
     void* unused_04__set_to_nullptr,
     void* (*on_fail_callback)()
 ) {
-  return reinterpret_cast<MpqArchiveHandle_1_00*>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          dll_file_name,
-          mpq_file_name,
-          mpq_name,
-          unused_04__set_to_nullptr,
-          on_fail_callback
-      )
+  return mapi::CallFastcallFunction<MpqArchiveHandle_1_00*>(
+      GetGameAddress().raw_address(),
+      dll_file_name,
+      mpq_file_name,
+      mpq_name,
+      unused_04__set_to_nullptr,
+      on_fail_callback
   );
 }
 
@@ -194,16 +267,14 @@ MpqArchiveHandle_1_00* LoadMpq_1_03(
     mapi::bool32 is_set_err_on_drive_query_fail,
     void* (*on_fail_callback)()
 ) {
-  return reinterpret_cast<MpqArchiveHandle_1_00*>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          dll_file_name,
-          mpq_file_name,
-          mpq_name,
-          unused_04__set_to_nullptr,
-          is_set_err_on_drive_query_fail,
-          on_fail_callback
-      )
+  return mapi::CallFastcallFunction<MpqArchiveHandle_1_00*>(
+      GetGameAddress().raw_address(),
+      dll_file_name,
+      mpq_file_name,
+      mpq_name,
+      unused_04__set_to_nullptr,
+      is_set_err_on_drive_query_fail,
+      on_fail_callback
   );
 }
 
@@ -216,17 +287,15 @@ MpqArchiveHandle_1_00* LoadMpq_1_07(
     void* (*on_fail_callback)(),
     std::int32_t priority
 ) {
-  return reinterpret_cast<MpqArchiveHandle_1_00*>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          dll_file_name,
-          mpq_file_name,
-          mpq_name,
-          unused_04__set_to_nullptr,
-          is_set_err_on_drive_query_fail,
-          on_fail_callback,
-          priority
-      )
+  return mapi::CallFastcallFunction<MpqArchiveHandle_1_00*>(
+      GetGameAddress().raw_address(),
+      dll_file_name,
+      mpq_file_name,
+      mpq_name,
+      unused_04__set_to_nullptr,
+      is_set_err_on_drive_query_fail,
+      on_fail_callback,
+      priority
   );
 }
 
@@ -255,14 +324,12 @@ MpqArchiveHandle_1_00* LoadMpq_1_14A(
     void* (*on_fail_callback)(),
     std::int32_t priority
 ) {
-  return reinterpret_cast<MpqArchiveHandle_1_00*>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          mpq_file_name,
-          is_set_err_on_drive_query_fail,
-          on_fail_callback,
-          priority
-      )
+  return mapi::CallFastcallFunction<MpqArchiveHandle_1_00*>(
+      GetGameAddress().raw_address(),
+      mpq_file_name,
+      is_set_err_on_drive_query_fail,
+      on_fail_callback,
+      priority
   );
 }
 
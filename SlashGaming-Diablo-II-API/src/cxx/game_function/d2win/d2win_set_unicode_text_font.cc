@@ -77,11 +77,9 @@ TextFont SetUnicodeTextFont(TextFont text_font) {
 }
 
 TextFont_1_00 SetUnicodeTextFont_1_00(TextFont_1_00 text_font) {
-  int old_text_font = reinterpret_cast<int>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          text_font
-      )
+  int old_text_font = mapi::CallFastcallFunction<int>(
+      GetGameAddress().raw_address(),
+      text_font
   );
 
   return static_cast<TextFont_1_00>(old_text_font);
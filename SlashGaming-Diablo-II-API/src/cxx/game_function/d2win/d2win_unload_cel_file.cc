@@ -75,7 +75,7 @@ void UnloadCelFile(CelFile* cel_file) {
 }
 
 void UnloadCelFile_1_00(CelFile_1_00* cel_file) {
-  mapi::CallFastcallFunction(
+  mapi::CallFastcallFunction<void>(
       GetGameAddress().raw_address(),
       cel_file
   );
@@ -55,6 +55,7 @@
 #include "../../backend/game_address_table.hpp"
 #include "../../backend/game_function/esi_function.hpp"
 #include "../../backend/game_function/fastcall_function.hpp"
+#include "../../backend/game_function/version_dispatch.hpp"
 
 namespace d2::d2win {
 namespace {
@@ -68,6 +69,47 @@ static const mapi::GameAddress& GetGameAddress() {
   return game_address;
 }
 
+static void UnloadMpq_1_00_Fastcall(
+    MpqArchiveHandle_1_00* mpq_archive_handle
+) {
+  mapi::CallFastcallFunction<void>(
+      GetGameAddress().raw_address(),
+      mpq_archive_handle
+  );
+}
+
+static void UnloadMpq_1_00_Esi(MpqArchiveHandle_1_00* mpq_archive_handle) {
+  mapi::CallEsiFunction<void>(
+      GetGameAddress().raw_address(),
+      mpq_archive_handle
+  );
+}
+
+struct UnloadMpq_1_00DispatchTable {
+  using Function = void(MpqArchiveHandle_1_00*);
+
+  static constexpr mapi::VersionedFunction<Function> kFunctions[] = {
+      {
+          GameVersion::kBeta1_02,
+          GameVersion::k1_10,
+          &UnloadMpq_1_00_Fastcall
+      },
+      {
+          GameVersion::k1_11,
+          GameVersion::k1_13D,
+          &UnloadMpq_1_00_Esi
+      },
+      {
+          GameVersion::kClassic1_14A,
+          GameVersion::kLod1_14D,
+          &UnloadMpq_1_00_Fastcall
+      }
+  };
+};
+
+using UnloadMpq_1_00Dispatch =
+    mapi::VersionDispatch<UnloadMpq_1_00DispatchTable>;
+
 } // namespace
 
 void UnloadMpq(
@@ -79,21 +121,7 @@ void UnloadMpq(
 }
 
 void UnloadMpq_1_00(MpqArchiveHandle_1_00* mpq_archive_handle) {
-  GameVersion running_game_version = ::d2::game_version::GetRunning();
-
-  if (running_game_version <= GameVersion::k1_10
-      || running_game_version >= GameVersion::kClassic1_14A) {
-    mapi::CallFastcallFunction(
-        GetGameAddress().raw_address(),
-        mpq_archive_handle
-    );
-  } else if (running_game_version >= GameVersion::k1_11
-      && running_game_version <= GameVersion::k1_13D) {
-    mapi::CallEsiFunction(
-        GetGameAddress().raw_address(),
-        mpq_archive_handle
-    );
-  }
+  UnloadMpq_1_00Dispatch::Call(mpq_archive_handle);
 }
 
 } // namespace d2::d2win
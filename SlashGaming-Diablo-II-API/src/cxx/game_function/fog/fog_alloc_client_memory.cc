@@ -88,7 +88,7 @@ void* AllocClientMemory_1_00(
     std::int32_t line,
     std::int32_t unused__set_to_0
 ) {
-  return mapi::CallFastcallFunction(
+  return mapi::CallFastcallFunction<void*>(
       GetGameAddress().raw_address(),
       size,
       source_file,
@@ -90,14 +90,12 @@ mapi::bool32 FreeClientMemory_1_00(
     std::int32_t line,
     std::int32_t unused__set_to_0
 ) {
-  return reinterpret_cast<mapi::bool32>(
-      mapi::CallFastcallFunction(
-          GetGameAddress().raw_address(),
-          ptr,
-          source_file,
-          line,
-          unused__set_to_0
-      )
+  return mapi::CallFastcallFunction<mapi::bool32>(
+      GetGameAddress().raw_address(),
+      ptr,
+      source_file,
+      line,
+      unused__set_to_0
   );
 }
 
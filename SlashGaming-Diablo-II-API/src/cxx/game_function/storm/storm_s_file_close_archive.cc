@@ -79,11 +79,9 @@ bool SFileCloseArchive(
 mapi::bool32 SFileCloseArchive_1_00(
     MpqArchive_1_00* mpq_archive
 ) {
-  return reinterpret_cast<mapi::bool32>(
-      mapi::CallStdcallFunction(
-          GetGameAddress().raw_address(),
-          mpq_archive
-      )
+  return mapi::CallStdcallFunction<mapi::bool32>(
+      GetGameAddress().raw_address(),
+      mpq_archive
   );
 }
 
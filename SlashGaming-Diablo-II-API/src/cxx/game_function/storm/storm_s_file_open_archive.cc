@@ -90,14 +90,12 @@ mapi::bool32 SFileOpenArchive_1_00(
     std::uint32_t flags,
     MpqArchive_1_00** mpq_archive_ptr_out
 ) {
-  return reinterpret_cast<mapi::bool32>(
-      mapi::CallStdcallFunction(
-          GetGameAddress().raw_address(),
-          mpq_archive_path,
-          priority,
-          flags,
-          mpq_archive_ptr_out
-      )
+  return mapi::CallStdcallFunction<mapi::bool32>(
+      GetGameAddress().raw_address(),
+      mpq_archive_path,
+      priority,
+      flags,
+      mpq_archive_ptr_out
   );
 }
 
@@ -45,116 +45,104 @@
 
 #include "../../include/cxx/game_patch.hpp"
 
-#include <windows.h>
 #include <cstddef>
 #include <cstdint>
+#include <algorithm>
+#include <memory>
 #include <utility>
-#include <vector>
 
 #include <mdc/error/exit_on_error.hpp>
 #include <mdc/wchar_t/filew.h>
+#include "backend/x86_instruction_decoder.hpp"
 #include "../../include/cxx/game_address.hpp"
+#include "../../include/cxx/game_patch_transaction.hpp"
 #include "backend/architecture_opcode.hpp"
 
 namespace mapi {
+namespace {
+
+// Branches this far before and past a patch are checked for targets
+// inside of it. The check before the patch is best-effort.
+static constexpr std::size_t kBranchSourceScanBeforeSize = 32;
+static constexpr std::size_t kBranchSourceScanAfterSize = 64;
+
+} // namespace
 
 GamePatch::GamePatch()
     : game_address_(),
       is_patch_applied_(false),
-      patch_buffer_(),
-      unpatched_buffer_() {
+      patch_size_(0),
+      inline_patch_buffer_(),
+      inline_unpatched_buffer_(),
+      large_buffers_() {
 }
 
 GamePatch::GamePatch(
     const GameAddress& game_address,
-    const std::vector<std::uint8_t>& patch_buffer
+    std::size_t patch_size
 ) : game_address_(game_address),
     is_patch_applied_(false),
-    patch_buffer_(patch_buffer),
-    unpatched_buffer_(
-        reinterpret_cast<std::uint8_t*>(game_address.raw_address()),
-        reinterpret_cast<std::uint8_t*>(
-            game_address.raw_address() + patch_buffer.size()
-        )
-    ) {
-}
+    patch_size_(patch_size),
+    inline_patch_buffer_(),
+    inline_unpatched_buffer_(),
+    large_buffers_() {
+  if (patch_size > kInlineBufferCapacity) {
+    this->large_buffers_ = std::make_unique<std::uint8_t[]>(patch_size * 2);
+  }
 
-GamePatch::GamePatch(
-    GameAddress&& game_address,
-    const std::vector<std::uint8_t>& patch_buffer
-) : game_address_(std::move(game_address)),
-    is_patch_applied_(false),
-    patch_buffer_(patch_buffer),
-    unpatched_buffer_(
-        reinterpret_cast<std::uint8_t*>(game_address.raw_address()),
-        reinterpret_cast<std::uint8_t*>(
-            game_address.raw_address() + patch_buffer.size()
-        )
-    ) {
-}
+  const std::uint8_t* unpatched_begin =
+      reinterpret_cast<const std::uint8_t*>(game_address.raw_address());
 
-GamePatch::GamePatch(
-    const GameAddress& game_address,
-    std::vector<std::uint8_t>&& patch_buffer
-) : game_address_(game_address),
-    is_patch_applied_(false),
-    patch_buffer_(std::move(patch_buffer)),
-    unpatched_buffer_(
-        reinterpret_cast<std::uint8_t*>(game_address.raw_address()),
-        reinterpret_cast<std::uint8_t*>(
-            game_address.raw_address() + patch_buffer.size()
-        )
-    ) {
+  std::copy_n(unpatched_begin, patch_size, this->unpatched_buffer());
 }
 
-GamePatch::GamePatch(
-    GameAddress&& game_address,
-    std::vector<std::uint8_t>&& patch_buffer
-) : game_address_(std::move(game_address)),
-    is_patch_applied_(false),
-    patch_buffer_(std::move(patch_buffer)),
-    unpatched_buffer_(
-        reinterpret_cast<std::uint8_t*>(game_address.raw_address()),
-        reinterpret_cast<std::uint8_t*>(
-            game_address.raw_address() + patch_buffer.size()
-        )
-    ) {
+GamePatch::GamePatch(GamePatch&& game_patch) noexcept
+    : game_address_(std::move(game_patch.game_address_)),
+      is_patch_applied_(std::exchange(game_patch.is_patch_applied_, false)),
+      patch_size_(std::exchange(game_patch.patch_size_, 0)),
+      inline_patch_buffer_(game_patch.inline_patch_buffer_),
+      inline_unpatched_buffer_(game_patch.inline_unpatched_buffer_),
+      large_buffers_(std::move(game_patch.large_buffers_)) {
 }
 
-GamePatch::GamePatch(GamePatch&& game_patch) noexcept = default;
-
 GamePatch::~GamePatch() = default;
 
-GamePatch& GamePatch::operator=(GamePatch&& game_patch) noexcept = default;
+GamePatch& GamePatch::operator=(GamePatch&& game_patch) noexcept {
+  if (this == &game_patch) {
+    return *this;
+  }
+
+  this->game_address_ = std::move(game_patch.game_address_);
+  this->is_patch_applied_ = std::exchange(game_patch.is_patch_applied_, false);
+  this->patch_size_ = std::exchange(game_patch.patch_size_, 0);
+  this->inline_patch_buffer_ = game_patch.inline_patch_buffer_;
+  this->inline_unpatched_buffer_ = game_patch.inline_unpatched_buffer_;
+  this->large_buffers_ = std::move(game_patch.large_buffers_);
+
+  return *this;
+}
 
 void GamePatch::Apply() {
   if (this->is_patch_applied()) {
     return;
   }
 
-  std::intptr_t raw_address = this->game_address().raw_address();
+  GamePatchTransaction transaction;
+  transaction.Add(this);
 
-  // Apply the patched state to the destination.
-  BOOL write_success = WriteProcessMemory(
-      GetCurrentProcess(),
-      (void*) raw_address,
-      this->patch_buffer().data(),
-      this->patch_buffer().size(),
-      nullptr
-  );
-
-  if (!write_success) {
-    ::mdc::error::ExitOnWindowsFunctionError(
+  if (!transaction.Apply()) {
+    ::mdc::error::ExitOnGeneralError(
+        L"Error",
+        L"Could not apply the patch at 0x%X of size %u bytes. It overlaps "
+            L"an applied patch, or its memory could not be made writable.",
         __FILEW__,
         __LINE__,
-        L"WriteProcessMemory",
-        GetLastError()
+        this->game_address().raw_address(),
+        this->patch_size()
     );
 
     return;
   }
-
-  this->is_patch_applied_ = true;
 }
 
 void GamePatch::Remove() {
@@ -162,29 +150,22 @@ void GamePatch::Remove() {
     return;
   }
 
-  std::intptr_t raw_address = this->game_address().raw_address();
-
-  // Restore the old state of the destination.
-  BOOL write_success = WriteProcessMemory(
-      GetCurrentProcess(),
-      (void*) raw_address,
-      this->unpatched_buffer().data(),
-      this->unpatched_buffer().size(),
-      nullptr
-  );
+  GamePatchTransaction transaction;
+  transaction.Add(this);
 
-  if (!write_success) {
-    ::mdc::error::ExitOnWindowsFunctionError(
+  if (!transaction.Remove()) {
+    ::mdc::error::ExitOnGeneralError(
+        L"Error",
+        L"Could not remove the patch at 0x%X of size %u bytes. Its memory "
+            L"could not be made writable.",
         __FILEW__,
         __LINE__,
-        L"WriteProcessMemory",
-        GetLastError()
+        this->game_address().raw_address(),
+        this->patch_size()
     );
 
     return;
   }
-
-  this->is_patch_applied_ = false;
 }
 
 void GamePatch::swap(GamePatch& game_patch) noexcept {
@@ -194,8 +175,54 @@ void GamePatch::swap(GamePatch& game_patch) noexcept {
 void GamePatch::Swap(GamePatch& game_patch) noexcept {
   this->game_address_.Swap(game_patch.game_address_);
   ::std::swap(this->is_patch_applied_, game_patch.is_patch_applied_);
-  this->patch_buffer_.swap(game_patch.patch_buffer_);
-  this->unpatched_buffer_.swap(game_patch.unpatched_buffer_);
+  ::std::swap(this->patch_size_, game_patch.patch_size_);
+  this->inline_patch_buffer_.swap(game_patch.inline_patch_buffer_);
+  this->inline_unpatched_buffer_.swap(game_patch.inline_unpatched_buffer_);
+  this->large_buffers_.swap(game_patch.large_buffers_);
+}
+
+std::size_t GamePatch::GetInstructionBoundaryPatchSize(
+    const GameAddress& game_address,
+    std::size_t min_size
+) {
+  const std::uint8_t* code =
+      reinterpret_cast<const std::uint8_t*>(game_address.raw_address());
+
+  std::size_t patch_size = GetX86PatchSize(code, min_size);
+
+  if (patch_size == 0) {
+    ::mdc::error::ExitOnGeneralError(
+        L"Error",
+        L"Could not decode the instructions for the patch at 0x%X.",
+        __FILEW__,
+        __LINE__,
+        game_address.raw_address()
+    );
+
+    return 0;
+  }
+
+  if (IsX86PatchRangeBranchTarget(
+      code,
+      game_address.raw_address(),
+      patch_size,
+      kBranchSourceScanBeforeSize,
+      kBranchSourceScanAfterSize
+  )) {
+    ::mdc::error::ExitOnGeneralError(
+        L"Error",
+        L"The patch at 0x%X of size %u bytes overwrites the target of a "
+            L"branch.",
+        __FILEW__,
+        __LINE__,
+        game_address.raw_address(),
+        patch_size
+    );
+
+    return 0;
+  }
+
+  return patch_size;
 }
 
 const GameAddress& GamePatch::game_address() const noexcept {
@@ -206,13 +233,40 @@ bool GamePatch::is_patch_applied() const noexcept {
   return this->is_patch_applied_;
 }
 
-const std::vector<std::uint8_t>& GamePatch::patch_buffer() const noexcept {
-  return this->patch_buffer_;
+std::size_t GamePatch::patch_size() const noexcept {
+  return this->patch_size_;
+}
+
+const std::uint8_t* GamePatch::patch_buffer() const noexcept {
+  if (this->large_buffers_ != nullptr) {
+    return this->large_buffers_.get();
+  }
+
+  return this->inline_patch_buffer_.data();
+}
+
+std::uint8_t* GamePatch::patch_buffer() noexcept {
+  if (this->large_buffers_ != nullptr) {
+    return this->large_buffers_.get();
+  }
+
+  return this->inline_patch_buffer_.data();
 }
 
-const std::vector<std::uint8_t>&
-GamePatch::unpatched_buffer() const noexcept {
-  return this->unpatched_buffer_;
+const std::uint8_t* GamePatch::unpatched_buffer() const noexcept {
+  if (this->large_buffers_ != nullptr) {
+    return this->large_buffers_.get() + this->patch_size();
+  }
+
+  return this->inline_unpatched_buffer_.data();
+}
+
+std::uint8_t* GamePatch::unpatched_buffer() noexcept {
+  if (this->large_buffers_ != nullptr) {
+    return this->large_buffers_.get() + this->patch_size();
+  }
+
+  return this->inline_unpatched_buffer_.data();
 }
 
 } // namespace mapi
@@ -45,12 +45,45 @@
 
 #include "../../../include/cxx/game_patch.hpp"
 
+#include <algorithm>
+#include <utility>
+
 #include <mdc/error/exit_on_error.hpp>
 #include <mdc/wchar_t/filew.h>
 #include "../backend/architecture_opcode.hpp"
 
 namespace mapi {
 
+GamePatch GamePatch::MakeGameBackBranchPatch(
+    const GameAddress& game_address,
+    BranchType branch_type,
+    void (*func_ptr)()
+) {
+  return GamePatch::MakeGameBackBranchPatch(
+      GameAddress(game_address),
+      branch_type,
+      func_ptr
+  );
+}
+
+GamePatch GamePatch::MakeGameBackBranchPatch(
+    GameAddress&& game_address,
+    BranchType branch_type,
+    void (*func_ptr)()
+) {
+  std::size_t patch_size = GetInstructionBoundaryPatchSize(
+      game_address,
+      kBranchPatchMinSize
+  );
+
+  return GamePatch::MakeGameBackBranchPatch(
+      std::move(game_address),
+      branch_type,
+      func_ptr,
+      patch_size
+  );
+}
+
 GamePatch GamePatch::MakeGameBackBranchPatch(
     const GameAddress& game_address,
     BranchType branch_type,
@@ -71,12 +104,6 @@ GamePatch GamePatch::MakeGameBackBranchPatch(
     void (*func_ptr)(),
     std::size_t patch_size
 ) {
-  // Fill the buffer with NOPs.
-  std::vector<std::uint8_t> branch_patch_buffer(
-      patch_size,
-      static_cast<std::uint8_t>(OpCode::kNop)
-  );
-
   // Check that the patch size is large enough to allow the insertion of the
   // branch call.
   if (patch_size < kBranchPatchMinSize) {
@@ -93,10 +120,20 @@ GamePatch GamePatch::MakeGameBackBranchPatch(
 
     return GamePatch(
         GameAddress::FromOffset(L"", 0),
-        {}
+        0
     );
   }
 
+  // Fill the buffer with NOPs.
+  GamePatch game_patch(game_address, patch_size);
+  std::uint8_t* branch_patch_buffer = game_patch.patch_buffer();
+
+  std::fill_n(
+      branch_patch_buffer,
+      patch_size,
+      static_cast<std::uint8_t>(OpCode::kNop)
+  );
+
   // Set the (last - sizeof(func_ptr)) byte in the buffer to the branch
   // operation opcode byte.
   std::size_t back_branch_start = patch_size
@@ -104,7 +141,7 @@ GamePatch GamePatch::MakeGameBackBranchPatch(
 
   OpCode branch_opcode_value = ToOpcode(branch_type);
 
-  branch_patch_buffer.at(back_branch_start) =
+  branch_patch_buffer[back_branch_start] =
       static_cast<std::uint8_t>(branch_opcode_value);
 
   // Set the next bytes to the address of the inserted function.
@@ -113,14 +150,11 @@ GamePatch GamePatch::MakeGameBackBranchPatch(
       - patch_size;
 
   for (std::size_t i = 0; i < sizeof(func_buffer); i += 1) {
-    branch_patch_buffer.at(i + (back_branch_start + 1)) =
-        (func_buffer >> (i * (sizeof(branch_patch_buffer.at(0)) * 8))) & 0xFF;
+    branch_patch_buffer[i + (back_branch_start + 1)] =
+        (func_buffer >> (i * (sizeof(branch_patch_buffer[0]) * 8))) & 0xFF;
   }
 
-  return GamePatch(
-      std::move(game_address),
-      std::move(branch_patch_buffer)
-  );
+  return game_patch;
 }
 
 } // namespace mapi
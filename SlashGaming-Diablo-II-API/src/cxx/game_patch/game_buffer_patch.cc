@@ -45,6 +45,8 @@
 
 #include "../../../include/cxx/game_patch.hpp"
 
+#include <algorithm>
+
 namespace mapi {
 
 GamePatch GamePatch::MakeGameBufferPatch(
@@ -64,15 +66,10 @@ GamePatch GamePatch::MakeGameBufferPatch(
     const std::uint8_t* patch_buffer,
     std::size_t patch_size
 ) {
-  std::vector<std::uint8_t> patch_buffer_vector(
-      patch_buffer,
-      patch_buffer + patch_size
-  );
+  GamePatch game_patch(game_address, patch_size);
+  std::copy_n(patch_buffer, patch_size, game_patch.patch_buffer());
 
-  return GamePatch(
-      std::move(game_address),
-      std::move(patch_buffer_vector)
-  );
+  return game_patch;
 }
 
 } // namespace mapi
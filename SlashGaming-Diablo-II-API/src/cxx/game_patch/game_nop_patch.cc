@@ -45,6 +45,8 @@
 
 #include "../../../include/cxx/game_patch.hpp"
 
+#include <algorithm>
+
 #include "../backend/architecture_opcode.hpp"
 
 namespace mapi {
@@ -63,15 +65,14 @@ GamePatch GamePatch::MakeGameNopPatch(
     GameAddress&& game_address,
     std::size_t patch_size
 ) {
-  std::vector<std::uint8_t> patch_buffer(
+  GamePatch game_patch(game_address, patch_size);
+  std::fill_n(
+      game_patch.patch_buffer(),
       patch_size,
       static_cast<std::uint8_t>(OpCode::kNop)
   );
 
-  return GamePatch(
-      std::move(game_address),
-      std::move(patch_buffer)
-  );
+  return game_patch;
 }
 
 } // namespace mapi
@@ -0,0 +1,482 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "../../include/cxx/game_patch_transaction.hpp"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace mapi {
+namespace {
+
+#if defined(_WIN32)
+
+class ProcessPatchMemory : public GamePatchMemory {
+ public:
+  ProcessPatchMemory()
+      : page_size_(LoadPageSize()) {
+  }
+
+  bool MakePageWritable(
+      std::intptr_t page_address,
+      std::uint32_t* old_protection
+  ) override {
+    DWORD old_protection_dword;
+
+    BOOL is_virtual_protect_success = VirtualProtect(
+        reinterpret_cast<void*>(page_address),
+        this->page_size(),
+        PAGE_EXECUTE_READWRITE,
+        &old_protection_dword
+    );
+
+    *old_protection = old_protection_dword;
+
+    return is_virtual_protect_success;
+  }
+
+  bool RestorePageProtection(
+      std::intptr_t page_address,
+      std::uint32_t old_protection
+  ) override {
+    DWORD unused_old_protection;
+
+    return VirtualProtect(
+        reinterpret_cast<void*>(page_address),
+        this->page_size(),
+        old_protection,
+        &unused_old_protection
+    );
+  }
+
+  void Write(
+      std::intptr_t address,
+      const std::uint8_t* buffer,
+      std::size_t size
+  ) override {
+    std::copy_n(buffer, size, reinterpret_cast<std::uint8_t*>(address));
+  }
+
+  void FlushInstructionCache(
+      std::intptr_t address,
+      std::size_t size
+  ) override {
+    ::FlushInstructionCache(
+        GetCurrentProcess(),
+        reinterpret_cast<void*>(address),
+        size
+    );
+  }
+
+  std::size_t page_size() const override {
+    return this->page_size_;
+  }
+
+ private:
+  std::size_t page_size_;
+
+  static std::size_t LoadPageSize() {
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+
+    return system_info.dwPageSize;
+  }
+};
+
+#else
+
+/**
+ * The previous protection of a page cannot be queried, so pages are
+ * restored as code pages: readable and executable.
+ */
+class ProcessPatchMemory : public GamePatchMemory {
+ public:
+  ProcessPatchMemory()
+      : page_size_(sysconf(_SC_PAGESIZE)) {
+  }
+
+  bool MakePageWritable(
+      std::intptr_t page_address,
+      std::uint32_t* old_protection
+  ) override {
+    *old_protection = PROT_READ | PROT_EXEC;
+
+    int protect_result = mprotect(
+        reinterpret_cast<void*>(page_address),
+        this->page_size(),
+        PROT_READ | PROT_WRITE | PROT_EXEC
+    );
+
+    return protect_result == 0;
+  }
+
+  bool RestorePageProtection(
+      std::intptr_t page_address,
+      std::uint32_t old_protection
+  ) override {
+    int protect_result = mprotect(
+        reinterpret_cast<void*>(page_address),
+        this->page_size(),
+        old_protection
+    );
+
+    return protect_result == 0;
+  }
+
+  void Write(
+      std::intptr_t address,
+      const std::uint8_t* buffer,
+      std::size_t size
+  ) override {
+    std::copy_n(buffer, size, reinterpret_cast<std::uint8_t*>(address));
+  }
+
+  void FlushInstructionCache(
+      std::intptr_t address,
+      std::size_t size
+  ) override {
+    char* begin = reinterpret_cast<char*>(address);
+
+    __builtin___clear_cache(begin, begin + size);
+  }
+
+  std::size_t page_size() const override {
+    return this->page_size_;
+  }
+
+ private:
+  std::size_t page_size_;
+};
+
+#endif
+
+/**
+ * A contiguous range of bytes to write, formed by merging the buffers of
+ * adjacent or overlapping patches.
+ */
+struct PatchWriteRun {
+  std::intptr_t address;
+  std::vector<std::uint8_t> buffer;
+
+  std::intptr_t end_address() const noexcept {
+    return this->address + this->buffer.size();
+  }
+};
+
+struct PatchWrite {
+  std::intptr_t address;
+  const std::uint8_t* buffer;
+  std::size_t size;
+};
+
+/**
+ * Merges sorted writes into runs. Returns false if two writes overlap with
+ * different values.
+ */
+static bool MergePatchWrites(
+    const std::vector<PatchWrite>& writes,
+    std::vector<PatchWriteRun>* runs
+) {
+  for (const PatchWrite& write : writes) {
+    if (runs->empty() || write.address > runs->back().end_address()) {
+      runs->push_back(PatchWriteRun {
+          write.address,
+          std::vector<std::uint8_t>(write.buffer, write.buffer + write.size)
+      });
+
+      continue;
+    }
+
+    PatchWriteRun& run = runs->back();
+
+    std::size_t run_offset = write.address - run.address;
+    std::size_t overlap_size = std::min(
+        write.size,
+        run.buffer.size() - run_offset
+    );
+
+    bool is_overlap_equal = std::equal(
+        write.buffer,
+        write.buffer + overlap_size,
+        run.buffer.cbegin() + run_offset
+    );
+
+    if (!is_overlap_equal) {
+      return false;
+    }
+
+    run.buffer.insert(
+        run.buffer.cend(),
+        write.buffer + overlap_size,
+        write.buffer + write.size
+    );
+  }
+
+  return true;
+}
+
+/**
+ * Returns whether the range overlaps any of the applied ranges.
+ */
+static bool IsOverlappingAppliedRange(
+    const std::multimap<std::intptr_t, std::size_t>& applied_ranges,
+    std::intptr_t address,
+    std::size_t size
+) {
+  std::intptr_t end_address = address + size;
+
+  // Ranges that start at or after the end cannot overlap. Of the ranges
+  // that start before it, any could reach into the range, since patches
+  // have different sizes.
+  auto ranges_end = applied_ranges.lower_bound(end_address);
+
+  for (auto it = applied_ranges.cbegin(); it != ranges_end; ++it) {
+    if (static_cast<std::intptr_t>(it->first + it->second) > address) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static void EraseAppliedRange(
+    std::multimap<std::intptr_t, std::size_t>* applied_ranges,
+    std::intptr_t address,
+    std::size_t size
+) {
+  auto [first, last] = applied_ranges->equal_range(address);
+
+  for (auto it = first; it != last; ++it) {
+    if (it->second == size) {
+      applied_ranges->erase(it);
+      return;
+    }
+  }
+}
+
+} // namespace
+
+GamePatchMemory::GamePatchMemory()
+    : commit_mutex_(),
+      applied_ranges_() {
+}
+
+GamePatchMemory::~GamePatchMemory() = default;
+
+GamePatchMemory& GamePatchMemory::GetProcessMemory() {
+  static ProcessPatchMemory process_patch_memory;
+
+  return process_patch_memory;
+}
+
+GamePatchTransaction::GamePatchTransaction()
+    : GamePatchTransaction(GamePatchMemory::GetProcessMemory()) {
+}
+
+GamePatchTransaction::GamePatchTransaction(GamePatchMemory& memory)
+    : memory_(&memory),
+      game_patches_() {
+}
+
+GamePatchTransaction::GamePatchTransaction(
+    GamePatchTransaction&& transaction
+) noexcept = default;
+
+GamePatchTransaction::~GamePatchTransaction() = default;
+
+GamePatchTransaction& GamePatchTransaction::operator=(
+    GamePatchTransaction&& transaction
+) noexcept = default;
+
+void GamePatchTransaction::Add(GamePatch* game_patch) {
+  this->game_patches_.push_back(game_patch);
+}
+
+bool GamePatchTransaction::Apply() {
+  return this->Commit(true);
+}
+
+bool GamePatchTransaction::Remove() {
+  return this->Commit(false);
+}
+
+bool GamePatchTransaction::Commit(bool is_apply) {
+  std::lock_guard commit_lock(this->memory_->commit_mutex_);
+
+  std::multimap<std::intptr_t, std::size_t>& applied_ranges =
+      this->memory_->applied_ranges_;
+
+  std::vector<GamePatch*> committed_patches;
+  std::vector<PatchWrite> writes;
+
+  for (GamePatch* game_patch : this->game_patches_) {
+    if (game_patch->is_patch_applied() == is_apply) {
+      continue;
+    }
+
+    // Writing over a live patch would make the removal of either patch
+    // restore the wrong bytes.
+    if (is_apply
+        && IsOverlappingAppliedRange(
+            applied_ranges,
+            game_patch->game_address().raw_address(),
+            game_patch->patch_size()
+        )) {
+      return false;
+    }
+
+    const std::uint8_t* buffer = is_apply
+        ? game_patch->patch_buffer()
+        : game_patch->unpatched_buffer();
+
+    committed_patches.push_back(game_patch);
+    writes.push_back(PatchWrite {
+        game_patch->game_address().raw_address(),
+        buffer,
+        game_patch->patch_size()
+    });
+  }
+
+  std::sort(
+      writes.begin(),
+      writes.end(),
+      [](const PatchWrite& write1, const PatchWrite& write2) {
+        return write1.address < write2.address;
+      }
+  );
+
+  std::vector<PatchWriteRun> runs;
+
+  if (!MergePatchWrites(writes, &runs)) {
+    return false;
+  }
+
+  // Collect each touched page once. Runs are sorted and disjoint, so the
+  // pages are collected in ascending order.
+  std::intptr_t page_mask =
+      ~static_cast<std::intptr_t>(this->memory_->page_size() - 1);
+
+  std::vector<std::pair<std::intptr_t, std::uint32_t>> pages;
+
+  for (const PatchWriteRun& run : runs) {
+    if (run.buffer.empty()) {
+      continue;
+    }
+
+    for (std::intptr_t page_address = run.address & page_mask;
+        page_address < run.end_address();
+        page_address += this->memory_->page_size()) {
+      if (pages.empty() || pages.back().first != page_address) {
+        pages.emplace_back(page_address, 0);
+      }
+    }
+  }
+
+  for (std::size_t i = 0; i < pages.size(); i += 1) {
+    bool is_writable = this->memory_->MakePageWritable(
+        pages[i].first,
+        &pages[i].second
+    );
+
+    if (is_writable) {
+      continue;
+    }
+
+    // Roll back the pages that were made writable, leaving memory as it
+    // was before the commit.
+    for (std::size_t j = 0; j < i; j += 1) {
+      this->memory_->RestorePageProtection(pages[j].first, pages[j].second);
+    }
+
+    return false;
+  }
+
+  for (const PatchWriteRun& run : runs) {
+    this->memory_->Write(run.address, run.buffer.data(), run.buffer.size());
+  }
+
+  for (const std::pair<std::intptr_t, std::uint32_t>& page : pages) {
+    this->memory_->RestorePageProtection(page.first, page.second);
+  }
+
+  // Runs may be far apart, even in different modules, so flush each one
+  // rather than the span from the first to the last.
+  for (const PatchWriteRun& run : runs) {
+    if (run.buffer.empty()) {
+      continue;
+    }
+
+    this->memory_->FlushInstructionCache(run.address, run.buffer.size());
+  }
+
+  for (GamePatch* game_patch : committed_patches) {
+    game_patch->is_patch_applied_ = is_apply;
+
+    std::intptr_t address = game_patch->game_address().raw_address();
+    std::size_t size = game_patch->patch_size();
+
+    if (is_apply) {
+      applied_ranges.emplace(address, size);
+    } else {
+      EraseAppliedRange(&applied_ranges, address, size);
+    }
+  }
+
+  return true;
+}
+
+} // namespace mapi
@@ -45,27 +45,11 @@
 
 #include "../../../../include/cxx/game_struct/d2_cel_context.hpp"
 
-#include "../../../../include/cxx/game_version.hpp"
-
 namespace d2 {
 
 CelContext_View::CelContext_View(
     const CelContext* cel_context
-) noexcept : cel_context_(CreateVariant(cel_context)) {
-}
-
-CelContext_View::ViewVariant CelContext_View::CreateVariant(
-    const CelContext* cel_context
-) {
-  GameVersion running_game_version = ::d2::game_version::GetRunning();
-
-  if (running_game_version <= GameVersion::k1_10) {
-    return reinterpret_cast<const CelContext_1_00*>(cel_context);
-  } else if (running_game_version == GameVersion::k1_12A) {
-    return reinterpret_cast<const CelContext_1_12A*>(cel_context);
-  } else /* if (running_game_version >= GameVersion::k1_13ABeta) */ {
-    return reinterpret_cast<const CelContext_1_13C*>(cel_context);
-  }
+) noexcept : CelContext_View(cel_context, GetRunningCelContextLayout()) {
 }
 
 } // namespace d2
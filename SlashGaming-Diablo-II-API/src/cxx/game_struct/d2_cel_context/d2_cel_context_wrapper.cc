@@ -48,13 +48,12 @@
 #include "../../../../include/cxx/game_function/d2cmp/d2cmp_get_cel_from_cel_context.hpp"
 #include "../../../../include/cxx/game_function/d2gfx/d2gfx_draw_cel_context.hpp"
 #include "../../../../include/cxx/game_struct/d2_cel/d2_cel_view.hpp"
-#include "../../../../include/cxx/game_version.hpp"
 
 namespace d2 {
 
 CelContext_Wrapper::CelContext_Wrapper(
     CelContext* cel_context
-) noexcept : cel_context_(CreateVariant(cel_context)) {
+) noexcept : CelContext_Wrapper(cel_context, GetRunningCelContextLayout()) {
 }
 
 bool CelContext_Wrapper::DrawFrame(int position_x, int position_y) {
@@ -130,18 +129,4 @@ Cel* CelContext_Wrapper::GetCel() {
   return d2::d2cmp::GetCelFromCelContext(this->Get());
 }
 
-CelContext_Wrapper::WrapperVariant CelContext_Wrapper::CreateVariant(
-    CelContext* cel_context
-) {
-  GameVersion running_game_version = ::d2::game_version::GetRunning();
-
-  if (running_game_version <= GameVersion::k1_10) {
-    return reinterpret_cast<CelContext_1_00*>(cel_context);
-  } else if (running_game_version == GameVersion::k1_12A) {
-    return reinterpret_cast<CelContext_1_12A*>(cel_context);
-  } else /* if (running_game_version >= GameVersion::k1_13ABeta) */ {
-    return reinterpret_cast<CelContext_1_13C*>(cel_context);
-  }
-}
-
 } // namespace d2
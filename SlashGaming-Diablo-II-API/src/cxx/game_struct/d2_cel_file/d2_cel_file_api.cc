@@ -65,9 +65,11 @@ CelFile_Api::CelFile_Api(
 
 CelFile_Api::CelFile_Api(CelFile_Api&& other) noexcept :
     cel_file_(std::move(other.cel_file_)),
-    is_open_(std::move(other.is_open_)) {
+    is_open_(std::move(other.is_open_)),
+    metadata_(std::move(other.metadata_)) {
   other.cel_file_ = nullptr;
   other.is_open_ = false;
+  other.metadata_.Clear();
 }
 
 CelFile_Api::~CelFile_Api() {
@@ -77,9 +79,11 @@ CelFile_Api::~CelFile_Api() {
 CelFile_Api& CelFile_Api::operator=(CelFile_Api&& other) noexcept {
   this->cel_file_ = std::move(other.cel_file_);
   this->is_open_ = std::move(other.is_open_);
+  this->metadata_ = std::move(other.metadata_);
 
   other.cel_file_ = nullptr;
   other.is_open_ = false;
+  other.metadata_.Clear();
 
   return *this;
 }
@@ -111,6 +115,7 @@ void CelFile_Api::Close() {
   d2win::UnloadCelFile(this->Get_());
   this->cel_file_ = nullptr;
   this->is_open_ = false;
+  this->metadata_.Clear();
 }
 
 bool CelFile_Api::DrawFrame(
@@ -153,13 +158,19 @@ bool CelFile_Api::DrawAllFrames(
     unsigned int columns,
     unsigned int rows
 ) {
-  CelFile_Wrapper wrapper(this->Get_());
-
-  return wrapper.DrawAllFrames(
+  DrawAllCelFileFramesOptions all_frames_options;
+  all_frames_options.color = mapi::Rgba32BitColor();
+  all_frames_options.draw_effect = DrawEffect::kNone;
+  all_frames_options.cel_file_direction = 0;
+  all_frames_options.position_x_behavior = DrawPositionXBehavior::kLeft;
+  all_frames_options.position_y_behavior = DrawPositionYBehavior::kBottom;
+
+  return this->DrawAllFrames(
       position_x,
       position_y,
       columns,
-      rows
+      rows,
+      all_frames_options
   );
 }
 
@@ -177,7 +188,8 @@ bool CelFile_Api::DrawAllFrames(
       position_y,
       columns,
       rows,
-      all_frames_options
+      all_frames_options,
+      this->metadata_
   );
 }
 
@@ -187,6 +199,10 @@ Cel_View CelFile_Api::GetCel(unsigned int direction, unsigned int frame) {
   return wrapper.GetCel(direction, frame);
 }
 
+const CelFileMetadata& CelFile_Api::GetMetadata() const noexcept {
+  return this->metadata_;
+}
+
 bool CelFile_Api::IsOpen() const {
   return this->is_open_;
 }
@@ -203,6 +219,10 @@ void CelFile_Api::Open(
   );
 
   this->is_open_ = (this->Get_() != nullptr);
+
+  if (this->is_open_) {
+    this->metadata_ = CelFileMetadata(CelFile_Wrapper(this->Get_()));
+  }
 }
 
 CelFile_Api::ApiVariant CelFile_Api::CreateVariant(
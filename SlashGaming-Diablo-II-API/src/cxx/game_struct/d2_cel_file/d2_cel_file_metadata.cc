@@ -0,0 +1,216 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "../../../../include/cxx/game_struct/d2_cel_file/d2_cel_file_metadata.hpp"
+
+#include "../../../../include/cxx/game_struct/d2_cel/d2_cel_view.hpp"
+
+namespace d2 {
+namespace {
+
+static std::vector<const Cel*> GetAllCels(CelFile_Wrapper cel_file) {
+  unsigned int num_directions = cel_file.GetNumDirections();
+  unsigned int num_frames = cel_file.GetNumFrames();
+
+  std::vector<const Cel*> cels;
+  cels.reserve(static_cast<std::size_t>(num_directions) * num_frames);
+
+  for (unsigned int direction = 0; direction < num_directions; direction += 1) {
+    for (unsigned int frame = 0; frame < num_frames; frame += 1) {
+      cels.push_back(cel_file.GetCel(direction, frame).Get());
+    }
+  }
+
+  return cels;
+}
+
+} // namespace
+
+CelFileMetadata::CelFileMetadata() noexcept
+    : num_directions_(0),
+      num_frames_(0) {
+}
+
+CelFileMetadata::CelFileMetadata(CelFile_Wrapper cel_file)
+    : CelFileMetadata(
+          cel_file.GetNumDirections(),
+          cel_file.GetNumFrames(),
+          GetAllCels(cel_file).data()
+      ) {
+}
+
+CelFileMetadata::CelFileMetadata(
+    unsigned int num_directions,
+    unsigned int num_frames,
+    const Cel* const* cels
+) : num_directions_(num_directions),
+    num_frames_(num_frames) {
+  std::size_t cel_count = static_cast<std::size_t>(num_directions)
+      * num_frames;
+
+  this->widths_.resize(cel_count);
+  this->heights_.resize(cel_count);
+  this->offsets_x_.resize(cel_count);
+  this->offsets_y_.resize(cel_count);
+
+  for (std::size_t i = 0; i < cel_count; i += 1) {
+    Cel_View cel_view(cels[i]);
+
+    this->widths_[i] = cel_view.GetWidth();
+    this->heights_[i] = cel_view.GetHeight();
+    this->offsets_x_[i] = cel_view.GetOffsetX();
+    this->offsets_y_[i] = cel_view.GetOffsetY();
+  }
+
+  this->width_prefix_sums_.resize(cel_count + num_directions);
+
+  for (unsigned int direction = 0; direction < num_directions; direction += 1) {
+    std::size_t first_index = this->GetIndex(direction, 0);
+    int* prefix_sums = &this->width_prefix_sums_[first_index + direction];
+
+    prefix_sums[0] = 0;
+    for (unsigned int frame = 0; frame < num_frames; frame += 1) {
+      prefix_sums[frame + 1] = prefix_sums[frame]
+          + this->widths_[first_index + frame];
+    }
+  }
+}
+
+CelFileMetadata::CelFileMetadata(const CelFileMetadata& other) = default;
+
+CelFileMetadata::CelFileMetadata(
+    CelFileMetadata&& other
+) noexcept = default;
+
+CelFileMetadata::~CelFileMetadata() = default;
+
+CelFileMetadata& CelFileMetadata::operator=(
+    const CelFileMetadata& other
+) = default;
+
+CelFileMetadata& CelFileMetadata::operator=(
+    CelFileMetadata&& other
+) noexcept = default;
+
+int CelFileMetadata::GetWidth(
+    unsigned int direction,
+    unsigned int frame
+) const noexcept {
+  return this->widths_[this->GetIndex(direction, frame)];
+}
+
+int CelFileMetadata::GetHeight(
+    unsigned int direction,
+    unsigned int frame
+) const noexcept {
+  return this->heights_[this->GetIndex(direction, frame)];
+}
+
+int CelFileMetadata::GetOffsetX(
+    unsigned int direction,
+    unsigned int frame
+) const noexcept {
+  return this->offsets_x_[this->GetIndex(direction, frame)];
+}
+
+int CelFileMetadata::GetOffsetY(
+    unsigned int direction,
+    unsigned int frame
+) const noexcept {
+  return this->offsets_y_[this->GetIndex(direction, frame)];
+}
+
+int CelFileMetadata::GetFramesWidth(
+    unsigned int direction,
+    unsigned int first_frame,
+    unsigned int frame_count
+) const noexcept {
+  const int* prefix_sums = &this->width_prefix_sums_[
+      this->GetIndex(direction, 0) + direction
+  ];
+
+  return prefix_sums[first_frame + frame_count] - prefix_sums[first_frame];
+}
+
+bool CelFileMetadata::HasFrameGrid(
+    unsigned int direction,
+    unsigned int columns,
+    unsigned int rows
+) const noexcept {
+  return direction < this->num_directions_
+      && static_cast<std::size_t>(columns) * rows <= this->num_frames_;
+}
+
+void CelFileMetadata::Clear() noexcept {
+  this->num_directions_ = 0;
+  this->num_frames_ = 0;
+
+  this->widths_.clear();
+  this->heights_.clear();
+  this->offsets_x_.clear();
+  this->offsets_y_.clear();
+  this->width_prefix_sums_.clear();
+}
+
+bool CelFileMetadata::empty() const noexcept {
+  return this->widths_.empty();
+}
+
+unsigned int CelFileMetadata::num_directions() const noexcept {
+  return this->num_directions_;
+}
+
+unsigned int CelFileMetadata::num_frames() const noexcept {
+  return this->num_frames_;
+}
+
+std::size_t CelFileMetadata::GetIndex(
+    unsigned int direction,
+    unsigned int frame
+) const noexcept {
+  return (static_cast<std::size_t>(direction) * this->num_frames_) + frame;
+}
+
+} // namespace d2
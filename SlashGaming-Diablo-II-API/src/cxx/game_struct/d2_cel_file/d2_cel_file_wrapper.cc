@@ -46,15 +46,100 @@
 #include "../../../../include/cxx/game_struct/d2_cel_file/d2_cel_file_wrapper.hpp"
 
 #include <windows.h>
-#include <vector>
+#include <cstddef>
 
 #include <mdc/error/exit_on_error.hpp>
 #include <mdc/wchar_t/filew.h>
 #include "../../../../include/cxx/game_function/d2gfx/d2gfx_draw_cel_context.hpp"
 #include "../../../../include/cxx/game_struct/d2_cel/d2_cel_view.hpp"
 #include "../../../../include/cxx/game_struct/d2_cel_context/d2_cel_context_api.hpp"
+#include "../../../../include/cxx/game_struct/d2_cel_file/d2_cel_file_metadata.hpp"
 
 namespace d2 {
+namespace {
+
+static void ExitOnFrameGridOutOfBounds(
+    unsigned int direction,
+    unsigned int columns,
+    unsigned int rows
+) {
+  ::mdc::error::ExitOnGeneralError(
+      L"Error",
+      L"Grid of %u columns and %u rows is out of bounds for direction "
+          L"%u.",
+      __FILEW__,
+      __LINE__,
+      columns,
+      rows,
+      direction
+  );
+}
+
+static int GetStartingPositionX(
+    int position_x,
+    int cels_total_width,
+    DrawPositionXBehavior position_x_behavior
+) {
+  switch (position_x_behavior) {
+    case DrawPositionXBehavior::kLeft: {
+      return position_x;
+    }
+
+    case DrawPositionXBehavior::kCenter: {
+      return position_x - (cels_total_width / 2);
+    }
+
+    case DrawPositionXBehavior::kRight: {
+      return position_x - cels_total_width;
+    }
+
+    default: {
+      ::mdc::error::ExitOnGeneralError(
+          L"Error",
+          L"Invalid value for DrawPositionXBehavior: %d.",
+          __FILEW__,
+          __LINE__,
+          static_cast<int>(position_x_behavior)
+      );
+
+      return 0;
+    }
+  }
+}
+
+static int GetStartingPositionY(
+    int position_y,
+    int cels_total_height,
+    DrawPositionYBehavior position_y_behavior
+) {
+  switch (position_y_behavior) {
+    case DrawPositionYBehavior::kTop: {
+      return position_y;
+    }
+
+    case DrawPositionYBehavior::kCenter: {
+      return position_y - (cels_total_height / 2);
+    }
+
+    case DrawPositionYBehavior::kBottom: {
+      return position_y - cels_total_height;
+    }
+
+    default: {
+      ::mdc::error::ExitOnGeneralError(
+          L"Error",
+          L"Invalid value for DrawPositionYBehavior: %d.",
+          __FILEW__,
+          __LINE__,
+          static_cast<int>(position_y_behavior)
+      );
+
+      return 0;
+    }
+  }
+}
+
+} // namespace
 
 CelFile_Wrapper::CelFile_Wrapper(
     CelFile* cel_file
@@ -129,114 +214,160 @@ bool CelFile_Wrapper::DrawAllFrames(
     unsigned int rows,
     const DrawAllCelFileFramesOptions& all_frames_options
 ) {
-  // Look into the related Cels and determine the width and height.
-  std::vector<Cel_View> cel_views;
-  for (unsigned int current_row = 0; current_row < rows; current_row += 1) {
-    for (unsigned int current_column = 0; current_column < columns; current_column += 1) {
-      unsigned int current_frame = current_column + (current_row * columns);
+  unsigned int direction = all_frames_options.cel_file_direction;
 
-      cel_views.push_back(this->GetCel(all_frames_options.cel_file_direction, current_frame));
-    }
+  if (direction >= this->GetNumDirections()
+      || static_cast<std::size_t>(columns) * rows > this->GetNumFrames()) {
+    ExitOnFrameGridOutOfBounds(direction, columns, rows);
+
+    return false;
   }
 
+  // Without metadata, each cel is read through the context as it is
+  // needed. Determine the width and height from the first row and
+  // column.
+  CelContext_Api cel_context(this->Get(), direction, 0);
+
   int cels_total_width = 0;
-  for (unsigned int current_column = 0; current_column < columns; current_column += 1) {
-    cels_total_width += cel_views.at(current_column).GetWidth();
+  for (unsigned int current_column = 0;
+      current_column < columns;
+      current_column += 1) {
+    cel_context.SetFrameIndex(current_column);
+    cels_total_width += Cel_View(cel_context.GetCel()).GetWidth();
   }
 
   int cels_total_height = 0;
   for (unsigned int current_row = 0; current_row < rows; current_row += 1) {
-    cels_total_height += cel_views.at(current_row * columns).GetHeight();
+    cel_context.SetFrameIndex(current_row * columns);
+    cels_total_height += Cel_View(cel_context.GetCel()).GetHeight();
   }
 
-  // Determine starting positions.
-  int starting_position_x = position_x;
-  switch (all_frames_options.position_x_behavior) {
-    case DrawPositionXBehavior::kLeft: {
-      break;
-    }
+  int starting_position_x = GetStartingPositionX(
+      position_x,
+      cels_total_width,
+      all_frames_options.position_x_behavior
+  );
+  int starting_position_y = GetStartingPositionY(
+      position_y,
+      cels_total_height,
+      all_frames_options.position_y_behavior
+  );
 
-    case DrawPositionXBehavior::kCenter: {
-      starting_position_x -= cels_total_width / 2;
-      break;
-    }
+  // Draw the cels, from left to right, top to bottom. The game draws a
+  // cel from its bottom-left corner, so each cel is moved down by its
+  // height to line up the top edges of a row.
+  unsigned int bgra_color = all_frames_options.color.ToBgra();
 
-    case DrawPositionXBehavior::kRight: {
-      starting_position_x -= cels_total_width;
-      break;
-    }
+  bool is_all_success = true;
 
-    default: {
-      ::mdc::error::ExitOnGeneralError(
-          L"Error",
-          L"Invalid value for DrawPositionXBehavior: %d.",
-          __FILEW__,
-          __LINE__,
-          static_cast<int>(all_frames_options.position_x_behavior)
+  int current_covered_height = 0;
+  for (unsigned int current_row = 0; current_row < rows; current_row += 1) {
+    int current_covered_width = 0;
+    int row_height = 0;
+
+    for (unsigned int current_column = 0;
+        current_column < columns;
+        current_column += 1) {
+      cel_context.SetFrameIndex(current_row * columns + current_column);
+      Cel_View cel_view(cel_context.GetCel());
+
+      bool is_success = d2gfx::DrawCelContext(
+          cel_context.Get(),
+          starting_position_x + current_covered_width,
+          starting_position_y + current_covered_height
+              + cel_view.GetHeight(),
+          bgra_color,
+          all_frames_options.draw_effect,
+          nullptr
       );
 
-      return false;
+      is_all_success = is_all_success && is_success;
+
+      if (current_column == 0) {
+        row_height = cel_view.GetHeight();
+      }
+
+      current_covered_width += cel_view.GetWidth();
     }
+
+    current_covered_height += row_height;
   }
 
-  int starting_position_y = position_y;
-  switch (all_frames_options.position_y_behavior) {
-    case DrawPositionYBehavior::kTop: {
-      break;
-    }
+  return is_all_success;
+}
 
-    case DrawPositionYBehavior::kCenter: {
-      starting_position_y -= (cels_total_height / 2);
-      break;
-    }
+bool CelFile_Wrapper::DrawAllFrames(
+    int position_x,
+    int position_y,
+    unsigned int columns,
+    unsigned int rows,
+    const DrawAllCelFileFramesOptions& all_frames_options,
+    const CelFileMetadata& metadata
+) {
+  unsigned int direction = all_frames_options.cel_file_direction;
 
-    case DrawPositionYBehavior::kBottom: {
-      starting_position_y -= cels_total_height;
-      break;
-    }
+  if (!metadata.HasFrameGrid(direction, columns, rows)) {
+    ExitOnFrameGridOutOfBounds(direction, columns, rows);
 
-    default: {
-      ::mdc::error::ExitOnGeneralError(
-          L"Error",
-          L"Invalid value for DrawPositionYBehavior: %d.",
-          __FILEW__,
-          __LINE__,
-          static_cast<int>(all_frames_options.position_x_behavior)
-      );
+    return false;
+  }
 
-      return false;
-    }
+  // Determine the width and height from the first row and column.
+  int cels_total_width = metadata.GetFramesWidth(direction, 0, columns);
+
+  int cels_total_height = 0;
+  for (unsigned int current_row = 0; current_row < rows; current_row += 1) {
+    cels_total_height += metadata.GetHeight(direction, current_row * columns);
   }
 
-  // Draw the cels, from left to right, top to bottom.
-  DrawCelFileFrameOptions frame_options;
-  frame_options.color = all_frames_options.color;
-  frame_options.draw_effect = all_frames_options.draw_effect;
-  frame_options.position_x_behavior = DrawPositionXBehavior::kLeft;
-  frame_options.position_y_behavior = DrawPositionYBehavior::kTop;
+  int starting_position_x = GetStartingPositionX(
+      position_x,
+      cels_total_width,
+      all_frames_options.position_x_behavior
+  );
+  int starting_position_y = GetStartingPositionY(
+      position_y,
+      cels_total_height,
+      all_frames_options.position_y_behavior
+  );
+
+  // Draw the cels, from left to right, top to bottom. The game draws a
+  // cel from its bottom-left corner, so each cel is moved down by its
+  // height to line up the top edges of a row.
+  unsigned int bgra_color = all_frames_options.color.ToBgra();
+  CelContext_Api cel_context(this->Get(), direction, 0);
 
   bool is_all_success = true;
 
   int current_covered_height = 0;
   for (unsigned int current_row = 0; current_row < rows; current_row += 1) {
-    int current_covered_width = 0;
-
-    for (unsigned int current_column = 0; current_column < columns; current_column += 1) {
-      unsigned int current_frame = current_column + (current_row * columns);
+    unsigned int row_first_frame = current_row * columns;
+
+    for (unsigned int current_column = 0;
+        current_column < columns;
+        current_column += 1) {
+      unsigned int current_frame = row_first_frame + current_column;
+      int current_covered_width = metadata.GetFramesWidth(
+          direction,
+          row_first_frame,
+          current_column
+      );
 
-      CelContext_Api cel_context(this->Get(), all_frames_options.cel_file_direction, current_frame);
-      bool is_success = cel_context.DrawFrame(
+      cel_context.SetFrameIndex(current_frame);
+      bool is_success = d2gfx::DrawCelContext(
+          cel_context.Get(),
           starting_position_x + current_covered_width,
-          starting_position_y + current_covered_height,
-          frame_options
+          starting_position_y + current_covered_height
+              + metadata.GetHeight(direction, current_frame),
+          bgra_color,
+          all_frames_options.draw_effect,
+          nullptr
       );
 
       is_all_success = is_all_success && is_success;
-
-      current_covered_width += cel_views.at(current_frame).GetWidth();
     }
 
-    current_covered_height += cel_views.at(current_row * columns).GetHeight();
+    current_covered_height += metadata.GetHeight(direction, row_first_frame);
   }
 
   return is_all_success;
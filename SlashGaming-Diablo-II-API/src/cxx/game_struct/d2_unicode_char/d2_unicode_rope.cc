@@ -0,0 +1,498 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "../../../../include/cxx/game_struct/d2_unicode_char/d2_unicode_rope.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace d2 {
+
+/**
+ * A node of an implicit treap. Each node owns one segment of the string,
+ * and the in-order traversal of the tree spells out the whole string.
+ * Priorities are kept as a max-heap so that the tree stays balanced in
+ * expectation.
+ */
+struct UnicodeRopeNode {
+  static constexpr int kMaxSegmentLength = 64;
+
+  std::unique_ptr<UnicodeRopeNode> left;
+  std::unique_ptr<UnicodeRopeNode> right;
+  std::uint32_t priority;
+  int subtree_length;
+  int segment_length;
+  UnicodeChar_1_00 segment[kMaxSegmentLength];
+};
+
+namespace {
+
+using NodePtr = std::unique_ptr<UnicodeRopeNode>;
+using NodePair = std::pair<NodePtr, NodePtr>;
+
+static int GetSubtreeLength(const NodePtr& node) noexcept {
+  return (node == nullptr) ? 0 : node->subtree_length;
+}
+
+static void UpdateSubtreeLength(UnicodeRopeNode& node) noexcept {
+  node.subtree_length = GetSubtreeLength(node.left)
+      + node.segment_length
+      + GetSubtreeLength(node.right);
+}
+
+static NodePtr Merge(NodePtr left, NodePtr right) {
+  if (left == nullptr) {
+    return right;
+  }
+
+  if (right == nullptr) {
+    return left;
+  }
+
+  if (left->priority > right->priority) {
+    left->right = Merge(std::move(left->right), std::move(right));
+    UpdateSubtreeLength(*left);
+
+    return left;
+  } else {
+    right->left = Merge(std::move(left), std::move(right->left));
+    UpdateSubtreeLength(*right);
+
+    return right;
+  }
+}
+
+/**
+ * Splits the tree so that the first part holds the first pos code units.
+ * A segment that straddles pos is divided into two nodes; the new node
+ * takes the given priority.
+ */
+static NodePair Split(NodePtr node, int pos, std::uint32_t new_priority) {
+  if (node == nullptr) {
+    return NodePair();
+  }
+
+  int left_length = GetSubtreeLength(node->left);
+
+  if (pos <= left_length) {
+    NodePair split_left = Split(std::move(node->left), pos, new_priority);
+    node->left = std::move(split_left.second);
+    UpdateSubtreeLength(*node);
+
+    return NodePair(std::move(split_left.first), std::move(node));
+  }
+
+  int segment_pos = pos - left_length;
+
+  if (segment_pos >= node->segment_length) {
+    NodePair split_right = Split(
+        std::move(node->right),
+        segment_pos - node->segment_length,
+        new_priority
+    );
+    node->right = std::move(split_right.first);
+    UpdateSubtreeLength(*node);
+
+    return NodePair(std::move(node), std::move(split_right.second));
+  }
+
+  // Move the end of the segment into a new node, which is then merged
+  // with the old right subtree to keep the heap order intact.
+  NodePtr tail = std::make_unique<UnicodeRopeNode>();
+  tail->priority = new_priority;
+  tail->segment_length = node->segment_length - segment_pos;
+  std::copy_n(
+      &node->segment[segment_pos],
+      tail->segment_length,
+      tail->segment
+  );
+  UpdateSubtreeLength(*tail);
+
+  NodePtr old_right = std::move(node->right);
+  node->segment_length = segment_pos;
+  UpdateSubtreeLength(*node);
+
+  return NodePair(
+      std::move(node),
+      Merge(std::move(tail), std::move(old_right))
+  );
+}
+
+static NodePtr Clone(const NodePtr& node) {
+  if (node == nullptr) {
+    return nullptr;
+  }
+
+  NodePtr clone = std::make_unique<UnicodeRopeNode>();
+  clone->left = Clone(node->left);
+  clone->right = Clone(node->right);
+  clone->priority = node->priority;
+  clone->subtree_length = node->subtree_length;
+  clone->segment_length = node->segment_length;
+  std::copy_n(node->segment, node->segment_length, clone->segment);
+
+  return clone;
+}
+
+/**
+ * Appends as much of the source as fits into the last segment of the
+ * tree. Returns the number of code units appended.
+ */
+static int FillLastSegment(
+    UnicodeRopeNode* node,
+    const UnicodeChar_1_00* src,
+    int count
+) {
+  if (node == nullptr) {
+    return 0;
+  }
+
+  int filled_count;
+  if (node->right != nullptr) {
+    filled_count = FillLastSegment(node->right.get(), src, count);
+  } else {
+    filled_count = std::min(
+        count,
+        UnicodeRopeNode::kMaxSegmentLength - node->segment_length
+    );
+
+    std::copy_n(src, filled_count, &node->segment[node->segment_length]);
+    node->segment_length += filled_count;
+  }
+
+  node->subtree_length += filled_count;
+
+  return filled_count;
+}
+
+/**
+ * Copies count code units starting from pos into dest.
+ */
+static void CopyRange(
+    const UnicodeRopeNode* node,
+    int pos,
+    int count,
+    UnicodeChar_1_00* dest
+) {
+  while (node != nullptr && count > 0) {
+    int left_length = GetSubtreeLength(node->left);
+
+    if (pos < left_length) {
+      int left_count = std::min(count, left_length - pos);
+      CopyRange(node->left.get(), pos, left_count, dest);
+
+      dest += left_count;
+      count -= left_count;
+      pos = left_length;
+    }
+
+    int segment_pos = pos - left_length;
+    if (count > 0 && segment_pos < node->segment_length) {
+      int segment_count = std::min(count, node->segment_length - segment_pos);
+      std::copy_n(&node->segment[segment_pos], segment_count, dest);
+
+      dest += segment_count;
+      count -= segment_count;
+      pos += segment_count;
+    }
+
+    // Continue in the right subtree without recursing.
+    pos -= left_length + node->segment_length;
+    node = node->right.get();
+  }
+}
+
+} // namespace
+
+UnicodeRope::UnicodeRope()
+    : priority_state_(0x9E3779B9),
+      is_flat_buffer_valid_(false) {
+}
+
+UnicodeRope::UnicodeRope(UnicodeStringView_Api view)
+    : UnicodeRope() {
+  this->append(view);
+}
+
+UnicodeRope::UnicodeRope(const UnicodeRope& rope)
+    : root_(Clone(rope.root_)),
+      priority_state_(rope.priority_state_),
+      is_flat_buffer_valid_(false) {
+}
+
+UnicodeRope::UnicodeRope(UnicodeRope&& rope) noexcept = default;
+
+UnicodeRope::~UnicodeRope() = default;
+
+UnicodeRope& UnicodeRope::operator=(const UnicodeRope& rope) {
+  if (this != &rope) {
+    this->root_ = Clone(rope.root_);
+    this->priority_state_ = rope.priority_state_;
+    this->is_flat_buffer_valid_ = false;
+  }
+
+  return *this;
+}
+
+UnicodeRope& UnicodeRope::operator=(UnicodeRope&& rope) noexcept = default;
+
+UnicodeRope& UnicodeRope::operator+=(UnicodeStringView_Api view) {
+  return this->append(view);
+}
+
+UnicodeRope::const_reference UnicodeRope::operator[](size_type pos) const {
+  const UnicodeRopeNode* node = this->root_.get();
+
+  while (true) {
+    int left_length = GetSubtreeLength(node->left);
+
+    if (pos < left_length) {
+      node = node->left.get();
+      continue;
+    }
+
+    pos -= left_length;
+
+    if (pos < node->segment_length) {
+      return reinterpret_cast<const_reference>(node->segment[pos]);
+    }
+
+    pos -= node->segment_length;
+    node = node->right.get();
+  }
+}
+
+UnicodeRope::const_reference UnicodeRope::at(size_type pos) const {
+  if (pos < 0 || pos >= this->length()) {
+    throw std::out_of_range("UnicodeRope::at");
+  }
+
+  return (*this)[pos];
+}
+
+bool UnicodeRope::empty() const noexcept {
+  return this->length() == 0;
+}
+
+UnicodeRope::size_type UnicodeRope::size() const noexcept {
+  return this->length();
+}
+
+UnicodeRope::size_type UnicodeRope::length() const noexcept {
+  return GetSubtreeLength(this->root_);
+}
+
+void UnicodeRope::clear() noexcept {
+  this->root_.reset();
+  this->is_flat_buffer_valid_ = false;
+}
+
+UnicodeRope& UnicodeRope::insert(
+    size_type index,
+    UnicodeStringView_Api view
+) {
+  if (index < 0 || index > this->length()) {
+    throw std::out_of_range("UnicodeRope::insert");
+  }
+
+  if (index == this->length()) {
+    return this->append(view);
+  }
+
+  NodePair split = Split(std::move(this->root_), index, this->NextPriority());
+
+  this->root_ = Merge(
+      Merge(std::move(split.first), this->MakeNodes(view)),
+      std::move(split.second)
+  );
+  this->is_flat_buffer_valid_ = false;
+
+  return *this;
+}
+
+UnicodeRope& UnicodeRope::erase(size_type index, size_type count) {
+  size_type length = this->length();
+
+  if (index < 0 || index > length) {
+    throw std::out_of_range("UnicodeRope::erase");
+  }
+
+  if (count == npos || count > length - index) {
+    count = length - index;
+  }
+
+  NodePair split_start =
+      Split(std::move(this->root_), index, this->NextPriority());
+  NodePair split_end =
+      Split(std::move(split_start.second), count, this->NextPriority());
+
+  this->root_ = Merge(
+      std::move(split_start.first),
+      std::move(split_end.second)
+  );
+  this->is_flat_buffer_valid_ = false;
+
+  return *this;
+}
+
+UnicodeRope& UnicodeRope::append(UnicodeStringView_Api view) {
+  const UnicodeChar_1_00* src =
+      reinterpret_cast<const UnicodeChar_1_00*>(view.data());
+  int count = view.length();
+
+  // Short appends usually fit in the last segment.
+  int filled_count = FillLastSegment(this->root_.get(), src, count);
+
+  if (filled_count < count) {
+    UnicodeStringView_Api rest(
+        reinterpret_cast<const UnicodeChar*>(&src[filled_count]),
+        count - filled_count
+    );
+
+    this->root_ = Merge(std::move(this->root_), this->MakeNodes(rest));
+  }
+
+  this->is_flat_buffer_valid_ = false;
+
+  return *this;
+}
+
+UnicodeRope& UnicodeRope::prepend(UnicodeStringView_Api view) {
+  this->root_ = Merge(this->MakeNodes(view), std::move(this->root_));
+  this->is_flat_buffer_valid_ = false;
+
+  return *this;
+}
+
+UnicodeRope::size_type UnicodeRope::copy(
+    value_type* dest,
+    size_type count,
+    size_type pos
+) const {
+  size_type length = this->length();
+
+  if (pos < 0 || pos > length) {
+    throw std::out_of_range("UnicodeRope::copy");
+  }
+
+  size_type copy_count = std::min(count, length - pos);
+
+  CopyRange(
+      this->root_.get(),
+      pos,
+      copy_count,
+      reinterpret_cast<UnicodeChar_1_00*>(dest)
+  );
+
+  return copy_count;
+}
+
+UnicodeStringView_Api UnicodeRope::Flatten() const {
+  size_type length = this->length();
+
+  if (!this->is_flat_buffer_valid_) {
+    this->flat_buffer_.resize(length + 1);
+
+    CopyRange(this->root_.get(), 0, length, this->flat_buffer_.data());
+    this->flat_buffer_[length] = UnicodeChar_1_00();
+
+    this->is_flat_buffer_valid_ = true;
+  }
+
+  return UnicodeStringView_Api(
+      reinterpret_cast<const UnicodeChar*>(this->flat_buffer_.data()),
+      length
+  );
+}
+
+void UnicodeRope::Draw(int position_x, int position_y) const {
+  this->Flatten().Draw(position_x, position_y);
+}
+
+void UnicodeRope::Draw(
+    int position_x,
+    int position_y,
+    const DrawTextOptions& options
+) const {
+  this->Flatten().Draw(position_x, position_y, options);
+}
+
+std::uint32_t UnicodeRope::NextPriority() noexcept {
+  // xorshift32
+  std::uint32_t state = this->priority_state_;
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+
+  this->priority_state_ = state;
+
+  return state;
+}
+
+std::unique_ptr<UnicodeRopeNode> UnicodeRope::MakeNodes(
+    UnicodeStringView_Api view
+) {
+  const UnicodeChar_1_00* src =
+      reinterpret_cast<const UnicodeChar_1_00*>(view.data());
+  int count = view.length();
+
+  NodePtr nodes;
+
+  for (int i = 0; i < count; i += UnicodeRopeNode::kMaxSegmentLength) {
+    NodePtr node = std::make_unique<UnicodeRopeNode>();
+    node->priority = this->NextPriority();
+    node->segment_length =
+        std::min(count - i, UnicodeRopeNode::kMaxSegmentLength);
+    std::copy_n(&src[i], node->segment_length, node->segment);
+    UpdateSubtreeLength(*node);
+
+    nodes = Merge(std::move(nodes), std::move(node));
+  }
+
+  return nodes;
+}
+
+} // namespace d2
@@ -45,10 +45,14 @@
 
 #include "../../../../include/cxx/game_struct/d2_unicode_char/d2_unicode_string_api.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <utility>
 
 #include "../../../../include/cxx/game_function/d2lang_function.hpp"
 #include "../../../../include/cxx/game_version.hpp"
+#include "../../backend/utf8_transcoder.hpp"
 
 namespace d2 {
 namespace {
@@ -57,24 +61,27 @@ using UnicodeString_1_00 = std::basic_string<UnicodeChar_1_00>;
 
 extern template std::basic_string_view<UnicodeChar_1_00>;
 
+static const UnicodeChar_1_00* ToActualPointer(
+    const UnicodeChar* s
+) noexcept {
+  return reinterpret_cast<const UnicodeChar_1_00*>(s);
+}
+
+static const UnicodeChar_1_00& ToActualChar(const UnicodeChar& ch) noexcept {
+  return reinterpret_cast<const UnicodeChar_1_00&>(ch);
+}
+
 } // namespace
 
 
 UnicodeString_Api::UnicodeString_Api() :
-    str_([]() {
-      return ApiVariant(UnicodeString_1_00());
-    }()) {
+    str_(UnicodeString_1_00()) {
 }
 
 UnicodeString_Api::UnicodeString_Api(
     size_type count,
     const value_type& ch
-) : str_([count, &ch]() {
-      const UnicodeChar_1_00& actual_ch =
-          reinterpret_cast<const UnicodeChar_1_00&>(ch);
-
-      return UnicodeString_1_00(count, actual_ch);
-    }()) {
+) : str_(UnicodeString_1_00(count, ToActualChar(ch))) {
 }
 
 UnicodeString_Api::UnicodeString_Api(const UnicodeString_Api& str) :
@@ -84,57 +91,25 @@ UnicodeString_Api::UnicodeString_Api(const UnicodeString_Api& str) :
 UnicodeString_Api::UnicodeString_Api(
     const UnicodeString_Api& str,
     size_type pos
-) : str_([&str, pos]() {
-      return std::visit(
-          [pos](const auto& actual_str) {
-            using UnicodeString_T = std::remove_const_t<
-                std::remove_reference_t<decltype(actual_str)>
-            >;
-
-            return UnicodeString_T(actual_str, pos);
-          },
-          str.str_
-      );
-    }()) {
+) : str_(UnicodeString_1_00(str.actual_str(), pos)) {
 }
 
 UnicodeString_Api::UnicodeString_Api(
     const UnicodeString_Api& str,
     size_type pos,
     size_type count
-) : str_([&str, pos, count]() {
-      return std::visit(
-          [pos, count](const auto& actual_str) {
-            using UnicodeString_T = std::remove_const_t<
-                std::remove_reference_t<decltype(actual_str)>
-            >;
-
-            return UnicodeString_T(actual_str, pos, count);
-          },
-          str.str_
-      );
-    }()) {
+) : str_(UnicodeString_1_00(str.actual_str(), pos, count)) {
 }
 
 UnicodeString_Api::UnicodeString_Api(
     const value_type* str
-) : str_([str]() {
-      const UnicodeChar_1_00* actual_src_str =
-          reinterpret_cast<const UnicodeChar_1_00*>(str);
-
-      return UnicodeString_1_00(actual_src_str);
-    }()) {
+) : str_(UnicodeString_1_00(ToActualPointer(str))) {
 }
 
 UnicodeString_Api::UnicodeString_Api(
     const value_type* str,
     size_type count
-) : str_([str, count]() {
-      const UnicodeChar_1_00* actual_src_str =
-          reinterpret_cast<const UnicodeChar_1_00*>(str);
-
-      return UnicodeString_1_00(actual_src_str, count);
-    }()) {
+) : str_(UnicodeString_1_00(ToActualPointer(str), count)) {
 }
 
 UnicodeString_Api::UnicodeString_Api(
@@ -158,15 +133,13 @@ UnicodeString_Api& UnicodeString_Api::operator=(
 UnicodeString_Api& UnicodeString_Api::operator=(
     const value_type* str
 ) {
-  *this = UnicodeString_Api(str);
-  return *this;
+  return this->assign(str);
 }
 
 UnicodeString_Api& UnicodeString_Api::operator=(
     const value_type& ch
 ) {
-  *this = UnicodeString_Api(1, ch);
-  return *this;
+  return this->assign(1, ch);
 }
 
 UnicodeString_Api& UnicodeString_Api::operator+=(
@@ -176,7 +149,8 @@ UnicodeString_Api& UnicodeString_Api::operator+=(
 }
 
 UnicodeString_Api& UnicodeString_Api::operator+=(const value_type& ch) {
-  return this->append(1, ch);
+  this->push_back(ch);
+  return *this;
 }
 
 UnicodeString_Api& UnicodeString_Api::operator+=(const value_type* str) {
@@ -184,191 +158,20 @@ UnicodeString_Api& UnicodeString_Api::operator+=(const value_type* str) {
 }
 
 UnicodeString_Api::operator UnicodeStringView_Api() const noexcept {
-  return std::visit(
-      [](const auto& actual_src_str) {
-        return UnicodeStringView_Api(
-            reinterpret_cast<const_pointer>(actual_src_str.data()),
-            actual_src_str.length()
-        );
-      },
-      this->str_
-  );
-}
-
-UnicodeString_Api::reference UnicodeString_Api::operator[](
-    size_type pos
-) {
-  auto* actual_pointer = std::visit(
-      [pos](auto& actual_str) {
-        return &actual_str[pos];
-      },
-      this->str_
-  );
-
-  return *reinterpret_cast<pointer>(actual_pointer);
-}
-
-UnicodeString_Api::const_reference UnicodeString_Api::operator[](
-    size_type pos
-) const {
-  const auto* actual_pointer = std::visit(
-      [pos](const auto& actual_str) {
-        return &actual_str[pos];
-      },
-      this->str_
-  );
-
-  return *reinterpret_cast<const_pointer>(actual_pointer);
-}
-
-UnicodeString_Api::reference UnicodeString_Api::at(
-    size_type pos
-) {
-  return *std::visit(
-      [pos](auto& actual_str) {
-        return reinterpret_cast<pointer>(&actual_str.at(pos));
-      },
-      this->str_
-  );
-}
-
-UnicodeString_Api::const_reference UnicodeString_Api::at(
-    size_type pos
-) const {
-  return *std::visit(
-      [pos](const auto& actual_str) {
-        return reinterpret_cast<const_pointer>(&actual_str.at(pos));
-      },
-      this->str_
-  );
-}
-
-UnicodeString_Api::value_type& UnicodeString_Api::front() {
-  return *std::visit(
-      [](auto& actual_str) {
-        return reinterpret_cast<pointer>(&actual_str.front());
-      },
-      this->str_
-  );
-}
-
-const UnicodeString_Api::value_type& UnicodeString_Api::front() const {
-  return *std::visit(
-      [](const auto& actual_str) {
-        return reinterpret_cast<const_pointer>(&actual_str.front());
-      },
-      this->str_
-  );
-}
-
-UnicodeString_Api::value_type& UnicodeString_Api::back() {
-  return *std::visit(
-      [](auto& actual_str) {
-        return reinterpret_cast<pointer>(&actual_str.back());
-      },
-      this->str_
-  );
-}
-
-const UnicodeString_Api::value_type& UnicodeString_Api::back() const {
-  return *std::visit(
-      [](const auto& actual_str) {
-        return reinterpret_cast<const_pointer>(&actual_str.back());
-      },
-      this->str_
-  );
-}
+  const UnicodeString_1_00& actual_str = this->actual_str();
 
-UnicodeString_Api::value_type* UnicodeString_Api::data() noexcept {
-  return std::visit(
-      [](auto& actual_str) {
-        return reinterpret_cast<value_type*>(actual_str.data());
-      },
-      this->str_
-  );
-}
-
-const UnicodeString_Api::value_type*
-UnicodeString_Api::data() const noexcept {
-  return std::visit(
-      [](const auto& actual_str) {
-        return reinterpret_cast<const value_type*>(actual_str.data());
-      },
-      this->str_
-  );
-}
-
-const UnicodeString_Api::value_type*
-UnicodeString_Api::c_str() const noexcept {
-  return std::visit(
-      [](const auto& actual_str) {
-        return reinterpret_cast<const value_type*>(actual_str.c_str());
-      },
-      this->str_
-  );
-}
-
-bool UnicodeString_Api::empty() const noexcept {
-  return std::visit(
-      [](const auto& actual_str) {
-        return actual_str.empty();
-      },
-      this->str_
-  );
-}
-
-UnicodeString_Api::size_type UnicodeString_Api::size() const noexcept {
-  return std::visit(
-      [](const auto& actual_str) {
-        return actual_str.size();
-      },
-      this->str_
-  );
-}
-
-UnicodeString_Api::size_type UnicodeString_Api::length() const noexcept {
-  return std::visit(
-      [](const auto& actual_str) {
-        return actual_str.length();
-      },
-      this->str_
-  );
-}
-
-UnicodeString_Api::size_type UnicodeString_Api::max_size() const noexcept {
-  return std::visit(
-      [](const auto& actual_str) {
-        return actual_str.max_size();
-      },
-      this->str_
+  return UnicodeStringView_Api(
+      reinterpret_cast<const_pointer>(actual_str.data()),
+      actual_str.length()
   );
 }
 
 void UnicodeString_Api::reserve(size_type new_cap) {
-  std::visit(
-      [new_cap](auto& actual_str) {
-        actual_str.reserve(new_cap);
-      },
-      this->str_
-  );
-}
-
-UnicodeString_Api::size_type UnicodeString_Api::capacity() const noexcept {
-  return std::visit(
-      [](const auto& actual_str) {
-        return actual_str.capacity();
-      },
-      this->str_
-  );
+  this->actual_str().reserve(new_cap);
 }
 
 void UnicodeString_Api::shrink_to_fit() {
-  std::visit(
-      [](auto& actual_str) {
-        actual_str.shrink_to_fit();
-      },
-      this->str_
-  );
+  this->actual_str().shrink_to_fit();
 }
 
 
@@ -380,39 +183,13 @@ UnicodeString_Api& UnicodeString_Api::assign(
     size_type count,
     const value_type& ch
 ) {
-  std::visit(
-      [count, &ch](auto& actual_dest_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_dest_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const UnicodeChar_T& actual_ch =
-            reinterpret_cast<const UnicodeChar_T&>(ch);
-
-        actual_dest_str.assign(count, actual_ch);
-      },
-      this->str_
-  );
+  this->actual_str().assign(count, ToActualChar(ch));
 
   return *this;
 }
 
 UnicodeString_Api& UnicodeString_Api::assign(const UnicodeString_Api& str) {
-  std::visit(
-      [&str](auto& actual_dest_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_dest_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const UnicodeString_T& actual_src_str =
-            std::get<UnicodeString_T>(str.str_);
-
-        actual_dest_str.assign(actual_src_str);
-      },
-      this->str_
-  );
+  this->actual_str().assign(str.actual_str());
 
   return *this;
 }
@@ -422,20 +199,7 @@ UnicodeString_Api& UnicodeString_Api::assign(
     size_type pos,
     size_type count
 ) {
-  std::visit(
-      [&str, pos, count](auto& actual_dest_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_dest_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const UnicodeString_T& actual_src_str =
-            std::get<UnicodeString_T>(str.str_);
-
-        actual_dest_str.assign(actual_src_str, pos, count);
-      },
-      this->str_
-  );
+  this->actual_str().assign(str.actual_str(), pos, count);
 
   return *this;
 }
@@ -444,7 +208,6 @@ UnicodeString_Api& UnicodeString_Api::assign(
     UnicodeString_Api&& str
 ) noexcept {
   *this = std::move(str);
-
   return *this;
 }
 
@@ -452,50 +215,19 @@ UnicodeString_Api& UnicodeString_Api::assign(
     const value_type* s,
     size_type count
 ) {
-  std::visit(
-      [s, count](auto& actual_dest_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_dest_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const UnicodeChar_T* actual_src_s =
-            reinterpret_cast<const UnicodeChar_T*>(s);
-
-        actual_dest_str.assign(actual_src_s, count);
-      },
-      this->str_
-  );
+  this->actual_str().assign(ToActualPointer(s), count);
 
   return *this;
 }
 
 UnicodeString_Api& UnicodeString_Api::assign(const value_type* s) {
-  std::visit(
-      [s](auto& actual_dest_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_dest_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const UnicodeChar_T* actual_src_s =
-            reinterpret_cast<const UnicodeChar_T*>(s);
-
-        actual_dest_str.assign(actual_src_s);
-      },
-      this->str_
-  );
+  this->actual_str().assign(ToActualPointer(s));
 
   return *this;
 }
 
 void UnicodeString_Api::clear() noexcept {
-  std::visit(
-      [](auto& actual_str) {
-        actual_str.clear();
-      },
-      this->str_
-  );
+  this->actual_str().clear();
 }
 
 UnicodeString_Api& UnicodeString_Api::insert(
@@ -503,20 +235,7 @@ UnicodeString_Api& UnicodeString_Api::insert(
     size_type count,
     const value_type& ch
 ) {
-  std::visit(
-      [index, count, &ch](auto& actual_dest_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_dest_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const UnicodeChar_T& actual_ch =
-            reinterpret_cast<const UnicodeChar_T&>(ch);
-
-        actual_dest_str.insert(index, count, actual_ch);
-      },
-      this->str_
-  );
+  this->actual_str().insert(index, count, ToActualChar(ch));
 
   return *this;
 }
@@ -525,20 +244,7 @@ UnicodeString_Api& UnicodeString_Api::insert(
     size_type index,
     const value_type* ch
 ) {
-  std::visit(
-      [index, ch](auto& actual_dest_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_dest_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const UnicodeChar_T* actual_src_ch =
-            reinterpret_cast<const UnicodeChar_T*>(ch);
-
-        actual_dest_str.insert(index, actual_src_ch);
-      },
-      this->str_
-  );
+  this->actual_str().insert(index, ToActualPointer(ch));
 
   return *this;
 }
@@ -547,21 +253,8 @@ UnicodeString_Api& UnicodeString_Api::insert(
     size_type index,
     const value_type* ch,
     size_type count
-){
-  std::visit(
-      [index, ch, count](auto& actual_dest_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_dest_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const UnicodeChar_T* actual_src_ch =
-            reinterpret_cast<const UnicodeChar_T*>(ch);
-
-        actual_dest_str.insert(index, actual_src_ch, count);
-      },
-      this->str_
-  );
+) {
+  this->actual_str().insert(index, ToActualPointer(ch), count);
 
   return *this;
 }
@@ -572,19 +265,11 @@ UnicodeString_Api& UnicodeString_Api::insert(
     size_type index_str,
     size_type count
 ) {
-  std::visit(
-      [index, &str, index_str, count](auto& actual_dest_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_dest_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const UnicodeString_T& actual_src_str =
-            std::get<UnicodeString_T>(str.str_);
-
-        actual_dest_str.insert(index, actual_src_str, index_str, count);
-      },
-      this->str_
+  this->actual_str().insert(
+      index,
+      str.actual_str(),
+      index_str,
+      count
   );
 
   return *this;
@@ -594,76 +279,30 @@ UnicodeString_Api& UnicodeString_Api::erase(
     size_type index,
     size_type count
 ) {
-  std::visit(
-      [index, count](auto& actual_str) {
-        actual_str.erase(index, count);
-      },
-      this->str_
-  );
+  this->actual_str().erase(index, count);
 
   return *this;
 }
 
 void UnicodeString_Api::push_back(const value_type& ch) {
-  std::visit(
-      [&ch](auto& actual_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const UnicodeChar_T& actual_ch =
-            reinterpret_cast<const UnicodeChar_T&>(ch);
-
-        actual_str.push_back(actual_ch);
-      },
-      this->str_
-  );
+  this->actual_str().push_back(ToActualChar(ch));
 }
 
 void UnicodeString_Api::pop_back() {
-  return std::visit(
-      [](auto& actual_str) {
-        actual_str.pop_back();
-      },
-      this->str_
-  );
+  this->actual_str().pop_back();
 }
 
 UnicodeString_Api& UnicodeString_Api::append(
     size_type count,
     const value_type& ch
 ) {
-  std::visit(
-      [count, &ch](auto& actual_dest_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_dest_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const auto& actual_ch = reinterpret_cast<const UnicodeChar_T&>(ch);
-
-        actual_dest_str.append(count, actual_ch);
-      },
-      this->str_
-  );
+  this->actual_str().append(count, ToActualChar(ch));
 
   return *this;
 }
 
 UnicodeString_Api& UnicodeString_Api::append(const UnicodeString_Api& str) {
-  std::visit(
-      [&str](auto& actual_dest_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_dest_str)
-        >;
-
-        const auto& actual_src_str = std::get<UnicodeString_T>(str.str_);
-
-        actual_dest_str.append(actual_src_str);
-      },
-      this->str_
-  );
+  this->actual_str().append(str.actual_str());
 
   return *this;
 }
@@ -672,18 +311,7 @@ UnicodeString_Api& UnicodeString_Api::append(
     const UnicodeString_Api& str,
     size_type pos
 ) {
-  std::visit(
-      [&str, pos](auto& actual_dest_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_dest_str)
-        >;
-
-        const auto& actual_src_str = std::get<UnicodeString_T>(str.str_);
-
-        actual_dest_str.append(actual_src_str, pos);
-      },
-      this->str_
-  );
+  this->actual_str().append(str.actual_str(), pos);
 
   return *this;
 }
@@ -693,36 +321,13 @@ UnicodeString_Api& UnicodeString_Api::append(
     size_type pos,
     size_type count
 ) {
-  std::visit(
-      [&str, pos, count](auto& actual_dest_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_dest_str)
-        >;
-
-        const auto& actual_src_str = std::get<UnicodeString_T>(str.str_);
-
-        actual_dest_str.append(actual_src_str, pos, count);
-      },
-      this->str_
-  );
+  this->actual_str().append(str.actual_str(), pos, count);
 
   return *this;
 }
 
 UnicodeString_Api& UnicodeString_Api::append(const value_type* str) {
-  std::visit(
-      [str](auto& actual_dest_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_dest_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const auto* actual_src_str = reinterpret_cast<const UnicodeChar_T*>(str);
-
-        actual_dest_str.append(actual_src_str);
-      },
-      this->str_
-  );
+  this->actual_str().append(ToActualPointer(str));
 
   return *this;
 }
@@ -731,37 +336,13 @@ UnicodeString_Api& UnicodeString_Api::append(
     const value_type* str,
     size_type count
 ) {
-  std::visit(
-      [str, count](auto& actual_dest_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_dest_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const auto* actual_src_str = reinterpret_cast<const UnicodeChar_T*>(str);
-
-        actual_dest_str.append(actual_src_str, count);
-      },
-      this->str_
-  );
+  this->actual_str().append(ToActualPointer(str), count);
 
   return *this;
 }
 
 int UnicodeString_Api::compare(const UnicodeString_Api& str) const noexcept {
-  return std::visit(
-      [&str](const auto& actual_str1) {
-        using UnicodeString_T = std::remove_const_t<
-            std::remove_reference_t<decltype(actual_str1)>
-        >;
-
-        const UnicodeString_T& actual_str2 =
-            std::get<UnicodeString_T>(str.str_);
-
-        return actual_str1.compare(actual_str2);
-      },
-      this->str_
-  );
+  return this->actual_str().compare(str.actual_str());
 }
 
 int UnicodeString_Api::compare(
@@ -769,18 +350,10 @@ int UnicodeString_Api::compare(
     size_type count1,
     const UnicodeString_Api& str
 ) const {
-  return std::visit(
-      [pos1, count1, &str](const auto& actual_str1) {
-        using UnicodeString_T = std::remove_const_t<
-            std::remove_reference_t<decltype(actual_str1)>
-        >;
-
-        const UnicodeString_T& actual_str2 =
-            std::get<UnicodeString_T>(str.str_);
-
-        return actual_str1.compare(pos1, count1, actual_str2);
-      },
-      this->str_
+  return this->actual_str().compare(
+      pos1,
+      count1,
+      str.actual_str()
   );
 }
 
@@ -791,36 +364,17 @@ int UnicodeString_Api::compare(
     size_type pos2,
     size_type count2
 ) const {
-  return std::visit(
-      [pos1, count1, &str, pos2, count2](const auto& actual_str1) {
-        using UnicodeString_T = std::remove_const_t<
-            std::remove_reference_t<decltype(actual_str1)>
-        >;
-
-        const UnicodeString_T& actual_str2 =
-            std::get<UnicodeString_T>(str.str_);
-
-        return actual_str1.compare(pos1, count1, actual_str2, pos2, count2);
-      },
-      this->str_
+  return this->actual_str().compare(
+      pos1,
+      count1,
+      str.actual_str(),
+      pos2,
+      count2
   );
 }
 
 int UnicodeString_Api::compare(const value_type* s) const {
-  return std::visit(
-      [s](const auto& actual_str) {
-        using UnicodeString_T = std::remove_const_t<
-            std::remove_reference_t<decltype(actual_str)>
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const UnicodeChar_T* actual_s =
-            reinterpret_cast<const UnicodeChar_T*>(s);
-
-        return actual_str.compare(actual_s);
-      },
-      this->str_
-  );
+  return this->actual_str().compare(ToActualPointer(s));
 }
 
 int UnicodeString_Api::compare(
@@ -828,19 +382,10 @@ int UnicodeString_Api::compare(
     size_type count1,
     const value_type* s
 ) const {
-  return std::visit(
-      [pos1, count1, s](const auto& actual_str) {
-        using UnicodeString_T = std::remove_const_t<
-            std::remove_reference_t<decltype(actual_str)>
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const UnicodeChar_T* actual_s =
-            reinterpret_cast<const UnicodeChar_T*>(s);
-
-        return actual_str.compare(pos1, count1, actual_s);
-      },
-      this->str_
+  return this->actual_str().compare(
+      pos1,
+      count1,
+      ToActualPointer(s)
   );
 }
 
@@ -850,143 +395,57 @@ int UnicodeString_Api::compare(
     const value_type* s,
     size_type count2
 ) const {
-  return std::visit(
-      [pos1, count1, s, count2](const auto& actual_str) {
-        using UnicodeString_T = std::remove_const_t<
-            std::remove_reference_t<decltype(actual_str)>
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const UnicodeChar_T* actual_s =
-            reinterpret_cast<const UnicodeChar_T*>(s);
-
-        return actual_str.compare(pos1, count1, actual_s, count2);
-      },
-      this->str_
+  return this->actual_str().compare(
+      pos1,
+      count1,
+      ToActualPointer(s),
+      count2
   );
 }
 
 bool UnicodeString_Api::starts_with(UnicodeStringView_Api sv) const noexcept {
-  return std::visit(
-      [&sv](const auto& actual_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-        using UnicodeStringView_T = std::basic_string_view<UnicodeChar_T>;
-
-        UnicodeStringView_T actual_sv_data = reinterpret_cast<const UnicodeChar_T*>(sv.data());
-
-        return actual_str.starts_with(actual_sv_data);
-      },
-      this->str_
+  std::basic_string_view<UnicodeChar_1_00> actual_sv(
+      ToActualPointer(sv.data()),
+      sv.length()
   );
+
+  return this->actual_str().starts_with(actual_sv);
 }
 
 bool UnicodeString_Api::starts_with(const value_type& c) const noexcept {
-  return std::visit(
-      [&c](const auto& actual_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const UnicodeChar_T& actual_c =
-            reinterpret_cast<const UnicodeChar_T&>(c);
-
-        return actual_str.starts_with(actual_c);
-      },
-      this->str_
-  );
+  return this->actual_str().starts_with(ToActualChar(c));
 }
 
 bool UnicodeString_Api::starts_with(const value_type* s) const {
-  return std::visit(
-      [s](const auto& actual_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const UnicodeChar_T* actual_s =
-            reinterpret_cast<const UnicodeChar_T*>(s);
-
-        return actual_str.ends_with(actual_s);
-      },
-      this->str_
-  );
+  return this->actual_str().starts_with(ToActualPointer(s));
 }
 
 bool UnicodeString_Api::ends_with(UnicodeStringView_Api sv) const noexcept {
-  return std::visit(
-      [&sv](const auto& actual_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-        using UnicodeStringView_T = std::basic_string_view<UnicodeChar_T>;
-
-        UnicodeStringView_T actual_sv_data = reinterpret_cast<const UnicodeChar_T*>(sv.data());
-
-        return actual_str.ends_with(actual_sv_data);
-      },
-      this->str_
+  std::basic_string_view<UnicodeChar_1_00> actual_sv(
+      ToActualPointer(sv.data()),
+      sv.length()
   );
+
+  return this->actual_str().ends_with(actual_sv);
 }
 
 bool UnicodeString_Api::ends_with(const value_type& c) const noexcept {
-  return std::visit(
-      [&c](const auto& actual_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const UnicodeChar_T& actual_c =
-            reinterpret_cast<const UnicodeChar_T&>(c);
-
-        return actual_str.ends_with(actual_c);
-      },
-      this->str_
-  );
+  return this->actual_str().ends_with(ToActualChar(c));
 }
 
 bool UnicodeString_Api::ends_with(const value_type* s) const {
-  return std::visit(
-      [s](const auto& actual_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const UnicodeChar_T* actual_s =
-            reinterpret_cast<const UnicodeChar_T*>(s);
-
-        return actual_str.ends_with(actual_s);
-      },
-      this->str_
-  );
+  return this->actual_str().ends_with(ToActualPointer(s));
 }
 
 UnicodeString_Api UnicodeString_Api::substr() const {
   return UnicodeString_Api(
-      std::visit(
-          [](const auto& actual_str) {
-            return actual_str.substr();
-          },
-          this->str_
-      )
+      ApiVariant(this->actual_str().substr())
   );
 }
 
 UnicodeString_Api UnicodeString_Api::substr(size_type pos) const {
   return UnicodeString_Api(
-      std::visit(
-          [pos](const auto& actual_str) {
-            return actual_str.substr(pos);
-          },
-          this->str_
-      )
+      ApiVariant(this->actual_str().substr(pos))
   );
 }
 
@@ -995,12 +454,7 @@ UnicodeString_Api UnicodeString_Api::substr(
     size_type count
 ) const {
   return UnicodeString_Api(
-      std::visit(
-          [pos, count](const auto& actual_str) {
-            return actual_str.substr(pos, count);
-          },
-          this->str_
-      )
+      ApiVariant(this->actual_str().substr(pos, count))
   );
 }
 
@@ -1009,60 +463,23 @@ UnicodeString_Api::size_type UnicodeString_Api::copy(
     size_type count,
     size_type pos
 ) const {
-  return std::visit(
-      [dest, count, pos](const auto& actual_src_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_src_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        UnicodeChar_T* actual_dest = reinterpret_cast<UnicodeChar_T*>(dest);
-
-        return actual_src_str.copy(actual_dest, count, pos);
-      },
-      this->str_
+  return this->actual_str().copy(
+      reinterpret_cast<UnicodeChar_1_00*>(dest),
+      count,
+      pos
   );
 }
 
 void UnicodeString_Api::resize(size_type count) {
-  std::visit(
-      [count](auto& actual_str) {
-        actual_str.resize(count);
-      },
-      this->str_
-  );
+  this->actual_str().resize(count);
 }
 
 void UnicodeString_Api::resize(size_type count, const value_type& ch) {
-  std::visit(
-      [count, &ch](auto& actual_str) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_str)
-        >;
-        using UnicodeChar_T = typename UnicodeString_T::value_type;
-
-        const UnicodeChar_T& actual_ch =
-            reinterpret_cast<const UnicodeChar_T&>(ch);
-
-        actual_str.resize(count, actual_ch);
-      },
-      this->str_
-  );
+  this->actual_str().resize(count, ToActualChar(ch));
 }
 
 void UnicodeString_Api::swap(UnicodeString_Api& str) {
-  return std::visit(
-      [&str](auto& actual_str1) {
-        using UnicodeString_T = std::remove_reference_t<
-            decltype(actual_str1)
-        >;
-
-        UnicodeString_T actual_str2 = std::get<UnicodeString_T>(str.str_);
-
-        actual_str1.swap(actual_str2);
-      },
-      this->str_
-  );
+  this->actual_str().swap(str.actual_str());
 }
 
 void UnicodeString_Api::Draw(int position_x, int position_y) const {
@@ -1084,39 +501,46 @@ void UnicodeString_Api::Draw(
 UnicodeString_Api UnicodeString_Api::FromUtf8String(
     std::u8string_view src
 ) {
-  std::unique_ptr actual_temp_dest = 
-      std::make_unique<UnicodeChar_1_00[]>(src.length() + 1);
-  UnicodeChar* converted_temp_dest =
-      reinterpret_cast<UnicodeChar*>(actual_temp_dest.get());
+  std::size_t dest_length = mapi::GetUtf8ToUtf16Length(
+      src.data(),
+      src.length()
+  );
+
+  UnicodeString_1_00 actual_dest(dest_length, UnicodeChar_1_00());
 
-  d2lang::Unicode_Utf8ToUnicode(
-      converted_temp_dest,
+  mapi::TranscodeUtf8ToUtf16(
       src.data(),
-      std::numeric_limits<int>::max()
+      src.length(),
+      reinterpret_cast<std::uint16_t*>(actual_dest.data())
   );
 
-  return converted_temp_dest;
+  return UnicodeString_Api(ApiVariant(std::move(actual_dest)));
 }
 
 std::u8string UnicodeString_Api::ToUtf8String() const {
-  std::unique_ptr dest = std::make_unique<char8_t[]>(
-      (this->length() * 4) + 1
-  );
+  const std::uint16_t* actual_src =
+      reinterpret_cast<const std::uint16_t*>(this->data());
 
-  d2lang::Unicode_UnicodeToUtf8(
-      dest.get(),
-      this->data(),
-      std::numeric_limits<int>::max()
+  std::size_t dest_length = mapi::GetUtf16ToUtf8Length(
+      actual_src,
+      this->length()
   );
 
-  return dest.get();
+  std::u8string dest(dest_length, u8'\0');
+
+  mapi::TranscodeUtf16ToUtf8(actual_src, this->length(), dest.data());
+
+  return dest;
 }
 
 UnicodeString_Api operator+(
     const UnicodeString_Api& lhs,
     const UnicodeString_Api& rhs
 ) {
-  UnicodeString_Api cat(lhs);
+  // Reserve up front so that the concatenation allocates only once.
+  UnicodeString_Api cat;
+  cat.reserve(lhs.length() + rhs.length());
+  cat += lhs;
   cat += rhs;
 
   return cat;
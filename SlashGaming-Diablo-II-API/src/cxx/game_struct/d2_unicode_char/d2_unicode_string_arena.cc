@@ -0,0 +1,297 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "../../../../include/cxx/game_struct/d2_unicode_char/d2_unicode_string_arena.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace d2 {
+namespace {
+
+static constexpr const UnicodeStringBuilder::size_type kMinBuilderCapacity =
+    32;
+
+static const UnicodeChar_1_00 kEmptyString[1] = { 0 };
+
+} // namespace
+
+UnicodeStringArena::UnicodeStringArena()
+    : UnicodeStringArena(kDefaultChunkLength) {
+}
+
+UnicodeStringArena::UnicodeStringArena(std::size_t chunk_length)
+    : chunk_length_(chunk_length),
+      current_chunk_index_(0),
+      current_chunk_offset_(0) {
+}
+
+UnicodeStringArena::UnicodeStringArena(
+    UnicodeStringArena&& arena
+) noexcept = default;
+
+UnicodeStringArena::~UnicodeStringArena() = default;
+
+UnicodeStringArena& UnicodeStringArena::operator=(
+    UnicodeStringArena&& arena
+) noexcept = default;
+
+UnicodeChar* UnicodeStringArena::Allocate(std::size_t length) {
+  // Look for room in the current chunk, then in any chunk that was kept
+  // from a previous frame.
+  for (;
+      this->current_chunk_index_ < this->chunks_.size();
+      this->current_chunk_index_ += 1) {
+    Chunk& chunk = this->chunks_[this->current_chunk_index_];
+
+    if (chunk.length - this->current_chunk_offset_ >= length) {
+      UnicodeChar_1_00* block =
+          &chunk.buffer[this->current_chunk_offset_];
+      this->current_chunk_offset_ += length;
+
+      return reinterpret_cast<UnicodeChar*>(block);
+    }
+
+    this->current_chunk_offset_ = 0;
+  }
+
+  // Oversized requests get a dedicated chunk, which is also reused after
+  // a reset.
+  Chunk new_chunk;
+  new_chunk.length = std::max(length, this->chunk_length_);
+  new_chunk.buffer = std::make_unique<UnicodeChar_1_00[]>(new_chunk.length);
+
+  this->chunks_.push_back(std::move(new_chunk));
+  this->current_chunk_index_ = this->chunks_.size() - 1;
+  this->current_chunk_offset_ = length;
+
+  return reinterpret_cast<UnicodeChar*>(
+      this->chunks_.back().buffer.get()
+  );
+}
+
+bool UnicodeStringArena::TryExtend(
+    const UnicodeChar* block,
+    std::size_t old_length,
+    std::size_t new_length
+) noexcept {
+  if (this->current_chunk_index_ >= this->chunks_.size()
+      || this->current_chunk_offset_ < old_length) {
+    return false;
+  }
+
+  Chunk& chunk = this->chunks_[this->current_chunk_index_];
+
+  std::size_t block_offset = this->current_chunk_offset_ - old_length;
+  const UnicodeChar_1_00* actual_block =
+      reinterpret_cast<const UnicodeChar_1_00*>(block);
+
+  // Only the most recent allocation can be extended.
+  if (actual_block != &chunk.buffer[block_offset]) {
+    return false;
+  }
+
+  if (chunk.length - block_offset < new_length) {
+    return false;
+  }
+
+  this->current_chunk_offset_ = block_offset + new_length;
+
+  return true;
+}
+
+UnicodeStringView_Api UnicodeStringArena::Copy(UnicodeStringView_Api view) {
+  std::size_t length = view.length();
+
+  UnicodeChar* dest = this->Allocate(length + 1);
+  UnicodeChar_1_00* actual_dest = reinterpret_cast<UnicodeChar_1_00*>(dest);
+
+  std::copy_n(
+      reinterpret_cast<const UnicodeChar_1_00*>(view.data()),
+      length,
+      actual_dest
+  );
+  actual_dest[length] = UnicodeChar_1_00();
+
+  return UnicodeStringView_Api(dest, length);
+}
+
+void UnicodeStringArena::Reset() noexcept {
+  this->current_chunk_index_ = 0;
+  this->current_chunk_offset_ = 0;
+}
+
+std::size_t UnicodeStringArena::chunk_count() const noexcept {
+  return this->chunks_.size();
+}
+
+UnicodeStringBuilder::UnicodeStringBuilder(
+    UnicodeStringArena& arena
+) noexcept
+    : arena_(&arena),
+      buffer_(nullptr),
+      length_(0),
+      capacity_(0) {
+}
+
+UnicodeStringBuilder& UnicodeStringBuilder::operator+=(
+    UnicodeStringView_Api view
+) {
+  return this->append(view);
+}
+
+UnicodeStringBuilder& UnicodeStringBuilder::operator+=(const value_type& ch) {
+  this->push_back(ch);
+  return *this;
+}
+
+UnicodeStringBuilder::operator UnicodeStringView_Api() const noexcept {
+  return UnicodeStringView_Api(this->data(), this->length_);
+}
+
+UnicodeStringBuilder& UnicodeStringBuilder::append(
+    UnicodeStringView_Api view
+) {
+  size_type count = view.length();
+  size_type new_length = this->length_ + count;
+
+  if (new_length > this->capacity_) {
+    this->reserve(
+        std::max({ new_length, this->capacity_ * 2, kMinBuilderCapacity })
+    );
+  }
+
+  // Abandoned blocks stay in the arena until it is reset, so the view
+  // remains valid even if it pointed into the old buffer.
+  std::copy_n(
+      reinterpret_cast<const UnicodeChar_1_00*>(view.data()),
+      count,
+      &this->buffer_[this->length_]
+  );
+  this->buffer_[new_length] = UnicodeChar_1_00();
+
+  this->length_ = new_length;
+
+  return *this;
+}
+
+UnicodeStringBuilder& UnicodeStringBuilder::append(
+    const value_type* s,
+    size_type count
+) {
+  return this->append(UnicodeStringView_Api(s, count));
+}
+
+void UnicodeStringBuilder::push_back(const value_type& ch) {
+  this->append(UnicodeStringView_Api(&ch, 1));
+}
+
+void UnicodeStringBuilder::reserve(size_type new_cap) {
+  if (new_cap <= this->capacity_) {
+    return;
+  }
+
+  // Room is always kept for the null terminator.
+  if (this->buffer_ != nullptr
+      && this->arena_->TryExtend(
+          reinterpret_cast<UnicodeChar*>(this->buffer_),
+          this->capacity_ + 1,
+          new_cap + 1
+      )) {
+    this->capacity_ = new_cap;
+    return;
+  }
+
+  UnicodeChar_1_00* new_buffer = reinterpret_cast<UnicodeChar_1_00*>(
+      this->arena_->Allocate(new_cap + 1)
+  );
+
+  if (this->buffer_ != nullptr) {
+    std::copy_n(this->buffer_, this->length_ + 1, new_buffer);
+  } else {
+    new_buffer[0] = UnicodeChar_1_00();
+  }
+
+  this->buffer_ = new_buffer;
+  this->capacity_ = new_cap;
+}
+
+void UnicodeStringBuilder::clear() noexcept {
+  this->length_ = 0;
+
+  if (this->buffer_ != nullptr) {
+    this->buffer_[0] = UnicodeChar_1_00();
+  }
+}
+
+const UnicodeStringBuilder::value_type*
+UnicodeStringBuilder::data() const noexcept {
+  const UnicodeChar_1_00* actual_data = (this->buffer_ == nullptr)
+      ? kEmptyString
+      : this->buffer_;
+
+  return reinterpret_cast<const value_type*>(actual_data);
+}
+
+const UnicodeStringBuilder::value_type*
+UnicodeStringBuilder::c_str() const noexcept {
+  return this->data();
+}
+
+UnicodeStringBuilder::size_type
+UnicodeStringBuilder::length() const noexcept {
+  return this->length_;
+}
+
+UnicodeStringBuilder::size_type
+UnicodeStringBuilder::capacity() const noexcept {
+  return this->capacity_;
+}
+
+bool UnicodeStringBuilder::empty() const noexcept {
+  return this->length_ == 0;
+}
+
+} // namespace d2
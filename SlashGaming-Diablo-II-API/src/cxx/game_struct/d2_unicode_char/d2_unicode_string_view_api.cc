@@ -62,9 +62,7 @@ using UnicodeStringView_1_00 = std::basic_string_view<UnicodeChar_1_00>;
 } // namespace
 
 UnicodeStringView_Api::UnicodeStringView_Api() noexcept :
-    view_([]() {
-      return UnicodeStringView_1_00();
-    }()) {
+    view_(UnicodeStringView_1_00()) {
 }
 
 UnicodeStringView_Api::UnicodeStringView_Api(
@@ -88,54 +86,22 @@ UnicodeStringView_Api::UnicodeStringView_Api(const value_type* s)
 }
 
 UnicodeStringView_Api UnicodeStringView_Api::substr() const {
-  return UnicodeStringView_Api(
-      std::visit(
-          [](const auto& actual_view) {
-            return actual_view.substr();
-          },
-          this->view_
-      )
-  );
+  return UnicodeStringView_Api(this->actual_view().substr());
 }
 
 UnicodeStringView_Api UnicodeStringView_Api::substr(size_type pos) const {
-  return UnicodeStringView_Api(
-      std::visit(
-          [pos](const auto& actual_view) {
-            return actual_view.substr(pos);
-          },
-          this->view_
-      )
-  );
+  return UnicodeStringView_Api(this->actual_view().substr(pos));
 }
 
 UnicodeStringView_Api UnicodeStringView_Api::substr(
     size_type pos,
     size_type count
 ) const {
-  return UnicodeStringView_Api(
-      std::visit(
-          [pos, count](const auto& actual_view) {
-            return actual_view.substr(pos, count);
-          },
-          this->view_
-      )
-  );
+  return UnicodeStringView_Api(this->actual_view().substr(pos, count));
 }
 
 int UnicodeStringView_Api::compare(UnicodeStringView_Api v) const noexcept {
-  return std::visit(
-      [&v](const auto& actual_src_view) {
-        using UnicodeStringView_T = std::remove_const_t<
-            std::remove_reference_t<decltype(actual_src_view)>
-        >;
-
-        UnicodeStringView_T actual_v = std::get<UnicodeStringView_T>(v.view_);
-
-        return actual_src_view.compare(actual_v);
-      },
-      this->view_
-  );
+  return this->actual_view().compare(v.actual_view());
 }
 
 int UnicodeStringView_Api::compare(
@@ -143,18 +109,7 @@ int UnicodeStringView_Api::compare(
     size_type count1,
     UnicodeStringView_Api v
 ) const {
-  return std::visit(
-      [pos1, count1, &v](const auto& actual_src_view) {
-        using UnicodeStringView_T = std::remove_const_t<
-            std::remove_reference_t<decltype(actual_src_view)>
-        >;
-
-        UnicodeStringView_T actual_v = std::get<UnicodeStringView_T>(v.view_);
-
-        return actual_src_view.compare(pos1, count1, actual_v);
-      },
-      this->view_
-  );
+  return this->actual_view().compare(pos1, count1, v.actual_view());
 }
 
 int UnicodeStringView_Api::compare(
@@ -164,70 +119,28 @@ int UnicodeStringView_Api::compare(
     size_type pos2,
     size_type count2
 ) const {
-  return std::visit(
-      [pos1, count1, &v, pos2, count2](const auto& actual_src_view) {
-        using UnicodeStringView_T = std::remove_const_t<
-            std::remove_reference_t<decltype(actual_src_view)>
-        >;
-
-        UnicodeStringView_T actual_v = std::get<UnicodeStringView_T>(v.view_);
-
-        return actual_src_view.compare(pos1, count1, actual_v, pos2, count2);
-      },
-      this->view_
+  return this->actual_view().compare(
+      pos1,
+      count1,
+      v.actual_view(),
+      pos2,
+      count2
   );
 }
 
 bool UnicodeStringView_Api::starts_with(UnicodeStringView_Api sv) const noexcept {
-  return std::visit(
-      [&sv](const auto& actual_view) {
-        using UnicodeStringView_T = std::remove_const_t<
-            std::remove_reference_t<decltype(actual_view)>
-        >;
-
-        UnicodeStringView_T actual_sv_data =
-            std::get<UnicodeStringView_T>(sv.view_);
-
-        return actual_view.starts_with(actual_sv_data);
-      },
-      this->view_
-  );
+  return this->actual_view().starts_with(sv.actual_view());
 }
 
 bool UnicodeStringView_Api::ends_with(UnicodeStringView_Api sv) const noexcept {
-  return std::visit(
-      [&sv](const auto& actual_view) {
-        using UnicodeStringView_T = std::remove_const_t<
-            std::remove_reference_t<decltype(actual_view)>
-        >;
-
-        UnicodeStringView_T actual_sv_data =
-            std::get<UnicodeStringView_T>(sv.view_);
-
-        return actual_view.ends_with(actual_sv_data);
-      },
-      this->view_
-  );
+  return this->actual_view().ends_with(sv.actual_view());
 }
 
 UnicodeStringView_Api::size_type UnicodeStringView_Api::find(
     UnicodeStringView_Api v,
     size_type pos
 ) const noexcept {
-  return std::visit(
-      [&v, pos](const auto& actual_view) {
-        using UnicodeStringView_T = std::remove_const_t<
-            std::remove_reference_t<decltype(actual_view)>
-        >;
-        using UnicodeChar_T = typename UnicodeStringView_T::value_type;
-
-        UnicodeStringView_T& actual_v =
-            std::get<UnicodeStringView_T>(v.view_);
-
-        return actual_view.find(actual_v, pos);
-      },
-      this->view_
-  );
+  return this->actual_view().find(v.actual_view(), pos);
 }
 
 void UnicodeStringView_Api::Draw(int position_x, int position_y) const {
@@ -243,11 +156,7 @@ void UnicodeStringView_Api::Draw(
     int position_y,
     const DrawTextOptions& options
 ) const {
-  int draw_width = d2win::GetUnicodeTextNDrawWidth(
-      this->data(),
-      this->length()
-  );
-
+  // Left-aligned text does not need to be measured.
   int adjusted_position_x;
   switch (options.position_x_behavior) {
     case DrawPositionXBehavior::kLeft: {
@@ -256,11 +165,21 @@ void UnicodeStringView_Api::Draw(
     }
 
     case DrawPositionXBehavior::kCenter: {
+      int draw_width = d2win::GetUnicodeTextNDrawWidth(
+          this->data(),
+          this->length()
+      );
+
       adjusted_position_x = position_x - (draw_width / 2);
       break;
     }
 
     case DrawPositionXBehavior::kRight: {
+      int draw_width = d2win::GetUnicodeTextNDrawWidth(
+          this->data(),
+          this->length()
+      );
+
       adjusted_position_x = position_x - draw_width;
       break;
     }
@@ -50,18 +50,15 @@
 #include "../../../../include/cxx/game_variable/bnclient/bnclient_gateway_domain_name.hpp"
 
 #include "../../../../include/cxx/default_game_library.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::bnclient {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kBNClient,
-      "GatewayDomainName"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables().bnclient_gateway_domain_name.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -71,7 +68,7 @@ char* GetGatewayDomainName() {
 }
 
 char* GetGatewayDomainName_1_00() {
-  std::intptr_t ptr = GetGameAddress().raw_address();
+  std::intptr_t ptr = GetRawAddress();
 
   return reinterpret_cast<char*>(ptr);
 }
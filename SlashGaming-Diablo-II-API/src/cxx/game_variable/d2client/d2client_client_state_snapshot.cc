@@ -0,0 +1,169 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "../../../../include/cxx/game_variable/d2client/d2client_client_state_snapshot.hpp"
+
+#include <cstring>
+
+#include "../../../../include/cxx/game_version.hpp"
+#include "../../backend/client_state_capture.hpp"
+#include "../../backend/resolved_variables.hpp"
+
+namespace d2::d2client {
+namespace {
+
+/**
+ * Resolves only the D2Client entries of the resolved variables, and
+ * only once D2Client is loaded.
+ */
+static mapi::ClientStateAddresses FindClientStateAddresses() {
+  const mapi::ResolvedVariables& variables = mapi::GetResolvedVariables();
+
+  mapi::ClientStateAddresses addresses;
+  addresses.screen_open_mode =
+      variables.d2client_screen_open_mode.FindIfLoaded();
+  addresses.difficulty_level =
+      variables.d2client_difficulty_level.FindIfLoaded();
+  addresses.game_type = variables.d2client_game_type.FindIfLoaded();
+
+  addresses.general_display_width =
+      variables.d2client_general_display_width.FindIfLoaded();
+  addresses.general_display_height =
+      variables.d2client_general_display_height.FindIfLoaded();
+  addresses.general_play_area_camera_shift_x =
+      variables.d2client_general_play_area_camera_shift_x.FindIfLoaded();
+  addresses.screen_shift_x = variables.d2client_screen_shift_x.FindIfLoaded();
+  addresses.screen_shift_y = variables.d2client_screen_shift_y.FindIfLoaded();
+  addresses.ingame_mouse_position_x =
+      variables.d2client_ingame_mouse_position_x.FindIfLoaded();
+  addresses.ingame_mouse_position_y =
+      variables.d2client_ingame_mouse_position_y.FindIfLoaded();
+  addresses.inventory_arrange_mode =
+      variables.d2client_inventory_arrange_mode.FindIfLoaded();
+
+  addresses.is_automap_open =
+      variables.d2client_is_automap_open.FindIfLoaded();
+  addresses.is_game_menu_open =
+      variables.d2client_is_game_menu_open.FindIfLoaded();
+  addresses.is_help_screen_open =
+      variables.d2client_is_help_screen_open.FindIfLoaded();
+  addresses.is_new_skill_button_pressed =
+      variables.d2client_is_new_skill_button_pressed.FindIfLoaded();
+  addresses.is_new_stats_button_pressed =
+      variables.d2client_is_new_stats_button_pressed.FindIfLoaded();
+
+  return addresses;
+}
+
+} // namespace
+
+ClientStateSnapshot CaptureClientState() {
+  return mapi::CaptureClientState(
+      FindClientStateAddresses(),
+      ::d2::game_version::GetRunning()
+  );
+}
+
+ClientStateSnapshotChannel::ClientStateSnapshotChannel() noexcept
+    : sequence_(0),
+      words_() {
+}
+
+void ClientStateSnapshotChannel::Update() {
+  this->Publish(CaptureClientState());
+}
+
+void ClientStateSnapshotChannel::Publish(
+    const ClientStateSnapshot& snapshot
+) noexcept {
+  std::uint32_t words[kWordCount];
+  std::memcpy(words, &snapshot, sizeof(words));
+
+  std::uint32_t sequence = this->sequence_.load(std::memory_order_relaxed);
+
+  // The fence keeps the word stores from becoming visible before the odd
+  // sequence does.
+  this->sequence_.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  for (std::size_t i = 0; i < kWordCount; i += 1) {
+    this->words_[i].store(words[i], std::memory_order_relaxed);
+  }
+
+  this->sequence_.store(sequence + 2, std::memory_order_release);
+}
+
+ClientStateSnapshot ClientStateSnapshotChannel::Read() const noexcept {
+  std::uint32_t words[kWordCount];
+  std::uint32_t sequence_before;
+  std::uint32_t sequence_after;
+
+  do {
+    sequence_before = this->sequence_.load(std::memory_order_acquire);
+    if ((sequence_before & 1) != 0) {
+      continue;
+    }
+
+    for (std::size_t i = 0; i < kWordCount; i += 1) {
+      words[i] = this->words_[i].load(std::memory_order_relaxed);
+    }
+
+    // The fence keeps the word loads from being reordered after the
+    // second sequence load.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    sequence_after = this->sequence_.load(std::memory_order_relaxed);
+  } while ((sequence_before & 1) != 0 || sequence_before != sequence_after);
+
+  ClientStateSnapshot snapshot;
+  std::memcpy(&snapshot, words, sizeof(snapshot));
+
+  return snapshot;
+}
+
+std::uint32_t ClientStateSnapshotChannel::publish_count() const noexcept {
+  return this->sequence_.load(std::memory_order_acquire) / 2;
+}
+
+} // namespace d2::d2client
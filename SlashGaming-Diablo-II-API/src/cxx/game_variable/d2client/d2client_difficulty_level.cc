@@ -50,18 +50,15 @@
 #include "../../../../include/cxx/game_variable/d2client/d2client_difficulty_level.hpp"
 
 #include "../../../../include/cxx/default_game_library.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::d2client {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kD2Client,
-      "DifficultyLevel"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables().d2client_difficulty_level.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -71,7 +68,7 @@ DifficultyLevel GetDifficultyLevel() {
 }
 
 DifficultyLevel_1_00 GetDifficultyLevel_1_00() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
 
   return *reinterpret_cast<DifficultyLevel_1_00*>(raw_address);
 }
@@ -83,7 +80,7 @@ void SetDifficultyLevel(DifficultyLevel difficulty_level) {
 }
 
 void SetDifficultyLevel_1_00(DifficultyLevel_1_00 difficulty_level) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
 
   *reinterpret_cast<DifficultyLevel_1_00*>(raw_address) = difficulty_level;
 }
@@ -51,18 +51,15 @@
 
 #include "../../../../include/cxx/default_game_library.hpp"
 #include "../../../../include/cxx/game_version.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::d2client {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kD2Client,
-      "GameType"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables().d2client_game_type.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -78,13 +75,13 @@ ClientGameType GetGameType() {
 }
 
 ClientGameType_1_00 GetGameType_1_00() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
 
   return *reinterpret_cast<ClientGameType_1_00*>(raw_address);
 }
 
 ClientGameType_1_07 GetGameType_1_07() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
 
   return *reinterpret_cast<ClientGameType_1_07*>(raw_address);
 }
@@ -100,13 +97,13 @@ void SetGameType(ClientGameType game_type) {
 }
 
 void SetGameType_1_00(ClientGameType_1_00 game_type) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
 
   *reinterpret_cast<ClientGameType_1_00*>(raw_address) = game_type;
 }
 
 void SetGameType_1_07(ClientGameType_1_07 game_type) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
 
   *reinterpret_cast<ClientGameType_1_07*>(raw_address) = game_type;
 }
@@ -50,18 +50,15 @@
 #include "../../../../include/cxx/game_variable/d2client/d2client_general_display_height.hpp"
 
 #include "../../../../include/cxx/default_game_library.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::d2client {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kD2Client,
-      "GeneralDisplayHeight"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables().d2client_general_display_height.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -71,7 +68,7 @@ int GetGeneralDisplayHeight() {
 }
 
 std::int32_t GetGeneralDisplayHeight_1_00() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
 
   return *reinterpret_cast<std::int32_t*>(raw_address);
 }
@@ -81,7 +78,7 @@ void SetGeneralDisplayHeight(int general_display_height) {
 }
 
 void SetGeneralDisplayHeight_1_00(std::int32_t general_display_height) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
 
   *reinterpret_cast<std::int32_t*>(raw_address) = general_display_height;
 }
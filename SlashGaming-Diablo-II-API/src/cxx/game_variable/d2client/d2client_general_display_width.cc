@@ -50,18 +50,15 @@
 #include "../../../../include/cxx/game_variable/d2client/d2client_general_display_width.hpp"
 
 #include "../../../../include/cxx/default_game_library.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::d2client {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kD2Client,
-      "GeneralDisplayWidth"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables().d2client_general_display_width.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -71,7 +68,7 @@ int GetGeneralDisplayWidth() {
 }
 
 std::int32_t GetGeneralDisplayWidth_1_00() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   return *reinterpret_cast<std::int32_t*>(raw_address);
 }
 
@@ -80,7 +77,7 @@ void SetGeneralDisplayWidth(int general_display_width) {
 }
 
 void SetGeneralDisplayWidth_1_00(std::int32_t general_display_width) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   *reinterpret_cast<std::int32_t*>(raw_address) = general_display_width;
 }
 
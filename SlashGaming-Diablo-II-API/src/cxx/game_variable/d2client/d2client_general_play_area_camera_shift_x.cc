@@ -50,18 +50,16 @@
 #include "../../../../include/cxx/game_variable/d2client/d2client_general_play_area_camera_shift_x.hpp"
 
 #include "../../../../include/cxx/default_game_library.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::d2client {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kD2Client,
-      "GeneralPlayAreaCameraShiftX"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables()
+          .d2client_general_play_area_camera_shift_x.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -71,7 +69,7 @@ int GetGeneralPlayAreaCameraShiftX() {
 }
 
 std::int32_t GetGeneralPlayAreaCameraShiftX_1_00() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   return *reinterpret_cast<std::int32_t*>(raw_address);
 }
 
@@ -80,7 +78,7 @@ void SetGeneralPlayAreaCameraShiftX(int camera_shift_x) {
 }
 
 void SetGeneralPlayAreaCameraShiftX_1_00(std::int32_t camera_shift_x) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   *reinterpret_cast<std::int32_t*>(raw_address) = camera_shift_x;
 }
 
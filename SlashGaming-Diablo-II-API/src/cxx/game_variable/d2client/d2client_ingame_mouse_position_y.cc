@@ -52,18 +52,15 @@
 #include <cstdint>
 
 #include "../../../../include/cxx/default_game_library.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::d2client {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kD2Client,
-      "IngameMousePositionY"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables().d2client_ingame_mouse_position_y.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -73,7 +70,7 @@ int GetIngameMousePositionY() {
 }
 
 std::int32_t GetIngameMousePositionY_1_00() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   return *reinterpret_cast<std::int32_t*>(raw_address);
 }
 
@@ -82,7 +79,7 @@ void SetIngameMousePositionY(int mouse_position_y) {
 }
 
 void SetIngameMousePositionY_1_00(std::int32_t mouse_position_y) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   *reinterpret_cast<std::int32_t*>(raw_address) = mouse_position_y;
 }
 
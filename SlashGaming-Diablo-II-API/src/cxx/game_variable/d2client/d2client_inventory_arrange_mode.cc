@@ -50,18 +50,15 @@
 #include "../../../../include/cxx/game_variable/d2client/d2client_inventory_arrange_mode.hpp"
 
 #include "../../../../include/cxx/default_game_library.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::d2client {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kD2Client,
-      "InventoryArrangeMode"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables().d2client_inventory_arrange_mode.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -71,7 +68,7 @@ unsigned int GetInventoryArrangeMode() {
 }
 
 std::uint32_t GetInventoryArrangeMode_1_00() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   return *reinterpret_cast<std::uint32_t*>(raw_address);
 }
 
@@ -80,7 +77,7 @@ void SetInventoryArrangeMode(unsigned int inventory_arrange_mode) {
 }
 
 void SetInventoryArrangeMode_1_00(std::uint32_t inventory_arrange_mode) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   *reinterpret_cast<std::uint32_t*>(raw_address) = inventory_arrange_mode;
 }
 
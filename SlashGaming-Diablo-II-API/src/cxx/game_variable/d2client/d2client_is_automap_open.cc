@@ -50,18 +50,15 @@
 #include "../../../../include/cxx/game_variable/d2client/d2client_is_automap_open.hpp"
 
 #include "../../../../include/cxx/default_game_library.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::d2client {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kD2Client,
-      "IsAutomapOpen"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables().d2client_is_automap_open.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -71,7 +68,7 @@ bool GetIsAutomapOpen() {
 }
 
 mapi::bool32 GetIsAutomapOpen_1_00() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   return *reinterpret_cast<mapi::bool32*>(raw_address);
 }
 
@@ -80,7 +77,7 @@ void SetIsAutomapOpen(bool is_automap_open) {
 }
 
 void SetIsAutomapOpen_1_00(mapi::bool32 is_automap_open) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   *reinterpret_cast<mapi::bool32*>(raw_address) = is_automap_open;
 }
 
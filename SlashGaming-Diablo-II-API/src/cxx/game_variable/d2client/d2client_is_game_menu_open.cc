@@ -50,18 +50,15 @@
 #include "../../../../include/cxx/game_variable/d2client/d2client_is_game_menu_open.hpp"
 
 #include "../../../../include/cxx/default_game_library.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::d2client {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kD2Client,
-      "IsGameMenuOpen"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables().d2client_is_game_menu_open.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -71,7 +68,7 @@ bool GetIsGameMenuOpen() {
 }
 
 mapi::bool32 GetIsGameMenuOpen_1_00() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   return *reinterpret_cast<mapi::bool32*>(raw_address);
 }
 
@@ -80,7 +77,7 @@ void SetIsGameMenuOpen(bool is_game_menu_open) {
 }
 
 void SetIsGameMenuOpen_1_00(mapi::bool32 is_game_menu_open) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   *reinterpret_cast<mapi::bool32*>(raw_address) = is_game_menu_open;
 }
 
@@ -51,18 +51,16 @@
 
 #include "../../../../include/cxx/default_game_library.hpp"
 #include "../../../../include/cxx/game_bool.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::d2client {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kD2Client,
-      "IsNewSkillButtonPressed"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables()
+          .d2client_is_new_skill_button_pressed.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -72,7 +70,7 @@ bool GetIsNewSkillButtonPressed() {
 }
 
 mapi::bool32 GetIsNewSkillButtonPressed_1_00() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   return *reinterpret_cast<mapi::bool32*>(raw_address);
 }
 
@@ -81,7 +79,7 @@ void SetIsNewSkillButtonPressed(bool is_button_pressed) {
 }
 
 void SetIsNewSkillButtonPressed_1_00(mapi::bool32 is_button_pressed) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   *reinterpret_cast<mapi::bool32*>(raw_address) = is_button_pressed;
 }
 
@@ -52,18 +52,15 @@
 #include <cstdint>
 
 #include "../../../../include/cxx/default_game_library.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::d2client {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kD2Client,
-      "ScreenOpenMode"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables().d2client_screen_open_mode.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -73,7 +70,7 @@ ScreenOpenMode GetScreenOpenMode() {
 }
 
 ScreenOpenMode_1_07 GetScreenOpenMode_1_07() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   return *reinterpret_cast<ScreenOpenMode_1_07*>(raw_address);
 }
 
@@ -84,7 +81,7 @@ void SetScreenOpenMode(ScreenOpenMode screen_open_mode) {
 }
 
 void SetScreenOpenMode_1_07(ScreenOpenMode_1_07 screen_open_mode) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   *reinterpret_cast<ScreenOpenMode_1_07*>(raw_address) = screen_open_mode;
 }
 
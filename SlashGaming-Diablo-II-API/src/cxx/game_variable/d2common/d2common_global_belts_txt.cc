@@ -52,18 +52,15 @@
 #include <cstdint>
 
 #include "../../../../include/cxx/default_game_library.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::d2common {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kD2Common,
-      "GlobalBeltsTxt"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables().d2common_global_belts_txt.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -73,7 +70,7 @@ BeltRecord* GetGlobalBeltsTxt() {
 }
 
 BeltRecord_1_00* GetGlobalBeltsTxt_1_00() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   return *reinterpret_cast<BeltRecord_1_00**>(raw_address);
 }
 
@@ -82,7 +79,7 @@ void SetGlobalBeltsTxt(BeltRecord* belt_record) {
 }
 
 void SetGlobalBeltsTxt_1_00(BeltRecord_1_00* belt_record) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   *reinterpret_cast<BeltRecord_1_00**>(raw_address) = belt_record;
 }
 
@@ -50,18 +50,15 @@
 #include "../../../../include/cxx/game_variable/d2common/d2common_global_inventory_txt.hpp"
 
 #include "../../../../include/cxx/default_game_library.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::d2common {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kD2Common,
-      "GlobalInventoryTxt"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables().d2common_global_inventory_txt.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -71,7 +68,7 @@ InventoryRecord* GetGlobalInventoryTxt() {
 }
 
 InventoryRecord_1_00* GetGlobalInventoryTxt_1_00() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   return *reinterpret_cast<InventoryRecord_1_00**>(raw_address);
 }
 
@@ -80,7 +77,7 @@ void SetGlobalInventoryTxt(InventoryRecord* inventory_record) {
 }
 
 void SetGlobalInventoryTxt_1_00(InventoryRecord_1_00* inventory_record) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   *reinterpret_cast<InventoryRecord_1_00**>(raw_address) = inventory_record;
 }
 
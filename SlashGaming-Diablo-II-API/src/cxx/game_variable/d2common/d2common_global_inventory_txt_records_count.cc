@@ -50,18 +50,16 @@
 #include "../../../../include/cxx/game_variable/d2common/d2common_global_inventory_txt_records_count.hpp"
 
 #include "../../../../include/cxx/default_game_library.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::d2common {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kD2Common,
-      "GlobalInventoryTxtRecordsCount"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables()
+          .d2common_global_inventory_txt_records_count.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -71,7 +69,7 @@ unsigned int GetGlobalInventoryTxtRecordsCount() {
 }
 
 std::uint32_t GetGlobalInventoryTxtRecordsCount_1_00() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   return *reinterpret_cast<std::uint32_t*>(raw_address);
 }
 
@@ -80,7 +78,7 @@ void SetGlobalInventoryTxtRecordsCount(unsigned int count) {
 }
 
 void SetGlobalInventoryTxtRecordsCount_1_00(std::uint32_t count) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   *reinterpret_cast<std::uint32_t*>(raw_address) = count;
 }
 
@@ -52,18 +52,15 @@
 #include <cstdint>
 
 #include "../../../../include/cxx/default_game_library.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::d2gdi {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kD2GDI,
-      "BitBlockWidth"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables().d2gdi_bit_block_width.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -73,7 +70,7 @@ int GetBitBlockWidth() {
 }
 
 int GetBitBlockWidth_1_00() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   return *reinterpret_cast<std::int32_t*>(raw_address);
 }
 
@@ -82,7 +79,7 @@ void SetBitBlockWidth(int width) {
 }
 
 void SetBitBlockWidth_1_00(std::int32_t width) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   *reinterpret_cast<std::int32_t*>(raw_address) = width;
 }
 
@@ -50,18 +50,15 @@
 #include "../../../../include/cxx/game_variable/d2gfx/d2gfx_resolution_mode.hpp"
 
 #include "../../../../include/cxx/default_game_library.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::d2gfx {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kD2GFX,
-      "ResolutionMode"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables().d2gfx_resolution_mode.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -71,7 +68,7 @@ unsigned int GetResolutionMode() {
 }
 
 std::uint32_t GetResolutionMode_1_00() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   return *reinterpret_cast<std::uint32_t*>(raw_address);
 }
 
@@ -80,7 +77,7 @@ void SetResolutionMode(unsigned int resolution_mode) {
 }
 
 void SetResolutionMode_1_00(std::uint32_t resolution_mode) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   *reinterpret_cast<std::uint32_t*>(raw_address) = resolution_mode;
 }
 
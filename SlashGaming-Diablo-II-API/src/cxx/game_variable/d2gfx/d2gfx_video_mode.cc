@@ -50,18 +50,15 @@
 #include "../../../../include/cxx/game_variable/d2gfx/d2gfx_video_mode.hpp"
 
 #include "../../../../include/cxx/default_game_library.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::d2gfx {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kD2GFX,
-      "VideoMode"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables().d2gfx_video_mode.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -71,7 +68,7 @@ VideoMode GetVideoMode() {
 }
 
 VideoMode_1_00 GetVideoMode_1_00() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   return *reinterpret_cast<VideoMode_1_00*>(raw_address);
 }
 
@@ -80,7 +77,7 @@ void SetVideoMode(VideoMode video_mode) {
 }
 
 void SetVideoMode_1_00(VideoMode_1_00 video_mode) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   *reinterpret_cast<VideoMode_1_00*>(raw_address) = video_mode;
 }
 
@@ -50,18 +50,15 @@
 #include "../../../../include/cxx/game_variable/d2win/d2win_main_menu_mouse_position_y.hpp"
 
 #include "../../../../include/cxx/default_game_library.hpp"
-#include "../../backend/game_address_table.hpp"
+#include "../../backend/resolved_variables.hpp"
 
 namespace d2::d2win {
 namespace {
 
-static const mapi::GameAddress& GetGameAddress() {
-  static const mapi::GameAddress game_address = mapi::LoadGameAddress(
-      ::d2::DefaultLibrary::kD2Win,
-      "MainMenuMousePositionY"
+static std::intptr_t GetRawAddress() {
+  return reinterpret_cast<std::intptr_t>(
+      mapi::GetResolvedVariables().d2win_main_menu_mouse_position_y.Require()
   );
-
-  return game_address;
 }
 
 } // namespace
@@ -71,7 +68,7 @@ int GetMainMenuMousePositionY() {
 }
 
 std::int32_t GetMainMenuMousePositionY_1_00() {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   return *reinterpret_cast<std::int32_t*>(raw_address);
 }
 
@@ -80,7 +77,7 @@ void SetMainMenuMousePositionY(int mouse_position_y) {
 }
 
 void SetMainMenuMousePositionY_1_00(std::int32_t mouse_position_y) {
-  std::intptr_t raw_address = GetGameAddress().raw_address();
+  std::intptr_t raw_address = GetRawAddress();
   *reinterpret_cast<std::int32_t*>(raw_address) = mouse_position_y;
 }
 
@@ -51,7 +51,9 @@
 #include <mdc/error/exit_on_error.hpp>
 #include <mdc/wchar_t/filew.h>
 #include "../../include/cxx/game_executable.hpp"
+#include "backend/d2se/d2se_file_signature.hpp"
 #include "backend/d2se/d2se_ini.hpp"
+#include "backend/file/mapped_file.hpp"
 #include "backend/game_version/game_version_file_version.hpp"
 #include "backend/game_version/game_version_file_signature.hpp"
 
@@ -59,13 +61,30 @@ namespace d2::game_version {
 namespace {
 
 static GameVersion DetermineRunningGameVersion() {
-  const wchar_t* game_executable_path = mapi::game_executable::GetPath();
+  // The executable is mapped once, and every signature check during
+  // detection reads from this mapping. It is unmapped on return.
+  const mapi::MappedFile game_executable_file(
+      mapi::game_executable::GetPath()
+  );
 
   // Check if running on D2SE. If so, use D2SE_SETUP.ini entries.
-  if (mapi::game_executable::IsD2se()) {
+  if (d2se::intern::file_signature::IsFileD2seExecutable(
+          game_executable_file
+      )) {
     return d2se::intern::d2se_ini::GetGameVersion();
   }
 
+  // Some game versions can be identified from the executable's PE
+  // header alone, which avoids querying the file version.
+  GameVersion fingerprint_game_version;
+
+  if (intern::file_signature::DetermineGameVersionFromExecutable(
+          game_executable_file,
+          &fingerprint_game_version
+      )) {
+    return fingerprint_game_version;
+  }
+
   // Guess the game version from the executable's file version.
   GameVersion guess_game_version = intern::file_version::GuessGameVersion();
 
@@ -75,7 +94,8 @@ static GameVersion DetermineRunningGameVersion() {
 
   if (intern::file_signature::HasCheck(guess_game_version)) {
     game_version = intern::file_signature::GuessGameVersion(
-        IsAtLeast1_14(guess_game_version)
+        IsAtLeast1_14(guess_game_version),
+        game_executable_file
     );
   } else {
     game_version = guess_game_version;
@@ -0,0 +1,276 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "../../../include/cxx/helper/d2_game_string_table.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "../../../include/cxx/game_function/d2lang/d2lang_get_string_by_index.hpp"
+#include "../../../include/cxx/game_function/d2win/d2win_set_unicode_text_font.hpp"
+#include "../backend/unicode_text_width_cache.hpp"
+#include "../backend/utf8_transcoder.hpp"
+
+namespace d2 {
+namespace {
+
+class D2LangStringSource : public GameStringSource {
+ public:
+  UnicodeStringView_Api GetStringByIndex(unsigned int id) override {
+    return UnicodeStringView_Api(d2lang::GetStringByIndex(id));
+  }
+
+  int GetDrawWidth(
+      UnicodeStringView_Api text,
+      TextFont text_font
+  ) override {
+    TextFont previous_font = d2win::SetUnicodeTextFont(text_font);
+
+    int draw_width = mapi::GetCachedUnicodeTextNDrawWidth(
+        text_font::ToGameValue_1_00(text_font),
+        reinterpret_cast<const UnicodeChar_1_00*>(text.data()),
+        text.length()
+    );
+
+    d2win::SetUnicodeTextFont(previous_font);
+
+    return draw_width;
+  }
+};
+
+} // namespace
+
+GameStringSource::~GameStringSource() = default;
+
+GameStringSource& GameStringSource::GetGameSource() {
+  static D2LangStringSource game_source;
+
+  return game_source;
+}
+
+GameStringTable::GameStringTable()
+    : GameStringTable(GameStringSource::GetGameSource()) {
+}
+
+GameStringTable::GameStringTable(GameStringSource& source)
+    : source_(&source),
+      language_(0),
+      hit_count_(0),
+      miss_count_(0),
+      memory_usage_(0) {
+}
+
+GameStringTable::GameStringTable(GameStringTable&& table) noexcept = default;
+
+GameStringTable::~GameStringTable() = default;
+
+GameStringTable& GameStringTable::operator=(
+    GameStringTable&& table
+) noexcept = default;
+
+UnicodeStringView_Api GameStringTable::GetString(unsigned int id) {
+  return this->GetEntry(id).text;
+}
+
+std::u8string_view GameStringTable::GetUtf8String(unsigned int id) {
+  return this->GetEntry(id).utf8_text;
+}
+
+int GameStringTable::GetDrawWidth(unsigned int id, TextFont text_font) {
+  Entry& entry = this->GetEntry(id);
+
+  if (!entry.has_draw_width || entry.draw_width_font != text_font) {
+    entry.draw_width = this->source_->GetDrawWidth(entry.text, text_font);
+    entry.draw_width_font = text_font;
+    entry.has_draw_width = true;
+  }
+
+  return entry.draw_width;
+}
+
+void GameStringTable::Preload(unsigned int first_id, unsigned int id_count) {
+  std::vector<unsigned int> ids;
+  std::vector<UnicodeStringView_Api> texts;
+
+  ids.reserve(id_count);
+  texts.reserve(id_count);
+
+  for (unsigned int i = 0; i < id_count; i += 1) {
+    unsigned int id = first_id + i;
+
+    if (this->entries_.contains(this->GetKey(id))) {
+      continue;
+    }
+
+    ids.push_back(id);
+    texts.push_back(this->source_->GetStringByIndex(id));
+  }
+
+  this->Intern(ids.data(), texts.data(), ids.size());
+}
+
+void GameStringTable::SetLanguage(std::uint32_t language) {
+  this->language_ = language;
+}
+
+std::uint32_t GameStringTable::language() const noexcept {
+  return this->language_;
+}
+
+void GameStringTable::Clear() noexcept {
+  this->entries_.clear();
+  this->text_blocks_.clear();
+  this->utf8_blocks_.clear();
+  this->memory_usage_ = 0;
+}
+
+std::size_t GameStringTable::size() const noexcept {
+  return this->entries_.size();
+}
+
+std::size_t GameStringTable::hit_count() const noexcept {
+  return this->hit_count_;
+}
+
+std::size_t GameStringTable::miss_count() const noexcept {
+  return this->miss_count_;
+}
+
+std::size_t GameStringTable::memory_usage() const noexcept {
+  return this->memory_usage_;
+}
+
+std::uint64_t GameStringTable::GetKey(unsigned int id) const noexcept {
+  return (static_cast<std::uint64_t>(this->language_) << 32) | id;
+}
+
+GameStringTable::Entry& GameStringTable::GetEntry(unsigned int id) {
+  std::uint64_t key = this->GetKey(id);
+
+  auto entry_it = this->entries_.find(key);
+  if (entry_it != this->entries_.end()) {
+    this->hit_count_ += 1;
+    return entry_it->second;
+  }
+
+  this->miss_count_ += 1;
+
+  UnicodeStringView_Api text = this->source_->GetStringByIndex(id);
+  this->Intern(&id, &text, 1);
+
+  return this->entries_.at(key);
+}
+
+void GameStringTable::Intern(
+    const unsigned int* ids,
+    const UnicodeStringView_Api* texts,
+    std::size_t count
+) {
+  if (count == 0) {
+    return;
+  }
+
+  // Size both blocks up front so that each is a single allocation.
+  std::size_t total_text_length = 0;
+  std::size_t total_utf8_length = 0;
+
+  for (std::size_t i = 0; i < count; i += 1) {
+    const std::uint16_t* text =
+        reinterpret_cast<const std::uint16_t*>(texts[i].data());
+
+    total_text_length += texts[i].length() + 1;
+    total_utf8_length +=
+        mapi::GetUtf16ToUtf8Length(text, texts[i].length()) + 1;
+  }
+
+  std::unique_ptr<UnicodeChar_1_00[]> text_block(
+      new UnicodeChar_1_00[total_text_length]
+  );
+  std::unique_ptr<char8_t[]> utf8_block(new char8_t[total_utf8_length]);
+
+  UnicodeChar_1_00* text_dest = text_block.get();
+  char8_t* utf8_dest = utf8_block.get();
+
+  this->entries_.reserve(this->entries_.size() + count);
+
+  for (std::size_t i = 0; i < count; i += 1) {
+    std::size_t text_length = texts[i].length();
+    const UnicodeChar_1_00* text_src =
+        reinterpret_cast<const UnicodeChar_1_00*>(texts[i].data());
+
+    std::copy_n(text_src, text_length, text_dest);
+    text_dest[text_length] = UnicodeChar_1_00();
+
+    std::size_t utf8_length = mapi::TranscodeUtf16ToUtf8(
+        reinterpret_cast<const std::uint16_t*>(text_dest),
+        text_length,
+        utf8_dest
+    );
+    utf8_dest[utf8_length] = u8'\0';
+
+    Entry entry;
+    entry.text = UnicodeStringView_Api(
+        reinterpret_cast<const UnicodeChar*>(text_dest),
+        text_length
+    );
+    entry.utf8_text = std::u8string_view(utf8_dest, utf8_length);
+    entry.draw_width_font = TextFont();
+    entry.draw_width = 0;
+    entry.has_draw_width = false;
+
+    this->entries_.insert_or_assign(this->GetKey(ids[i]), entry);
+
+    text_dest += text_length + 1;
+    utf8_dest += utf8_length + 1;
+  }
+
+  this->memory_usage_ += total_text_length * sizeof(UnicodeChar_1_00);
+  this->memory_usage_ += total_utf8_length * sizeof(char8_t);
+
+  this->text_blocks_.push_back(std::move(text_block));
+  this->utf8_blocks_.push_back(std::move(utf8_block));
+}
+
+} // namespace d2
@@ -0,0 +1,195 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "../../../include/cxx/helper/d2_game_variable_snapshot.hpp"
+
+#include "../backend/resolved_variables.hpp"
+
+namespace d2 {
+namespace {
+
+template <typename T>
+static void CaptureVariable(
+    GameVariableMask mask,
+    GameVariable variable,
+    const mapi::ResolvedVariable<T>& resolved_variable,
+    T* out_value,
+    GameVariableMask* captured_mask
+) {
+  GameVariableMask variable_mask = ToGameVariableMask(variable);
+
+  if ((mask & variable_mask) == 0) {
+    return;
+  }
+
+  const T* address = resolved_variable.FindIfLoaded();
+
+  if (address == nullptr) {
+    return;
+  }
+
+  *out_value = *address;
+  *captured_mask |= variable_mask;
+}
+
+} // namespace
+
+void CaptureGameVariables(
+    GameVariableMask mask,
+    GameVariableSnapshot* snapshot
+) {
+  const mapi::ResolvedVariables& variables = mapi::GetResolvedVariables();
+  GameVariableMask captured_mask = 0;
+
+#define CAPTURE_VARIABLE(variable, resolved_member, snapshot_member) \
+    CaptureVariable( \
+        mask, \
+        GameVariable::variable, \
+        variables.resolved_member, \
+        &snapshot->snapshot_member, \
+        &captured_mask \
+    )
+
+  CAPTURE_VARIABLE(
+      kDifficultyLevel,
+      d2client_difficulty_level,
+      difficulty_level
+  );
+  CAPTURE_VARIABLE(kGameType, d2client_game_type, game_type);
+  CAPTURE_VARIABLE(
+      kGeneralDisplayHeight,
+      d2client_general_display_height,
+      general_display_height
+  );
+  CAPTURE_VARIABLE(
+      kGeneralDisplayWidth,
+      d2client_general_display_width,
+      general_display_width
+  );
+  CAPTURE_VARIABLE(
+      kGeneralPlayAreaCameraShiftX,
+      d2client_general_play_area_camera_shift_x,
+      general_play_area_camera_shift_x
+  );
+  CAPTURE_VARIABLE(
+      kIngameMousePositionX,
+      d2client_ingame_mouse_position_x,
+      ingame_mouse_position_x
+  );
+  CAPTURE_VARIABLE(
+      kIngameMousePositionY,
+      d2client_ingame_mouse_position_y,
+      ingame_mouse_position_y
+  );
+  CAPTURE_VARIABLE(
+      kInventoryArrangeMode,
+      d2client_inventory_arrange_mode,
+      inventory_arrange_mode
+  );
+  CAPTURE_VARIABLE(
+      kIsAutomapOpen,
+      d2client_is_automap_open,
+      is_automap_open
+  );
+  CAPTURE_VARIABLE(
+      kIsGameMenuOpen,
+      d2client_is_game_menu_open,
+      is_game_menu_open
+  );
+  CAPTURE_VARIABLE(
+      kIsHelpScreenOpen,
+      d2client_is_help_screen_open,
+      is_help_screen_open
+  );
+  CAPTURE_VARIABLE(
+      kIsNewSkillButtonPressed,
+      d2client_is_new_skill_button_pressed,
+      is_new_skill_button_pressed
+  );
+  CAPTURE_VARIABLE(
+      kIsNewStatsButtonPressed,
+      d2client_is_new_stats_button_pressed,
+      is_new_stats_button_pressed
+  );
+  CAPTURE_VARIABLE(
+      kScreenOpenMode,
+      d2client_screen_open_mode,
+      screen_open_mode
+  );
+  CAPTURE_VARIABLE(kScreenShiftX, d2client_screen_shift_x, screen_shift_x);
+  CAPTURE_VARIABLE(kScreenShiftY, d2client_screen_shift_y, screen_shift_y);
+  CAPTURE_VARIABLE(
+      kGlobalInventoryTxtRecordsCount,
+      d2common_global_inventory_txt_records_count,
+      global_inventory_txt_records_count
+  );
+  CAPTURE_VARIABLE(
+      kIsWindowedMode,
+      d2gfx_is_windowed_mode,
+      is_windowed_mode
+  );
+  CAPTURE_VARIABLE(
+      kResolutionMode,
+      d2gfx_resolution_mode,
+      resolution_mode
+  );
+  CAPTURE_VARIABLE(kVideoMode, d2gfx_video_mode, video_mode);
+  CAPTURE_VARIABLE(
+      kMainMenuMousePositionX,
+      d2win_main_menu_mouse_position_x,
+      main_menu_mouse_position_x
+  );
+  CAPTURE_VARIABLE(
+      kMainMenuMousePositionY,
+      d2win_main_menu_mouse_position_y,
+      main_menu_mouse_position_y
+  );
+
+#undef CAPTURE_VARIABLE
+
+  snapshot->captured_mask = captured_mask;
+}
+
+} // namespace d2
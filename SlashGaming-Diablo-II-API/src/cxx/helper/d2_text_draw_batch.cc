@@ -0,0 +1,253 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "../../../include/cxx/helper/d2_text_draw_batch.hpp"
+
+#include <algorithm>
+#include <tuple>
+
+#include <mdc/error/exit_on_error.hpp>
+#include <mdc/wchar_t/filew.h>
+#include "../../../include/cxx/game_function/d2win/d2win_draw_unicode_text.hpp"
+#include "../../../include/cxx/game_function/d2win/d2win_set_unicode_text_font.hpp"
+#include "../backend/unicode_text_width_cache.hpp"
+
+namespace d2 {
+namespace {
+
+class GameTextDrawBackend : public TextDrawBackend {
+ public:
+  GameTextDrawBackend()
+      : text_font_(TextFont::kFormal_10) {
+  }
+
+  TextFont SetFont(TextFont text_font) override {
+    this->text_font_ = text_font;
+
+    return d2win::SetUnicodeTextFont(text_font);
+  }
+
+  // The game may have switched fonts since it was last set here, but
+  // TextDrawBatch always sets the font before it measures text.
+  int GetDrawWidth(UnicodeStringView_Api text) override {
+    return mapi::GetCachedUnicodeTextNDrawWidth(
+        text_font::ToGameValue_1_00(this->text_font_),
+        reinterpret_cast<const UnicodeChar_1_00*>(text.data()),
+        text.length()
+    );
+  }
+
+  void DrawUnicodeText(
+      UnicodeStringView_Api text,
+      int position_x,
+      int position_y,
+      TextColor text_color
+  ) override {
+    d2win::DrawUnicodeText(
+        text.data(),
+        position_x,
+        position_y,
+        text_color,
+        false
+    );
+  }
+
+ private:
+  TextFont text_font_;
+};
+
+} // namespace
+
+TextDrawBackend::~TextDrawBackend() = default;
+
+TextDrawBackend& TextDrawBackend::GetGameBackend() {
+  static GameTextDrawBackend game_backend;
+
+  return game_backend;
+}
+
+TextDrawBatch::TextDrawBatch()
+    : TextDrawBatch(TextDrawBackend::GetGameBackend()) {
+}
+
+TextDrawBatch::TextDrawBatch(TextDrawBackend& backend)
+    : backend_(&backend) {
+}
+
+TextDrawBatch::TextDrawBatch(TextDrawBatch&& batch) noexcept = default;
+
+TextDrawBatch::~TextDrawBatch() = default;
+
+TextDrawBatch& TextDrawBatch::operator=(
+    TextDrawBatch&& batch
+) noexcept = default;
+
+void TextDrawBatch::Add(
+    UnicodeStringView_Api text,
+    int position_x,
+    int position_y,
+    TextFont text_font,
+    const DrawTextOptions& options
+) {
+  Command command = {
+      text,
+      position_x,
+      position_y,
+      options.position_x_behavior,
+      options.text_color,
+      text_font,
+      static_cast<std::uint32_t>(this->commands_.size())
+  };
+
+  this->commands_.push_back(command);
+}
+
+void TextDrawBatch::AddCentered(
+    UnicodeStringView_Api text,
+    int left,
+    int right,
+    int position_y,
+    TextFont text_font,
+    TextColor text_color
+) {
+  DrawTextOptions options;
+  options.position_x_behavior = DrawPositionXBehavior::kCenter;
+  options.text_color = text_color;
+
+  this->Add(text, (left + right) / 2, position_y, text_font, options);
+}
+
+void TextDrawBatch::Flush() {
+  if (this->commands_.empty()) {
+    return;
+  }
+
+  // The sequence number makes every key unique, which keeps the order of
+  // draws within a group without the buffer that stable_sort allocates.
+  std::sort(
+      this->commands_.begin(),
+      this->commands_.end(),
+      [](const Command& command1, const Command& command2) {
+        return std::tie(
+            command1.text_font,
+            command1.text_color,
+            command1.sequence
+        ) < std::tie(
+            command2.text_font,
+            command2.text_color,
+            command2.sequence
+        );
+      }
+  );
+
+  TextFont current_font = this->commands_.front().text_font;
+  TextFont previous_font = this->backend_->SetFont(current_font);
+
+  for (const Command& command : this->commands_) {
+    if (command.text_font != current_font) {
+      current_font = command.text_font;
+      this->backend_->SetFont(current_font);
+    }
+
+    int adjusted_position_x;
+    switch (command.position_x_behavior) {
+      case DrawPositionXBehavior::kLeft: {
+        adjusted_position_x = command.position_x;
+        break;
+      }
+
+      case DrawPositionXBehavior::kCenter: {
+        int draw_width = this->backend_->GetDrawWidth(command.text);
+        adjusted_position_x = command.position_x - (draw_width / 2);
+        break;
+      }
+
+      case DrawPositionXBehavior::kRight: {
+        int draw_width = this->backend_->GetDrawWidth(command.text);
+        adjusted_position_x = command.position_x - draw_width;
+        break;
+      }
+
+      default: {
+        ::mdc::error::ExitOnGeneralError(
+            L"Error",
+            L"Invalid value for DrawPositionXBehavior: %d.",
+            __FILEW__,
+            __LINE__,
+            static_cast<int>(command.position_x_behavior)
+        );
+
+        return;
+      }
+    }
+
+    this->backend_->DrawUnicodeText(
+        command.text,
+        adjusted_position_x,
+        command.position_y,
+        command.text_color
+    );
+  }
+
+  if (current_font != previous_font) {
+    this->backend_->SetFont(previous_font);
+  }
+
+  this->commands_.clear();
+}
+
+void TextDrawBatch::Clear() noexcept {
+  this->commands_.clear();
+}
+
+std::size_t TextDrawBatch::size() const noexcept {
+  return this->commands_.size();
+}
+
+bool TextDrawBatch::empty() const noexcept {
+  return this->commands_.empty();
+}
+
+} // namespace d2
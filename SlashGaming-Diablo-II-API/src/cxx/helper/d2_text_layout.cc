@@ -0,0 +1,419 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "../../../include/cxx/helper/d2_text_layout.hpp"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../../../include/cxx/game_function/d2win/d2win_get_pop_up_unicode_text_width_and_height.hpp"
+#include "../../../include/cxx/game_function/d2win/d2win_set_unicode_text_font.hpp"
+#include "../backend/unicode_text_width_cache.hpp"
+
+namespace d2 {
+namespace {
+
+// The game starts a color code with U+00FF, followed by 'c' and the
+// color's character.
+static constexpr std::uint16_t kColorCodeLead = 0xFF;
+static constexpr int kColorCodeLength = 3;
+static constexpr std::uint16_t kLineBreak = u'\n';
+static constexpr std::uint16_t kSpace = u' ';
+
+// TextFont values run from 0 to kFormalWide_11.
+static constexpr std::size_t kTextFontCount =
+    static_cast<std::size_t>(TextFont::kFormalWide_11) + 1;
+
+class GameTextLayoutSource : public TextLayoutSource {
+ public:
+  GameTextLayoutSource() {
+    this->line_heights_.fill(kUnknownLineHeight);
+  }
+
+  // Shares the glyph tables of the width cache, so each glyph is only
+  // measured by the game once per process.
+  int GetGlyphWidth(UnicodeChar_1_00 ch, TextFont text_font) override {
+    return mapi::GetCachedUnicodeTextGlyphWidth(
+        text_font::ToGameValue_1_00(text_font),
+        ch.ch
+    );
+  }
+
+  int GetLineHeight(TextFont text_font) override {
+    int& line_height = this->line_heights_[static_cast<int>(text_font)];
+
+    if (line_height == kUnknownLineHeight) {
+      // The pop-up height of a single line of text is one line height.
+      static constexpr UnicodeChar_1_00 kSampleText[2] = { { u'A' }, { 0 } };
+
+      int width;
+      TextFont previous_font = d2win::SetUnicodeTextFont(text_font);
+      d2win::GetPopUpUnicodeTextWidthAndHeight(
+          reinterpret_cast<const UnicodeChar*>(kSampleText),
+          &width,
+          &line_height
+      );
+      d2win::SetUnicodeTextFont(previous_font);
+    }
+
+    return line_height;
+  }
+
+ private:
+  static constexpr int kUnknownLineHeight = -1;
+
+  std::array<int, kTextFontCount> line_heights_;
+};
+
+static std::u16string_view ToU16StringView(
+    UnicodeStringView_Api text
+) noexcept {
+  return std::u16string_view(
+      reinterpret_cast<const char16_t*>(text.data()),
+      text.length()
+  );
+}
+
+static std::size_t HashLayoutKey(
+    std::u16string_view text,
+    TextFont text_font,
+    int max_width
+) noexcept {
+  std::size_t key = std::hash<std::u16string_view>()(text);
+
+  key ^= std::hash<int>()(static_cast<int>(text_font))
+      + 0x9E3779B9 + (key << 6) + (key >> 2);
+  key ^= std::hash<int>()(max_width)
+      + 0x9E3779B9 + (key << 6) + (key >> 2);
+
+  return key;
+}
+
+} // namespace
+
+TextLayoutSource::~TextLayoutSource() = default;
+
+TextLayoutSource& TextLayoutSource::GetGameSource() {
+  static GameTextLayoutSource game_source;
+
+  return game_source;
+}
+
+TextLayout::TextLayout()
+    : width_(0),
+      line_height_(0),
+      is_used_(false) {
+}
+
+TextLayout::TextLayout(TextLayout&& layout) noexcept = default;
+
+TextLayout::~TextLayout() = default;
+
+TextLayout& TextLayout::operator=(TextLayout&& layout) noexcept = default;
+
+std::span<const TextLayoutLine> TextLayout::lines() const noexcept {
+  return this->lines_;
+}
+
+int TextLayout::width() const noexcept {
+  return this->width_;
+}
+
+int TextLayout::height() const noexcept {
+  return static_cast<int>(this->lines_.size()) * this->line_height_;
+}
+
+int TextLayout::line_height() const noexcept {
+  return this->line_height_;
+}
+
+TextLayoutEngine::TextLayoutEngine()
+    : TextLayoutEngine(TextLayoutSource::GetGameSource()) {
+}
+
+TextLayoutEngine::TextLayoutEngine(TextLayoutSource& source)
+    : source_(&source) {
+}
+
+TextLayoutEngine::TextLayoutEngine(
+    TextLayoutEngine&& engine
+) noexcept = default;
+
+TextLayoutEngine::~TextLayoutEngine() = default;
+
+TextLayoutEngine& TextLayoutEngine::operator=(
+    TextLayoutEngine&& engine
+) noexcept = default;
+
+const TextLayout& TextLayoutEngine::Layout(
+    UnicodeStringView_Api text,
+    TextFont text_font,
+    int max_width
+) {
+  LayoutKey key = { ToU16StringView(text), text_font, max_width };
+
+  auto layout_it = this->layouts_.find(key);
+  if (layout_it != this->layouts_.end()) {
+    TextLayout& layout = *layout_it->second;
+    layout.is_used_ = true;
+
+    return layout;
+  }
+
+  std::unique_ptr<TextLayout> layout = std::make_unique<TextLayout>();
+  this->Build(*layout, text, text_font, max_width);
+  layout->is_used_ = true;
+
+  // The caller's text may not outlive this call, so the stored key views
+  // the layout's copy instead.
+  key.text = layout->source_text_;
+
+  return *this->layouts_.emplace(key, std::move(layout)).first->second;
+}
+
+void TextLayoutEngine::Clear() noexcept {
+  this->layouts_.clear();
+}
+
+void TextLayoutEngine::Trim() noexcept {
+  for (auto layout_it = this->layouts_.begin();
+      layout_it != this->layouts_.end(); ) {
+    TextLayout& layout = *layout_it->second;
+
+    if (!layout.is_used_) {
+      layout_it = this->layouts_.erase(layout_it);
+      continue;
+    }
+
+    layout.is_used_ = false;
+    ++layout_it;
+  }
+}
+
+std::size_t TextLayoutEngine::size() const noexcept {
+  return this->layouts_.size();
+}
+
+std::size_t TextLayoutEngine::LayoutKeyHash::operator()(
+    const LayoutKey& key
+) const noexcept {
+  return HashLayoutKey(key.text, key.text_font, key.max_width);
+}
+
+void TextLayoutEngine::Build(
+    TextLayout& layout,
+    UnicodeStringView_Api text,
+    TextFont text_font,
+    int max_width
+) {
+  // The text is copied first, as it may point into another layout's
+  // lines.
+  layout.source_text_ = ToU16StringView(text);
+  layout.line_text_.clear();
+  layout.lines_.clear();
+  layout.width_ = 0;
+  layout.line_height_ = this->source_->GetLineHeight(text_font);
+
+  const std::uint16_t* src =
+      reinterpret_cast<const std::uint16_t*>(layout.source_text_.data());
+  int length = static_cast<int>(layout.source_text_.length());
+
+  // Each line is drawn on its own, so a line that starts while a color
+  // code is active begins with a copy of that code. These hold the
+  // position of the code for each line, or -1 if there is none.
+  std::vector<int> line_color_codes;
+
+  // Lines first refer to the copied text, then are moved into null
+  // terminated storage once the line count is known.
+  auto add_line = [&layout, &line_color_codes, src](
+      int begin,
+      int end,
+      int width,
+      int color_code
+  ) {
+    UnicodeStringView_Api line_text(
+        reinterpret_cast<const UnicodeChar*>(&src[begin]),
+        end - begin
+    );
+
+    layout.lines_.push_back(TextLayoutLine{ line_text, width });
+    layout.width_ = std::max(layout.width_, width);
+    line_color_codes.push_back(color_code);
+  };
+
+  int line_begin = 0;
+  int line_width = 0;
+  int line_color_code = -1;
+
+  // The most recent complete color code.
+  int active_color_code = -1;
+
+  // The end of the line and its width if it breaks at the last space,
+  // and the start of the next line, its width so far, and the color
+  // code active at its start.
+  int break_end = -1;
+  int break_width = 0;
+  int resume_begin = 0;
+  int resume_width = 0;
+  int resume_color_code = -1;
+
+  for (int i = 0; i < length; ) {
+    std::uint16_t ch = src[i];
+
+    if (ch == kLineBreak) {
+      add_line(line_begin, i, line_width, line_color_code);
+
+      i += 1;
+      line_begin = i;
+      line_width = 0;
+      line_color_code = active_color_code;
+      break_end = -1;
+      continue;
+    }
+
+    if (ch == kColorCodeLead) {
+      if (length - i >= kColorCodeLength) {
+        active_color_code = i;
+      }
+
+      i += std::min(kColorCodeLength, length - i);
+      continue;
+    }
+
+    int glyph_width = this->source_->GetGlyphWidth(
+        UnicodeChar_1_00{ ch },
+        text_font
+    );
+
+    if (ch == kSpace) {
+      // A run of spaces breaks at its first space.
+      if (break_end == -1 || resume_begin != i) {
+        break_end = i;
+        break_width = line_width;
+      }
+
+      line_width += glyph_width;
+
+      i += 1;
+      resume_begin = i;
+      resume_width = 0;
+      resume_color_code = active_color_code;
+      continue;
+    }
+
+    if (max_width > 0) {
+      while (line_width + glyph_width > max_width && i > line_begin) {
+        if (break_end > line_begin) {
+          add_line(line_begin, break_end, break_width, line_color_code);
+          line_begin = resume_begin;
+          line_width = resume_width;
+          line_color_code = resume_color_code;
+        } else {
+          add_line(line_begin, i, line_width, line_color_code);
+          line_begin = i;
+          line_width = 0;
+          line_color_code = active_color_code;
+        }
+
+        break_end = -1;
+      }
+    }
+
+    line_width += glyph_width;
+    resume_width += glyph_width;
+    i += 1;
+  }
+
+  if (length > 0) {
+    add_line(line_begin, length, line_width, line_color_code);
+  }
+
+  layout.line_text_.reserve(
+      length + (layout.lines_.size() * (kColorCodeLength + 1))
+  );
+
+  for (std::size_t i = 0; i < layout.lines_.size(); i += 1) {
+    TextLayoutLine& line = layout.lines_[i];
+    int color_code = line_color_codes[i];
+
+    const UnicodeChar_1_00* line_src =
+        reinterpret_cast<const UnicodeChar_1_00*>(line.text.data());
+    std::size_t line_begin_index = layout.line_text_.size();
+
+    // A line that starts with its own color code does not need a copy.
+    if (color_code != -1
+        && (line.text.length() < kColorCodeLength
+            || line_src[0].ch != kColorCodeLead)) {
+      const UnicodeChar_1_00* color_code_src =
+          reinterpret_cast<const UnicodeChar_1_00*>(&src[color_code]);
+
+      layout.line_text_.insert(
+          layout.line_text_.end(),
+          color_code_src,
+          &color_code_src[kColorCodeLength]
+      );
+    }
+
+    layout.line_text_.insert(
+        layout.line_text_.end(),
+        line_src,
+        &line_src[line.text.length()]
+    );
+    layout.line_text_.push_back(UnicodeChar_1_00());
+
+    line.text = UnicodeStringView_Api(
+        reinterpret_cast<const UnicodeChar*>(
+            &layout.line_text_[line_begin_index]
+        ),
+        static_cast<int>(layout.line_text_.size() - 1 - line_begin_index)
+    );
+  }
+}
+
+} // namespace d2
@@ -0,0 +1,103 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "../../../include/cxx/helper/d2_unicode_string_routine.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+#include <mdc/error/exit_on_error.hpp>
+#include <mdc/wchar_t/filew.h>
+
+namespace d2 {
+namespace {
+
+using RoutineTable = ::std::array<
+    ::std::atomic<UnicodeStringRoutine>,
+    static_cast<::std::size_t>(UnicodeStringOperation::kCount)
+>;
+
+static RoutineTable& GetRoutineTable() {
+  // Atomics are value-initialized, so every operation starts as kGame.
+  static RoutineTable routine_table;
+
+  return routine_table;
+}
+
+static ::std::atomic<UnicodeStringRoutine>& GetRoutineEntry(
+    UnicodeStringOperation operation
+) {
+  ::std::size_t index = static_cast<::std::size_t>(operation);
+
+  if (index >= static_cast<::std::size_t>(UnicodeStringOperation::kCount)) {
+    ::mdc::error::ExitOnGeneralError(
+        L"Error",
+        L"Invalid value for UnicodeStringOperation: %d.",
+        __FILEW__,
+        __LINE__,
+        static_cast<int>(operation)
+    );
+  }
+
+  return GetRoutineTable()[index];
+}
+
+} // namespace
+
+UnicodeStringRoutine GetUnicodeStringRoutine(
+    UnicodeStringOperation operation
+) {
+  return GetRoutineEntry(operation).load(::std::memory_order_relaxed);
+}
+
+void SetUnicodeStringRoutine(
+    UnicodeStringOperation operation,
+    UnicodeStringRoutine routine
+) {
+  GetRoutineEntry(operation).store(routine, ::std::memory_order_relaxed);
+}
+
+} // namespace d2
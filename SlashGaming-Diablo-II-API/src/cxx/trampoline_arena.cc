@@ -0,0 +1,449 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "../../include/cxx/trampoline_arena.hpp"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "backend/x86_instruction_decoder.hpp"
+
+namespace mapi {
+namespace {
+
+static constexpr std::uintptr_t kRel32Reach = 0x7FFFFFFF;
+
+/**
+ * Returns whether every byte in the range can be reached from the target
+ * address, and can reach it, with a rel32 branch.
+ */
+static bool IsWithinRel32Reach(
+    std::intptr_t address,
+    std::size_t size,
+    std::intptr_t target_address
+) noexcept {
+  std::uintptr_t begin = static_cast<std::uintptr_t>(address);
+  std::uintptr_t end = begin + size;
+  std::uintptr_t target = static_cast<std::uintptr_t>(target_address);
+
+  // On x86-32, the branch displacement is added modulo 2^32, so a rel32
+  // branch reaches the entire address space. Comparing the addresses as
+  // signed values would put pages at or above 2 GB, which large address
+  // aware processes use, out of reach of the game's modules.
+  if constexpr (sizeof(std::uintptr_t) == sizeof(std::uint32_t)) {
+    return true;
+  }
+
+  std::uintptr_t begin_distance = (begin > target)
+      ? begin - target
+      : target - begin;
+  std::uintptr_t end_distance = (end > target)
+      ? end - target
+      : target - end;
+
+  return begin_distance <= kRel32Reach && end_distance <= kRel32Reach;
+}
+
+static constexpr std::size_t AlignUp(
+    std::size_t value,
+    std::size_t alignment
+) noexcept {
+  return (value + (alignment - 1)) & ~(alignment - 1);
+}
+
+#if defined(_WIN32)
+
+class ProcessPageProvider : public TrampolinePageProvider {
+ public:
+  ProcessPageProvider()
+      : page_size_(LoadAllocationGranularity()) {
+  }
+
+  std::intptr_t AllocatePage(std::intptr_t near_address) override {
+    std::intptr_t page_address = this->AllocatePageAt(0);
+
+    if (page_address == 0
+        || IsWithinRel32Reach(page_address, this->page_size(), near_address)) {
+      return page_address;
+    }
+
+    this->FreePage(page_address);
+
+    // Search downward from the target for a free region within reach.
+    std::intptr_t page_mask = ~static_cast<std::intptr_t>(
+        this->page_size() - 1
+    );
+
+    for (std::intptr_t candidate = near_address & page_mask;
+        candidate > 0
+            && IsWithinRel32Reach(candidate, this->page_size(), near_address);
+        candidate -= this->page_size()) {
+      MEMORY_BASIC_INFORMATION memory_info;
+
+      SIZE_T query_size = VirtualQuery(
+          reinterpret_cast<void*>(candidate),
+          &memory_info,
+          sizeof(memory_info)
+      );
+
+      if (query_size == 0) {
+        break;
+      }
+
+      if (memory_info.State != MEM_FREE) {
+        continue;
+      }
+
+      page_address = this->AllocatePageAt(candidate);
+
+      if (page_address != 0) {
+        return page_address;
+      }
+    }
+
+    return 0;
+  }
+
+  void FreePage(std::intptr_t page_address) override {
+    VirtualFree(reinterpret_cast<void*>(page_address), 0, MEM_RELEASE);
+  }
+
+  void FlushInstructionCache(
+      std::intptr_t address,
+      std::size_t size
+  ) override {
+    ::FlushInstructionCache(
+        GetCurrentProcess(),
+        reinterpret_cast<void*>(address),
+        size
+    );
+  }
+
+  std::size_t page_size() const override {
+    return this->page_size_;
+  }
+
+ private:
+  std::size_t page_size_;
+
+  std::intptr_t AllocatePageAt(std::intptr_t address) {
+    void* page = VirtualAlloc(
+        reinterpret_cast<void*>(address),
+        this->page_size(),
+        MEM_COMMIT | MEM_RESERVE,
+        PAGE_EXECUTE_READWRITE
+    );
+
+    return reinterpret_cast<std::intptr_t>(page);
+  }
+
+  /**
+   * VirtualAlloc reserves address space in units of the allocation
+   * granularity, so smaller pages would leave unusable gaps.
+   */
+  static std::size_t LoadAllocationGranularity() {
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+
+    return system_info.dwAllocationGranularity;
+  }
+};
+
+#else
+
+class ProcessPageProvider : public TrampolinePageProvider {
+ public:
+  ProcessPageProvider()
+      : page_size_(sysconf(_SC_PAGESIZE)) {
+  }
+
+  std::intptr_t AllocatePage(std::intptr_t near_address) override {
+    std::intptr_t page_address = this->AllocatePageAt(0);
+
+    if (page_address == 0
+        || IsWithinRel32Reach(page_address, this->page_size(), near_address)) {
+      return page_address;
+    }
+
+    this->FreePage(page_address);
+
+    // Search downward from the target. The address is only a hint, so
+    // the page may be placed elsewhere, and must be checked again.
+    std::intptr_t page_mask = ~static_cast<std::intptr_t>(
+        this->page_size() - 1
+    );
+
+    std::size_t search_step = this->page_size() * 16;
+
+    for (std::intptr_t candidate = near_address & page_mask;
+        candidate > static_cast<std::intptr_t>(search_step)
+            && IsWithinRel32Reach(candidate, this->page_size(), near_address);
+        candidate -= search_step) {
+      page_address = this->AllocatePageAt(candidate);
+
+      if (page_address == 0) {
+        return 0;
+      }
+
+      if (IsWithinRel32Reach(page_address, this->page_size(), near_address)) {
+        return page_address;
+      }
+
+      this->FreePage(page_address);
+    }
+
+    return 0;
+  }
+
+  void FreePage(std::intptr_t page_address) override {
+    munmap(reinterpret_cast<void*>(page_address), this->page_size());
+  }
+
+  void FlushInstructionCache(
+      std::intptr_t address,
+      std::size_t size
+  ) override {
+    char* begin = reinterpret_cast<char*>(address);
+
+    __builtin___clear_cache(begin, begin + size);
+  }
+
+  std::size_t page_size() const override {
+    return this->page_size_;
+  }
+
+ private:
+  std::size_t page_size_;
+
+  /**
+   * Maps a writable page, then makes it executable. Systems that enforce
+   * W^X refuse the second step, in which case no page is returned.
+   */
+  std::intptr_t AllocatePageAt(std::intptr_t address) {
+    void* page = mmap(
+        reinterpret_cast<void*>(address),
+        this->page_size(),
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS,
+        -1,
+        0
+    );
+
+    if (page == MAP_FAILED) {
+      return 0;
+    }
+
+    int protect_result = mprotect(
+        page,
+        this->page_size(),
+        PROT_READ | PROT_WRITE | PROT_EXEC
+    );
+
+    if (protect_result != 0) {
+      munmap(page, this->page_size());
+      return 0;
+    }
+
+    return reinterpret_cast<std::intptr_t>(page);
+  }
+};
+
+#endif
+
+} // namespace
+
+TrampolinePageProvider::~TrampolinePageProvider() = default;
+
+TrampolinePageProvider& TrampolinePageProvider::GetProcessPageProvider() {
+  static ProcessPageProvider process_page_provider;
+
+  return process_page_provider;
+}
+
+TrampolineArena::TrampolineArena(std::intptr_t target_address)
+    : TrampolineArena(
+          target_address,
+          TrampolinePageProvider::GetProcessPageProvider()
+      ) {
+}
+
+TrampolineArena::TrampolineArena(
+    std::intptr_t target_address,
+    TrampolinePageProvider& page_provider
+) : page_provider_(&page_provider),
+    target_address_(target_address),
+    pages_(),
+    current_page_offset_(0) {
+}
+
+TrampolineArena::TrampolineArena(TrampolineArena&& arena) noexcept
+    : page_provider_(arena.page_provider_),
+      target_address_(arena.target_address_),
+      pages_(std::move(arena.pages_)),
+      current_page_offset_(std::exchange(arena.current_page_offset_, 0)) {
+  arena.pages_.clear();
+}
+
+TrampolineArena::~TrampolineArena() {
+  this->Clear();
+}
+
+TrampolineArena& TrampolineArena::operator=(
+    TrampolineArena&& arena
+) noexcept {
+  if (this == &arena) {
+    return *this;
+  }
+
+  this->Clear();
+
+  this->page_provider_ = arena.page_provider_;
+  this->target_address_ = arena.target_address_;
+  this->pages_ = std::move(arena.pages_);
+  this->current_page_offset_ = std::exchange(arena.current_page_offset_, 0);
+
+  arena.pages_.clear();
+
+  return *this;
+}
+
+std::intptr_t TrampolineArena::Allocate(std::size_t size) {
+  std::size_t page_size = this->page_provider_->page_size();
+  std::size_t aligned_size = AlignUp(size, kStubAlignment);
+
+  if (size == 0 || aligned_size > page_size) {
+    return 0;
+  }
+
+  if (this->pages_.empty()
+      || this->current_page_offset_ + aligned_size > page_size) {
+    std::intptr_t page_address =
+        this->page_provider_->AllocatePage(this->target_address_);
+
+    if (page_address == 0) {
+      return 0;
+    }
+
+    if (!IsWithinRel32Reach(page_address, page_size, this->target_address_)) {
+      this->page_provider_->FreePage(page_address);
+
+      return 0;
+    }
+
+    this->pages_.push_back(page_address);
+    this->current_page_offset_ = 0;
+  }
+
+  std::intptr_t stub_address = this->pages_.back()
+      + this->current_page_offset_;
+
+  this->current_page_offset_ += aligned_size;
+
+  return stub_address;
+}
+
+std::intptr_t TrampolineArena::MakeTrampoline(
+    const GameAddress& game_address,
+    std::size_t patch_size
+) {
+  // Widening a short branch at most triples its size, and the trampoline
+  // ends with a rel32 jump back.
+  std::size_t max_trampoline_size = (patch_size * 3) + 5;
+
+  std::intptr_t trampoline_address = this->Allocate(max_trampoline_size);
+
+  if (trampoline_address == 0) {
+    return 0;
+  }
+
+  std::size_t trampoline_size = BuildX86Trampoline(
+      reinterpret_cast<const std::uint8_t*>(game_address.raw_address()),
+      game_address.raw_address(),
+      patch_size,
+      reinterpret_cast<std::uint8_t*>(trampoline_address),
+      trampoline_address,
+      max_trampoline_size
+  );
+
+  // Return the unused tail of the stub, or the entire stub on failure, so
+  // that the next stub is packed right after this one.
+  this->current_page_offset_ -= AlignUp(max_trampoline_size, kStubAlignment);
+  this->current_page_offset_ += AlignUp(trampoline_size, kStubAlignment);
+
+  if (trampoline_size == 0) {
+    return 0;
+  }
+
+  this->page_provider_->FlushInstructionCache(
+      trampoline_address,
+      trampoline_size
+  );
+
+  return trampoline_address;
+}
+
+void TrampolineArena::Clear() {
+  for (std::intptr_t page_address : this->pages_) {
+    this->page_provider_->FreePage(page_address);
+  }
+
+  this->pages_.clear();
+  this->current_page_offset_ = 0;
+}
+
+std::size_t TrampolineArena::page_count() const noexcept {
+  return this->pages_.size();
+}
+
+} // namespace mapi
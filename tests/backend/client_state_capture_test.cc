@@ -0,0 +1,213 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Captures the client state from a fake memory image, as the game
+ * stores it for each game version.
+ */
+
+#include <cstdint>
+
+#include "../../SlashGaming-Diablo-II-API/src/cxx/backend/client_state_capture.hpp"
+#include "../support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::d2::GameVersion;
+using ::d2::d2client::ClientStateSnapshot;
+using ::mapi::ClientStateAddresses;
+
+struct FakeClientState {
+  ::d2::ScreenOpenMode_1_07 screen_open_mode;
+  ::d2::DifficultyLevel_1_00 difficulty_level;
+  std::int32_t game_type;
+
+  std::int32_t general_display_width;
+  std::int32_t general_display_height;
+  std::int32_t general_play_area_camera_shift_x;
+  std::int32_t screen_shift_x;
+  std::int32_t screen_shift_y;
+  std::int32_t ingame_mouse_position_x;
+  std::int32_t ingame_mouse_position_y;
+  std::uint32_t inventory_arrange_mode;
+
+  mapi::bool32 is_automap_open;
+  mapi::bool32 is_game_menu_open;
+  mapi::bool32 is_help_screen_open;
+  mapi::bool32 is_new_skill_button_pressed;
+  mapi::bool32 is_new_stats_button_pressed;
+};
+
+static ClientStateAddresses GetAddresses(const FakeClientState& state) {
+  ClientStateAddresses addresses;
+  addresses.screen_open_mode = &state.screen_open_mode;
+  addresses.difficulty_level = &state.difficulty_level;
+  addresses.game_type = &state.game_type;
+
+  addresses.general_display_width = &state.general_display_width;
+  addresses.general_display_height = &state.general_display_height;
+  addresses.general_play_area_camera_shift_x =
+      &state.general_play_area_camera_shift_x;
+  addresses.screen_shift_x = &state.screen_shift_x;
+  addresses.screen_shift_y = &state.screen_shift_y;
+  addresses.ingame_mouse_position_x = &state.ingame_mouse_position_x;
+  addresses.ingame_mouse_position_y = &state.ingame_mouse_position_y;
+  addresses.inventory_arrange_mode = &state.inventory_arrange_mode;
+
+  addresses.is_automap_open = &state.is_automap_open;
+  addresses.is_game_menu_open = &state.is_game_menu_open;
+  addresses.is_help_screen_open = &state.is_help_screen_open;
+  addresses.is_new_skill_button_pressed = &state.is_new_skill_button_pressed;
+  addresses.is_new_stats_button_pressed = &state.is_new_stats_button_pressed;
+
+  return addresses;
+}
+
+static FakeClientState MakeFakeClientState() {
+  FakeClientState state = {};
+  state.screen_open_mode = ::d2::ScreenOpenMode_1_07::kLeft;
+  state.difficulty_level = ::d2::DifficultyLevel_1_00::kHell;
+  state.general_display_width = 800;
+  state.general_display_height = 600;
+  state.general_play_area_camera_shift_x = -16;
+  state.screen_shift_x = 160;
+  state.screen_shift_y = -40;
+  state.ingame_mouse_position_x = 412;
+  state.ingame_mouse_position_y = 255;
+  state.inventory_arrange_mode = 1;
+  state.is_automap_open = 1;
+  state.is_help_screen_open = 1;
+  state.is_new_stats_button_pressed = 1;
+
+  return state;
+}
+
+static void TestCaptureAll() {
+  FakeClientState state = MakeFakeClientState();
+  state.game_type =
+      static_cast<std::int32_t>(::d2::ClientGameType_1_07::kLanJoin);
+
+  ClientStateSnapshot snapshot = ::mapi::CaptureClientState(
+      GetAddresses(state),
+      GameVersion::k1_13C
+  );
+
+  CHECK(snapshot.screen_open_mode == ::d2::ScreenOpenMode::kLeft);
+  CHECK(snapshot.difficulty_level == ::d2::DifficultyLevel::kHell);
+  CHECK(snapshot.game_type == ::d2::ClientGameType::kLanJoin);
+  CHECK_EQ(800, snapshot.general_display_width);
+  CHECK_EQ(600, snapshot.general_display_height);
+  CHECK_EQ(-16, snapshot.general_play_area_camera_shift_x);
+  CHECK_EQ(160, snapshot.screen_shift_x);
+  CHECK_EQ(-40, snapshot.screen_shift_y);
+  CHECK_EQ(412, snapshot.ingame_mouse_position_x);
+  CHECK_EQ(255, snapshot.ingame_mouse_position_y);
+  CHECK_EQ(1u, snapshot.inventory_arrange_mode);
+  CHECK(snapshot.is_automap_open);
+  CHECK(!snapshot.is_game_menu_open);
+  CHECK(snapshot.is_help_screen_open);
+  CHECK(!snapshot.is_new_skill_button_pressed);
+  CHECK(snapshot.is_new_stats_button_pressed);
+}
+
+static void TestGameTypeByVersion() {
+  FakeClientState state = MakeFakeClientState();
+  state.game_type = static_cast<std::int32_t>(
+      ::d2::ClientGameType_1_00::kOpenBattleNetJoinOrLanJoin
+  );
+
+  ClientStateSnapshot snapshot = ::mapi::CaptureClientState(
+      GetAddresses(state),
+      GameVersion::k1_06B
+  );
+
+  CHECK(snapshot.game_type
+      == ::d2::ClientGameType::kOpenBattleNetJoinOrLanJoin);
+
+  // The same game value means something else from 1.07 on.
+  snapshot = ::mapi::CaptureClientState(
+      GetAddresses(state),
+      GameVersion::k1_07Beta
+  );
+
+  CHECK(snapshot.game_type == ::d2::ClientGameType::kOpenBattleNetJoin);
+}
+
+static void TestMissingVariables() {
+  FakeClientState state = MakeFakeClientState();
+
+  ClientStateAddresses addresses = GetAddresses(state);
+  addresses.screen_open_mode = nullptr;
+  addresses.screen_shift_x = nullptr;
+  addresses.is_automap_open = nullptr;
+
+  ClientStateSnapshot snapshot = ::mapi::CaptureClientState(
+      addresses,
+      GameVersion::k1_13C
+  );
+
+  CHECK(snapshot.screen_open_mode == ::d2::ScreenOpenMode());
+  CHECK_EQ(0, snapshot.screen_shift_x);
+  CHECK(!snapshot.is_automap_open);
+
+  CHECK_EQ(-40, snapshot.screen_shift_y);
+  CHECK(snapshot.is_help_screen_open);
+
+  ClientStateAddresses no_addresses = {};
+  snapshot = ::mapi::CaptureClientState(no_addresses, GameVersion::k1_13C);
+
+  CHECK_EQ(0, snapshot.general_display_width);
+  CHECK(snapshot.difficulty_level == ::d2::DifficultyLevel());
+}
+
+} // namespace
+
+int main() {
+  TestCaptureAll();
+  TestGameTypeByVersion();
+  TestMissingVariables();
+
+  return ::sgd2mapi_test::GetExitCode();
+}
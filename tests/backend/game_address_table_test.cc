@@ -0,0 +1,140 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include <cstddef>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+#include "../../SlashGaming-Diablo-II-API/src/cxx/backend/game_address_table/game_address_table_impl.hpp"
+#include "../support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::d2::DefaultLibrary;
+using ::d2::GameVersion;
+using ::mapi::GameAddressTable;
+using ::mapi::GameAddressTableEntry;
+using ::mapi::GameAddressTableEntryCompareKey;
+
+static const GameAddressTableEntry* FindByEqualRange(
+    const GameAddressTable& table,
+    DefaultLibrary library,
+    std::string_view address_name
+) {
+  const GameAddressTableEntry* begin = table.entries();
+  const GameAddressTableEntry* end = begin + table.size();
+
+  auto [first, last] = std::equal_range(
+      begin,
+      end,
+      std::make_tuple(library, address_name),
+      GameAddressTableEntryCompareKey()
+  );
+
+  return (first == last) ? nullptr : first;
+}
+
+static void TestFindMatchesEqualRange(GameVersion game_version) {
+  GameAddressTable table = ::mapi::GetGameAddressTable(game_version);
+
+  CHECK(table.size() > 0);
+
+  for (std::size_t i = 0; i < table.size(); i += 1) {
+    const auto& [library, address_name] = table.entries()[i].first;
+
+    const GameAddressTableEntry* expected =
+        FindByEqualRange(table, library, address_name);
+    const GameAddressTableEntry* actual = table.Find(library, address_name);
+
+    CHECK(expected != nullptr);
+    CHECK_EQ(expected, actual);
+  }
+}
+
+static void TestFindMisses(GameVersion game_version) {
+  GameAddressTable table = ::mapi::GetGameAddressTable(game_version);
+
+  for (std::size_t i = 0; i < table.size(); i += 1) {
+    const auto& [library, address_name] = table.entries()[i].first;
+
+    // A name with one more character is never in the table unless the
+    // lookup by equal_range also finds it.
+    std::string longer_name(address_name);
+    longer_name.push_back('_');
+
+    CHECK_EQ(
+        FindByEqualRange(table, library, longer_name),
+        table.Find(library, longer_name)
+    );
+
+    std::string_view shorter_name =
+        address_name.substr(0, address_name.size() / 2);
+
+    CHECK_EQ(
+        FindByEqualRange(table, library, shorter_name),
+        table.Find(library, shorter_name)
+    );
+  }
+
+  CHECK(table.Find(DefaultLibrary::kD2Client, "") == nullptr);
+  CHECK(table.Find(DefaultLibrary::kD2Client, "NotAnAddress") == nullptr);
+}
+
+} // namespace
+
+int main() {
+  for (int i = static_cast<int>(GameVersion::k1_00);
+      i <= static_cast<int>(GameVersion::kLod1_14D);
+      i += 1) {
+    GameVersion game_version = static_cast<GameVersion>(i);
+
+    TestFindMatchesEqualRange(game_version);
+    TestFindMisses(game_version);
+  }
+
+  return ::sgd2mapi_test::GetExitCode();
+}
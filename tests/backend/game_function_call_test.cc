@@ -0,0 +1,189 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Calls stand-in game functions through each calling-convention thunk.
+ * Only built for x86-32, where the conventions exist.
+ */
+
+#include <cstdint>
+
+#include "../../SlashGaming-Diablo-II-API/src/cxx/backend/game_function/esi_function.hpp"
+#include "../../SlashGaming-Diablo-II-API/src/cxx/backend/game_function/fastcall_function.hpp"
+#include "../../SlashGaming-Diablo-II-API/src/cxx/backend/game_function/stdcall_function.hpp"
+#include "../../SlashGaming-Diablo-II-API/src/cxx/backend/game_function/thiscall_function.hpp"
+#include "../../SlashGaming-Diablo-II-API/src/asm_x86_macro.h"
+#include "../support/sgd2mapi_test.hpp"
+
+namespace {
+
+struct Point {
+  int x;
+  int y;
+};
+
+static int MAPI_STDCALL StdcallGameFunction(int a, int b, int c) {
+  return (a * 100) + (b * 10) + c;
+}
+
+static int MAPI_FASTCALL FastcallGameFunction(int a, int b, int c, int d) {
+  return (a * 1000) + (b * 100) + (c * 10) + d;
+}
+
+static void MAPI_FASTCALL FastcallNarrowGameFunction(
+    std::uint8_t* out,
+    int value
+) {
+  *out = static_cast<std::uint8_t>(value);
+}
+
+static int __attribute__((thiscall)) ThiscallGameFunction(
+    Point* point,
+    int dx,
+    int dy
+) {
+  return ((point->x + dx) * 100) + (point->y + dy);
+}
+
+} // namespace
+
+// Returns esi + 1. Clobbers esi, as a game function is allowed to, and
+// saves and restores ebx, which the thunk uses for its frame.
+extern "C" MAPI_NAKED void EsiGameFunction() {
+  ASM_X86(push ebx);
+  ASM_X86(lea eax, [esi + 1]);
+  ASM_X86(xor esi, esi);
+  ASM_X86(xor ebx, ebx);
+  ASM_X86(pop ebx);
+  ASM_X86(ret);
+}
+
+namespace {
+
+static void TestStdcall() {
+  int result = ::mapi::CallStdcallFunction<int>(
+      reinterpret_cast<std::intptr_t>(&StdcallGameFunction),
+      1,
+      2,
+      3
+  );
+
+  CHECK_EQ(123, result);
+}
+
+static void TestFastcall() {
+  int result = ::mapi::CallFastcallFunction<int>(
+      reinterpret_cast<std::intptr_t>(&FastcallGameFunction),
+      1,
+      2,
+      3,
+      4
+  );
+
+  CHECK_EQ(1234, result);
+
+  // Narrow arguments are widened to int.
+  std::uint8_t out = 0;
+  ::mapi::CallFastcallFunction<void>(
+      reinterpret_cast<std::intptr_t>(&FastcallNarrowGameFunction),
+      &out,
+      static_cast<std::uint8_t>(0xAB)
+  );
+
+  CHECK_EQ(0xAB, out);
+}
+
+static void TestThiscall() {
+  Point point = { 1, 2 };
+
+  int result = ::mapi::CallThiscallFunction<int>(
+      reinterpret_cast<std::intptr_t>(&ThiscallGameFunction),
+      &point,
+      3,
+      4
+  );
+
+  CHECK_EQ(406, result);
+}
+
+static void TestEsi() {
+  // Keep several values live across the calls, so that a register the
+  // thunk fails to restore corrupts one of them.
+  volatile int seed = 7;
+  int a = seed;
+  int b = seed * 3;
+  int c = seed * 5;
+  int d = seed * 11;
+
+  for (std::intptr_t i = 0; i < 100; i += 1) {
+    std::intptr_t result = ::mapi::CallEsiFunction<std::intptr_t>(
+        reinterpret_cast<std::intptr_t>(&EsiGameFunction),
+        i * 0x1000
+    );
+
+    CHECK_EQ((i * 0x1000) + 1, result);
+
+    a += 1;
+    b += 2;
+    c += 3;
+    d += 4;
+  }
+
+  CHECK_EQ(7 + 100, a);
+  CHECK_EQ(21 + 200, b);
+  CHECK_EQ(35 + 300, c);
+  CHECK_EQ(77 + 400, d);
+}
+
+} // namespace
+
+int main() {
+  TestStdcall();
+  TestFastcall();
+  TestThiscall();
+  TestEsi();
+
+  return ::sgd2mapi_test::GetExitCode();
+}
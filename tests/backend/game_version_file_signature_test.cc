@@ -0,0 +1,219 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Detects game versions from a corpus of synthetic PE images. Each image
+ * has a DOS header whose PE header pointer leads to one of the known
+ * signatures, so every entry in the table is covered without shipping
+ * the game files.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "../../SlashGaming-Diablo-II-API/src/cxx/backend/game_version/game_version_file_signature_table.hpp"
+#include "../support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::d2::intern::file_signature::FilePeSignature;
+using ::d2::intern::file_signature::FileSignatureTableEntry;
+using ::d2::intern::file_signature::FindTableEntry;
+using ::d2::intern::file_signature::kFilePeSignatureSortedTable;
+
+static constexpr std::size_t kPeHeaderPointerOffset =
+    FilePeSignature::kPeHeaderPointerOffset;
+
+static std::vector<std::uint8_t> MakePeImage(
+    const FilePeSignature& signature,
+    std::uint32_t pe_header_pointer,
+    std::size_t trailing_size
+) {
+  std::vector<std::uint8_t> image(
+      pe_header_pointer + FilePeSignature::kSignatureSize + trailing_size,
+      0xCC
+  );
+
+  image[0] = 'M';
+  image[1] = 'Z';
+
+  for (std::size_t i = 0; i < sizeof(pe_header_pointer); i += 1) {
+    image[kPeHeaderPointerOffset + i] =
+        static_cast<std::uint8_t>(pe_header_pointer >> (i * 8));
+  }
+
+  std::copy(
+      signature.signature().cbegin(),
+      signature.signature().cend(),
+      image.begin() + pe_header_pointer
+  );
+
+  return image;
+}
+
+static const FileSignatureTableEntry* FindTableEntryLinear(
+    const FilePeSignature& signature
+) {
+  for (const FileSignatureTableEntry& entry : kFilePeSignatureSortedTable) {
+    if (entry.first == signature) {
+      return &entry;
+    }
+  }
+
+  return nullptr;
+}
+
+static const FileSignatureTableEntry* DetectImage(
+    const std::vector<std::uint8_t>& image
+) {
+  FilePeSignature signature;
+
+  if (!FilePeSignature::ReadBytes(image.data(), image.size(), &signature)) {
+    return nullptr;
+  }
+
+  return FindTableEntry(signature);
+}
+
+static void TestEveryEntryIsDetected() {
+  static constexpr std::uint32_t kPeHeaderPointers[] = {
+      0x40, 0x41, 0x80, 0xD8, 0xF0, 0x100, 0x1000
+  };
+
+  for (const FileSignatureTableEntry& entry : kFilePeSignatureSortedTable) {
+    for (std::uint32_t pe_header_pointer : kPeHeaderPointers) {
+      // The signature may end the image, or be followed by more bytes.
+      for (std::size_t trailing_size : { 0, 1, 512 }) {
+        std::vector<std::uint8_t> image =
+            MakePeImage(entry.first, pe_header_pointer, trailing_size);
+
+        const FileSignatureTableEntry* detected_entry = DetectImage(image);
+
+        CHECK_EQ(&entry, detected_entry);
+      }
+    }
+  }
+}
+
+static void TestMutatedSignaturesAreRejected() {
+  for (const FileSignatureTableEntry& entry : kFilePeSignatureSortedTable) {
+    for (std::size_t i = 0; i < FilePeSignature::kSignatureCount; i += 1) {
+      for (unsigned int bit = 0; bit < 8; bit += 1) {
+        FilePeSignature::SignatureType bytes = entry.first.signature();
+        bytes[i] ^= static_cast<std::uint8_t>(1 << bit);
+
+        FilePeSignature mutated_signature(bytes);
+
+        CHECK_EQ(
+            FindTableEntryLinear(mutated_signature),
+            FindTableEntry(mutated_signature)
+        );
+      }
+    }
+  }
+}
+
+static void TestTruncatedImagesAreRejected() {
+  const FilePeSignature& signature = kFilePeSignatureSortedTable[0].first;
+
+  std::vector<std::uint8_t> image = MakePeImage(signature, 0x80, 0);
+
+  // Every prefix of the image is missing part of the signature.
+  for (std::size_t size = 0; size < image.size(); size += 1) {
+    FilePeSignature read_signature;
+    CHECK(!FilePeSignature::ReadBytes(image.data(), size, &read_signature));
+  }
+
+  // PE header pointers past the end of the image, including one whose
+  // end would overflow.
+  for (std::uint32_t pe_header_pointer : { 0x81u, 0xFFFFu, 0xFFFFFFFFu }) {
+    for (std::size_t i = 0; i < sizeof(pe_header_pointer); i += 1) {
+      image[kPeHeaderPointerOffset + i] =
+          static_cast<std::uint8_t>(pe_header_pointer >> (i * 8));
+    }
+
+    CHECK(DetectImage(image) == nullptr);
+  }
+}
+
+static void TestRandomImagesAreRejected() {
+  std::mt19937 random(0x0E5E);
+
+  for (std::size_t i = 0; i < 20000; i += 1) {
+    FilePeSignature::SignatureType bytes;
+    for (std::uint8_t& byte : bytes) {
+      byte = static_cast<std::uint8_t>(random());
+    }
+
+    // Keep the fixed fields of a real signature, so that the fingerprint
+    // is the only thing that tells the images apart.
+    if (i % 2 == 0) {
+      std::copy_n(
+          kFilePeSignatureSortedTable[i % kFilePeSignatureSortedTable.size()]
+              .first.signature().cbegin(),
+          8,
+          bytes.begin()
+      );
+    }
+
+    FilePeSignature signature(bytes);
+
+    CHECK_EQ(FindTableEntryLinear(signature), FindTableEntry(signature));
+  }
+}
+
+} // namespace
+
+int main() {
+  TestEveryEntryIsDetected();
+  TestMutatedSignaturesAreRejected();
+  TestTruncatedImagesAreRejected();
+  TestRandomImagesAreRejected();
+
+  return ::sgd2mapi_test::GetExitCode();
+}
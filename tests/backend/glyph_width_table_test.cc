@@ -0,0 +1,211 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Measures text with a glyph width table and a counting query, and
+ * checks which text the table accepts.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+#include <utility>
+
+#include "../../SlashGaming-Diablo-II-API/src/cxx/backend/glyph_width_table.hpp"
+#include "../support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::mapi::GlyphWidthTable;
+
+/**
+ * Returns the code unit's value modulo 7, plus 3, and counts the code
+ * units it is asked about.
+ */
+class CountingQuery {
+ public:
+  int operator()(std::uint16_t ch) {
+    this->query_count += 1;
+    this->last_ch = ch;
+
+    return (ch % 7) + 3;
+  }
+
+  int query_count = 0;
+  std::uint16_t last_ch = 0;
+};
+
+static int ExpectedWidth(std::u16string_view text) {
+  int width = 0;
+
+  for (char16_t ch : text) {
+    width += (ch % 7) + 3;
+  }
+
+  return width;
+}
+
+static int Measure(
+    GlyphWidthTable& table,
+    std::u16string_view text,
+    CountingQuery& query
+) {
+  return table.Measure(
+      reinterpret_cast<const std::uint16_t*>(text.data()),
+      text.length(),
+      query
+  );
+}
+
+static bool IsMeasurable(std::u16string_view text) {
+  return GlyphWidthTable::IsMeasurable(
+      reinterpret_cast<const std::uint16_t*>(text.data()),
+      text.length()
+  );
+}
+
+static void TestEachGlyphIsQueriedOnce() {
+  GlyphWidthTable table;
+  CountingQuery query;
+
+  // Four distinct code units.
+  CHECK_EQ(ExpectedWidth(u"abba cab"), Measure(table, u"abba cab", query));
+  CHECK_EQ(4, query.query_count);
+
+  // Every glyph is known, so nothing is queried.
+  CHECK_EQ(ExpectedWidth(u"cab"), Measure(table, u"cab", query));
+  CHECK_EQ(4, query.query_count);
+
+  // Only the new glyph is queried.
+  CHECK_EQ(ExpectedWidth(u"abcd"), Measure(table, u"abcd", query));
+  CHECK_EQ(5, query.query_count);
+  CHECK_EQ(u'd', query.last_ch);
+
+  CHECK_EQ(0, Measure(table, u"", query));
+}
+
+static void TestGlyphsOnEveryPage() {
+  GlyphWidthTable table;
+  CountingQuery query;
+
+  // The first and last code units of the range, and two on one page.
+  static constexpr char16_t kText[] = {
+      0x0000, 0xFFFF, 0x4E00, 0x4E01, 0x4E00, 0xFFFF
+  };
+  std::u16string_view text(kText, std::size(kText));
+
+  CHECK_EQ(ExpectedWidth(text), Measure(table, text, query));
+  CHECK_EQ(4, query.query_count);
+
+  CHECK_EQ(ExpectedWidth(text), Measure(table, text, query));
+  CHECK_EQ(4, query.query_count);
+}
+
+static void TestClearForgetsWidths() {
+  GlyphWidthTable table;
+  CountingQuery query;
+
+  Measure(table, u"ab", query);
+  CHECK_EQ(2, query.query_count);
+
+  table.Clear();
+
+  // A query that now answers differently is asked again.
+  int wide_query_count = 0;
+  int width = table.Measure(
+      reinterpret_cast<const std::uint16_t*>(u"ab"),
+      2,
+      [&wide_query_count](std::uint16_t ch) {
+        wide_query_count += 1;
+        return 20;
+      }
+  );
+
+  CHECK_EQ(40, width);
+  CHECK_EQ(2, wide_query_count);
+}
+
+static void TestMovedTableKeepsWidths() {
+  GlyphWidthTable table;
+  CountingQuery query;
+
+  Measure(table, u"ab", query);
+
+  GlyphWidthTable moved_table(std::move(table));
+  CHECK_EQ(ExpectedWidth(u"ab"), Measure(moved_table, u"ab", query));
+  CHECK_EQ(2, query.query_count);
+}
+
+static void TestColorCodesAndLineBreaksAreNotMeasurable() {
+  CHECK(IsMeasurable(u""));
+  CHECK(IsMeasurable(u"plain text"));
+  CHECK(IsMeasurable(u"þc1 ok"));
+
+  CHECK(!IsMeasurable(u"ÿc1red"));
+  CHECK(!IsMeasurable(u"red ÿc1"));
+  CHECK(!IsMeasurable(u"ÿ"));
+  CHECK(!IsMeasurable(u"two\nlines"));
+  CHECK(!IsMeasurable(u"\n"));
+
+  // Only the given length is checked.
+  std::u16string_view text = u"ab\ncd";
+  CHECK(GlyphWidthTable::IsMeasurable(
+      reinterpret_cast<const std::uint16_t*>(text.data()),
+      2
+  ));
+}
+
+} // namespace
+
+int main() {
+  TestEachGlyphIsQueriedOnce();
+  TestGlyphsOnEveryPage();
+  TestClearForgetsWidths();
+  TestMovedTableKeepsWidths();
+  TestColorCodesAndLineBreaksAreNotMeasurable();
+
+  return ::sgd2mapi_test::GetExitCode();
+}
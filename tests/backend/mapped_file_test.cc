@@ -0,0 +1,130 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+
+#include "../../SlashGaming-Diablo-II-API/src/cxx/backend/file/mapped_file.hpp"
+#include "../support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::mapi::MappedFile;
+
+static std::wstring WriteTempFile(const char* name, std::size_t size) {
+  std::string path = std::string("sgd2mapi_") + name + ".tmp";
+
+  std::FILE* file = std::fopen(path.c_str(), "wb");
+  for (std::size_t i = 0; i < size; i += 1) {
+    std::fputc(static_cast<int>(i & 0xFF), file);
+  }
+  std::fclose(file);
+
+  return std::wstring(path.begin(), path.end());
+}
+
+static void TestMapAndRead() {
+  std::wstring path = WriteTempFile("map_and_read", 5000);
+
+  MappedFile file(path.c_str());
+
+  CHECK(file.is_open());
+  CHECK_EQ(5000u, file.size());
+  CHECK_EQ(0x10, file.data()[0x1010]);
+
+  std::uint8_t bytes[4] = {};
+  CHECK(file.Read(4996, bytes, 4));
+  CHECK_EQ(4996 & 0xFF, bytes[0]);
+  CHECK_EQ(4999 & 0xFF, bytes[3]);
+
+  // Ranges that end past the file, including ones whose end overflows.
+  CHECK(!file.Read(4997, bytes, 4));
+  CHECK(!file.Read(5001, bytes, 0));
+  CHECK(!file.Read(1, bytes, static_cast<std::size_t>(-1)));
+  CHECK(file.Read(5000, bytes, 0));
+}
+
+static void TestMissingAndEmptyFiles() {
+  MappedFile missing_file(L"sgd2mapi_does_not_exist.tmp");
+  CHECK(!missing_file.is_open());
+  CHECK_EQ(0u, missing_file.size());
+
+  std::wstring path = WriteTempFile("empty", 0);
+  MappedFile empty_file(path.c_str());
+  CHECK(!empty_file.is_open());
+
+  std::uint8_t byte;
+  CHECK(!empty_file.Read(0, &byte, 1));
+}
+
+static void TestMove() {
+  std::wstring path = WriteTempFile("move", 64);
+
+  MappedFile file(path.c_str());
+  const std::uint8_t* data = file.data();
+
+  MappedFile moved_file(std::move(file));
+  CHECK(!file.is_open());
+  CHECK_EQ(data, moved_file.data());
+
+  MappedFile assigned_file;
+  assigned_file = std::move(moved_file);
+  CHECK(!moved_file.is_open());
+  CHECK_EQ(data, assigned_file.data());
+  CHECK_EQ(64u, assigned_file.size());
+}
+
+} // namespace
+
+int main() {
+  TestMapAndRead();
+  TestMissingAndEmptyFiles();
+  TestMove();
+
+  return ::sgd2mapi_test::GetExitCode();
+}
@@ -0,0 +1,415 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Reads the export tables of synthetic PE images, laid out both as a
+ * loaded module and as a file, and checks that malformed images are
+ * rejected instead of read out of bounds. A lookup that returns 0 sends
+ * GameAddress to the GetProcAddress fallback, so the tests also check
+ * that forwarded exports and invalid images return 0.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include "../../SlashGaming-Diablo-II-API/src/cxx/backend/file/pe_image.hpp"
+#include "../support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::mapi::PeImage;
+
+static constexpr std::size_t kNewHeaderOffset = 0x80;
+static constexpr std::size_t kFileHeaderOffset = kNewHeaderOffset + 4;
+static constexpr std::size_t kOptionalHeaderOffset = kFileHeaderOffset + 20;
+static constexpr std::size_t kOptionalHeaderSize = 0xE0;
+static constexpr std::size_t kSectionHeaderOffset =
+    kOptionalHeaderOffset + kOptionalHeaderSize;
+
+// The only section holds the export data. In the file layout, its raw
+// data starts at kSectionRawOffset.
+static constexpr std::uint32_t kSectionRva = 0x1000;
+static constexpr std::uint32_t kSectionRawOffset = 0x200;
+static constexpr std::uint32_t kSectionRawSize = 0x100;
+static constexpr std::uint32_t kSizeOfImage = 0x2000;
+
+// The export directory and the tables it points to.
+static constexpr std::uint32_t kExportDirectoryRva = 0x1000;
+static constexpr std::uint32_t kExportDirectorySize = 0x60;
+static constexpr std::uint32_t kFunctionsRva = 0x1028;
+static constexpr std::uint32_t kNamesRva = 0x1034;
+static constexpr std::uint32_t kNameOrdinalsRva = 0x103C;
+static constexpr std::uint32_t kAlphaNameRva = 0x1040;
+static constexpr std::uint32_t kForwardedNameRva = 0x1046;
+static constexpr std::uint32_t kForwarderRva = 0x1050;
+
+// The end of the last byte that the parser reads: the terminator of
+// "Forwarded".
+static constexpr std::uint32_t kParsedEndRva = kForwarderRva;
+
+static constexpr std::uint32_t kOrdinalBase = 5;
+static constexpr std::uint32_t kAlphaRva = 0x1500;
+static constexpr std::uint32_t kUnnamedRva = 0x1600;
+
+/**
+ * A PE32 image with one section and three exports: "Alpha" at ordinal 5,
+ * "Forwarded" at ordinal 6, which forwards to another library, and an
+ * unnamed export at ordinal 7.
+ */
+class SyntheticPeImage {
+ public:
+  explicit SyntheticPeImage(PeImage::Layout layout)
+      : layout_(layout),
+        bytes_(
+            (layout == PeImage::Layout::kMapped)
+                ? kSizeOfImage
+                : kSectionRawOffset + kSectionRawSize,
+            0
+        ) {
+    this->bytes_[0] = 'M';
+    this->bytes_[1] = 'Z';
+    this->Write32(0x3C, kNewHeaderOffset);
+
+    std::memcpy(&this->bytes_[kNewHeaderOffset], "PE\0\0", 4);
+    this->Write16(kFileHeaderOffset, 0x14C);
+    this->Write16(kFileHeaderOffset + 2, 1);
+    this->Write16(kFileHeaderOffset + 16, kOptionalHeaderSize);
+
+    this->Write16(kOptionalHeaderOffset, 0x10B);
+    this->Write32(kOptionalHeaderOffset + 56, kSizeOfImage);
+    this->Write32(kOptionalHeaderOffset + 92, 16);
+    this->SetExportDirectory(kExportDirectoryRva, kExportDirectorySize);
+
+    std::memcpy(&this->bytes_[kSectionHeaderOffset], ".edata", 6);
+    this->Write32(kSectionHeaderOffset + 8, kSectionRawSize);
+    this->Write32(kSectionHeaderOffset + 12, kSectionRva);
+    this->Write32(kSectionHeaderOffset + 16, kSectionRawSize);
+    this->Write32(kSectionHeaderOffset + 20, kSectionRawOffset);
+
+    this->WriteRva32(kExportDirectoryRva + 16, kOrdinalBase);
+    this->WriteRva32(kExportDirectoryRva + 20, 3);
+    this->WriteRva32(kExportDirectoryRva + 24, 2);
+    this->WriteRva32(kExportDirectoryRva + 28, kFunctionsRva);
+    this->WriteRva32(kExportDirectoryRva + 32, kNamesRva);
+    this->WriteRva32(kExportDirectoryRva + 36, kNameOrdinalsRva);
+
+    this->WriteRva32(kFunctionsRva, kAlphaRva);
+    this->WriteRva32(kFunctionsRva + 4, kForwarderRva);
+    this->WriteRva32(kFunctionsRva + 8, kUnnamedRva);
+
+    this->WriteRva32(kNamesRva, kAlphaNameRva);
+    this->WriteRva32(kNamesRva + 4, kForwardedNameRva);
+    this->WriteRva16(kNameOrdinalsRva, 0);
+    this->WriteRva16(kNameOrdinalsRva + 2, 1);
+
+    this->WriteRvaString(kAlphaNameRva, "Alpha");
+    this->WriteRvaString(kForwardedNameRva, "Forwarded");
+    this->WriteRvaString(kForwarderRva, "OTHER.Function");
+  }
+
+  PeImage Parse() const {
+    return this->Parse(this->bytes_.size());
+  }
+
+  PeImage Parse(std::size_t size) const {
+    return PeImage(this->bytes_.data(), size, this->layout_);
+  }
+
+  std::size_t RvaToOffset(std::uint32_t rva) const noexcept {
+    if (this->layout_ == PeImage::Layout::kMapped) {
+      return rva;
+    }
+
+    return rva - kSectionRva + kSectionRawOffset;
+  }
+
+  void SetExportDirectory(std::uint32_t rva, std::uint32_t size) {
+    this->Write32(kOptionalHeaderOffset + 96, rva);
+    this->Write32(kOptionalHeaderOffset + 100, size);
+  }
+
+  void Write16(std::size_t offset, std::uint16_t value) {
+    for (std::size_t i = 0; i < sizeof(value); i += 1) {
+      this->bytes_[offset + i] = static_cast<std::uint8_t>(value >> (i * 8));
+    }
+  }
+
+  void Write32(std::size_t offset, std::uint32_t value) {
+    for (std::size_t i = 0; i < sizeof(value); i += 1) {
+      this->bytes_[offset + i] = static_cast<std::uint8_t>(value >> (i * 8));
+    }
+  }
+
+  void WriteRva16(std::uint32_t rva, std::uint16_t value) {
+    this->Write16(this->RvaToOffset(rva), value);
+  }
+
+  void WriteRva32(std::uint32_t rva, std::uint32_t value) {
+    this->Write32(this->RvaToOffset(rva), value);
+  }
+
+  void WriteRvaString(std::uint32_t rva, std::string_view text) {
+    std::size_t offset = this->RvaToOffset(rva);
+
+    std::memcpy(&this->bytes_[offset], text.data(), text.length());
+    this->bytes_[offset + text.length()] = '\0';
+  }
+
+  const std::vector<std::uint8_t>& bytes() const noexcept {
+    return this->bytes_;
+  }
+
+ private:
+  PeImage::Layout layout_;
+  std::vector<std::uint8_t> bytes_;
+};
+
+static constexpr PeImage::Layout kLayouts[] = {
+    PeImage::Layout::kMapped,
+    PeImage::Layout::kFile
+};
+
+static bool HasEmptyIndex(const PeImage& image) {
+  return image.FindExportByName("Alpha") == 0
+      && image.FindExportByOrdinal(kOrdinalBase) == 0
+      && image.FindExportByOrdinal(kOrdinalBase + 2) == 0;
+}
+
+static void TestNameLookup() {
+  for (PeImage::Layout layout : kLayouts) {
+    SyntheticPeImage synthetic_image(layout);
+    PeImage image = synthetic_image.Parse();
+
+    CHECK(image.is_valid());
+    CHECK_EQ(kAlphaRva, image.FindExportByName("Alpha"));
+
+    // Forwarded exports are left to GetProcAddress.
+    CHECK_EQ(0u, image.FindExportByName("Forwarded"));
+
+    CHECK_EQ(0u, image.FindExportByName("Missing"));
+    CHECK_EQ(0u, image.FindExportByName("Alph"));
+    CHECK_EQ(0u, image.FindExportByName("Alpha2"));
+    CHECK_EQ(0u, image.FindExportByName(""));
+  }
+}
+
+static void TestOrdinalLookup() {
+  for (PeImage::Layout layout : kLayouts) {
+    SyntheticPeImage synthetic_image(layout);
+    PeImage image = synthetic_image.Parse();
+
+    CHECK_EQ(kAlphaRva, image.FindExportByOrdinal(kOrdinalBase));
+    CHECK_EQ(0u, image.FindExportByOrdinal(kOrdinalBase + 1));
+    CHECK_EQ(kUnnamedRva, image.FindExportByOrdinal(kOrdinalBase + 2));
+
+    // Ordinals below the base and past the last export.
+    CHECK_EQ(0u, image.FindExportByOrdinal(0));
+    CHECK_EQ(0u, image.FindExportByOrdinal(kOrdinalBase - 1));
+    CHECK_EQ(0u, image.FindExportByOrdinal(kOrdinalBase + 3));
+    CHECK_EQ(0u, image.FindExportByOrdinal(0xFFFF));
+  }
+}
+
+static void TestLoadedModuleReadsItsOwnSize() {
+  SyntheticPeImage synthetic_image(PeImage::Layout::kMapped);
+
+  PeImage image = PeImage::FromLoadedModule(
+      reinterpret_cast<std::intptr_t>(synthetic_image.bytes().data())
+  );
+
+  CHECK(image.is_valid());
+  CHECK_EQ(kAlphaRva, image.FindExportByName("Alpha"));
+
+  CHECK(!PeImage::FromLoadedModule(0).is_valid());
+}
+
+static void TestImageWithoutExports() {
+  for (PeImage::Layout layout : kLayouts) {
+    SyntheticPeImage synthetic_image(layout);
+    synthetic_image.SetExportDirectory(0, 0);
+
+    PeImage image = synthetic_image.Parse();
+
+    CHECK(image.is_valid());
+    CHECK(HasEmptyIndex(image));
+  }
+
+  PeImage default_image;
+  CHECK(!default_image.is_valid());
+  CHECK(HasEmptyIndex(default_image));
+}
+
+static void TestTruncatedImagesAreRejected() {
+  for (PeImage::Layout layout : kLayouts) {
+    SyntheticPeImage synthetic_image(layout);
+
+    // Every prefix that ends before the last byte that is read.
+    std::size_t parsed_end = synthetic_image.RvaToOffset(kParsedEndRva);
+
+    for (std::size_t size = 0; size < parsed_end; size += 1) {
+      PeImage image = synthetic_image.Parse(size);
+
+      CHECK(!image.is_valid());
+      CHECK(HasEmptyIndex(image));
+    }
+
+    CHECK(synthetic_image.Parse(parsed_end).is_valid());
+  }
+}
+
+static void TestOutOfRangeDirectoriesAreRejected() {
+  for (PeImage::Layout layout : kLayouts) {
+    // Export directory outside the image, and straddling its end.
+    {
+      SyntheticPeImage synthetic_image(layout);
+      synthetic_image.SetExportDirectory(0x7FFFFFF0, kExportDirectorySize);
+
+      CHECK(!synthetic_image.Parse().is_valid());
+    }
+
+    {
+      SyntheticPeImage synthetic_image(layout);
+      std::uint32_t image_end_rva = (layout == PeImage::Layout::kMapped)
+          ? kSizeOfImage
+          : kSectionRva + kSectionRawSize;
+
+      synthetic_image.SetExportDirectory(
+          image_end_rva - 8,
+          kExportDirectorySize
+      );
+
+      CHECK(!synthetic_image.Parse().is_valid());
+    }
+
+    // A function count too large for the image.
+    {
+      SyntheticPeImage synthetic_image(layout);
+      synthetic_image.WriteRva32(kExportDirectoryRva + 20, 0x40000000);
+
+      PeImage image = synthetic_image.Parse();
+      CHECK(!image.is_valid());
+      CHECK(HasEmptyIndex(image));
+    }
+
+    // Function, name, and name ordinal tables outside the image.
+    for (std::uint32_t table_offset : { 28u, 32u, 36u }) {
+      SyntheticPeImage synthetic_image(layout);
+      synthetic_image.WriteRva32(
+          kExportDirectoryRva + table_offset,
+          0xFFFFFF00
+      );
+
+      CHECK(!synthetic_image.Parse().is_valid());
+    }
+
+    // A name outside the image.
+    {
+      SyntheticPeImage synthetic_image(layout);
+      synthetic_image.WriteRva32(kNamesRva, 0xFFFFFF00);
+
+      CHECK(!synthetic_image.Parse().is_valid());
+    }
+
+    // A name ordinal past the last function.
+    {
+      SyntheticPeImage synthetic_image(layout);
+      synthetic_image.WriteRva16(kNameOrdinalsRva, 3);
+
+      PeImage image = synthetic_image.Parse();
+      CHECK(!image.is_valid());
+      CHECK(HasEmptyIndex(image));
+    }
+
+    // Section headers past the end of the image.
+    {
+      SyntheticPeImage synthetic_image(layout);
+      synthetic_image.Write16(kFileHeaderOffset + 2, 0xFFFF);
+
+      CHECK(!synthetic_image.Parse().is_valid());
+    }
+
+    // A PE header pointer past the end of the image.
+    for (std::uint32_t new_header_offset : { 0x10000u, 0xFFFFFFFFu }) {
+      SyntheticPeImage synthetic_image(layout);
+      synthetic_image.Write32(0x3C, new_header_offset);
+
+      CHECK(!synthetic_image.Parse().is_valid());
+    }
+
+    // An optional header that is not PE32 or PE32+.
+    {
+      SyntheticPeImage synthetic_image(layout);
+      synthetic_image.Write16(kOptionalHeaderOffset, 0x107);
+
+      CHECK(!synthetic_image.Parse().is_valid());
+    }
+  }
+}
+
+static void TestExportsOutsideSectionsInFileLayout() {
+  // In the file layout, an RVA that no section covers cannot be read,
+  // even if the file is large enough to hold its offset.
+  SyntheticPeImage synthetic_image(PeImage::Layout::kFile);
+  synthetic_image.WriteRva32(kExportDirectoryRva + 28, 0x100);
+
+  CHECK(!synthetic_image.Parse().is_valid());
+}
+
+} // namespace
+
+int main() {
+  TestNameLookup();
+  TestOrdinalLookup();
+  TestLoadedModuleReadsItsOwnSize();
+  TestImageWithoutExports();
+  TestTruncatedImagesAreRejected();
+  TestOutOfRangeDirectoriesAreRejected();
+  TestExportsOutsideSectionsInFileLayout();
+
+  return ::sgd2mapi_test::GetExitCode();
+}
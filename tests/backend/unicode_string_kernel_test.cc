@@ -0,0 +1,379 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Checks the Unicode string kernels against scalar references. The
+ * strncmp reference is the loop that reconstructed the game's 1.00
+ * Unicode_strncmp, and results must match it exactly, not just in sign.
+ * Strings are placed right before an inaccessible guard page, so a load
+ * past a terminator fails the test by crashing.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "../../SlashGaming-Diablo-II-API/src/cxx/backend/unicode_string_kernel.hpp"
+#include "../support/sgd2mapi_test.hpp"
+
+namespace {
+
+constexpr std::size_t kCodeUnitCount = 0x10000;
+
+/**
+ * The reconstructed Unicode_strncmp of 1.00, before it was moved onto
+ * the kernel.
+ */
+static int Unicode_strncmp_1_00_Reference(
+    const std::uint16_t* str1,
+    const std::uint16_t* str2,
+    std::size_t count
+) {
+  for (std::size_t i = 0; i < count; i += 1) {
+    int diff = str1[i] - str2[i];
+
+    if (diff != 0) {
+      return diff;
+    }
+
+    if (str1[i] == u'\0') {
+      return 0;
+    }
+  }
+
+  return 0;
+}
+
+static std::uint16_t ToLowerReference(std::uint16_t ch) {
+  if ((ch >= u'A' && ch <= u'Z')
+      || (ch >= 0xC0 && ch <= 0xDE && ch != 0xD7)) {
+    return ch + 0x20;
+  }
+
+  return ch;
+}
+
+static std::uint16_t ToUpperReference(std::uint16_t ch) {
+  if ((ch >= u'a' && ch <= u'z')
+      || (ch >= 0xE0 && ch <= 0xFE && ch != 0xF7)) {
+    return ch - 0x20;
+  }
+
+  return ch;
+}
+
+/**
+ * A readable and writable page followed by an inaccessible page.
+ */
+class GuardedPage {
+ public:
+  GuardedPage() {
+#if defined(_WIN32)
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+    this->page_size_ = system_info.dwPageSize;
+
+    this->base_ = static_cast<std::uint8_t*>(VirtualAlloc(
+        nullptr,
+        this->page_size_ * 2,
+        MEM_COMMIT | MEM_RESERVE,
+        PAGE_READWRITE
+    ));
+
+    DWORD old_protect;
+    VirtualProtect(
+        this->base_ + this->page_size_,
+        this->page_size_,
+        PAGE_NOACCESS,
+        &old_protect
+    );
+#else
+    this->page_size_ = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+    this->base_ = static_cast<std::uint8_t*>(mmap(
+        nullptr,
+        this->page_size_ * 2,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS,
+        -1,
+        0
+    ));
+
+    mprotect(this->base_ + this->page_size_, this->page_size_, PROT_NONE);
+#endif
+  }
+
+  GuardedPage(const GuardedPage& page) = delete;
+
+  ~GuardedPage() {
+#if defined(_WIN32)
+    VirtualFree(this->base_, 0, MEM_RELEASE);
+#else
+    munmap(this->base_, this->page_size_ * 2);
+#endif
+  }
+
+  GuardedPage& operator=(const GuardedPage& page) = delete;
+
+  /**
+   * Copies the code units so that the last one ends at the guard page,
+   * shifted back by misalignment bytes. Returns the copy.
+   */
+  std::uint16_t* Place(
+      const std::vector<std::uint16_t>& str,
+      std::size_t misalignment
+  ) {
+    std::size_t size = str.size() * sizeof(std::uint16_t);
+    std::uint8_t* dest = this->base_ + this->page_size_ - size - misalignment;
+
+    std::memcpy(dest, str.data(), size);
+
+    return reinterpret_cast<std::uint16_t*>(dest);
+  }
+
+ private:
+  std::uint8_t* base_;
+  std::size_t page_size_;
+};
+
+/**
+ * Makes a null-terminated string from a small alphabet, so that random
+ * pairs often share long prefixes.
+ */
+static std::vector<std::uint16_t> MakeRandomString(
+    std::mt19937& random,
+    std::size_t length
+) {
+  static constexpr std::uint16_t kAlphabet[] = {
+      u'a', u'b', u'A', 0xE9, 0xC9, 0x7FFF, 0x8000, 0xFFFF
+  };
+
+  std::uniform_int_distribution<std::size_t> alphabet_index(
+      0,
+      std::size(kAlphabet) - 1
+  );
+
+  std::vector<std::uint16_t> str;
+
+  for (std::size_t i = 0; i < length; i += 1) {
+    str.push_back(kAlphabet[alphabet_index(random)]);
+  }
+
+  str.push_back(0);
+
+  return str;
+}
+
+static void TestCaseMappingAllCodeUnits() {
+  std::vector<std::uint16_t> all_code_units(kCodeUnitCount);
+
+  for (std::size_t i = 0; i < kCodeUnitCount; i += 1) {
+    std::uint16_t ch = static_cast<std::uint16_t>(i);
+    all_code_units[i] = ch;
+
+    CHECK_EQ(ToLowerReference(ch), ::mapi::UnicodeCharToLower(ch));
+    CHECK_EQ(ToUpperReference(ch), ::mapi::UnicodeCharToUpper(ch));
+  }
+
+  // Every offset into the block, so that each code unit passes through
+  // every lane and the scalar tail.
+  for (std::size_t offset = 0; offset < 8; offset += 1) {
+    std::size_t count = kCodeUnitCount - offset;
+
+    std::vector<std::uint16_t> lower(count);
+    std::vector<std::uint16_t> upper(count);
+
+    ::mapi::UnicodeToLower(&all_code_units[offset], lower.data(), count);
+    ::mapi::UnicodeToUpper(&all_code_units[offset], upper.data(), count);
+
+    std::size_t mismatch_count = 0;
+
+    for (std::size_t i = 0; i < count; i += 1) {
+      std::uint16_t ch = all_code_units[offset + i];
+
+      if (lower[i] != ToLowerReference(ch)
+          || upper[i] != ToUpperReference(ch)) {
+        mismatch_count += 1;
+      }
+    }
+
+    CHECK_EQ(0u, mismatch_count);
+  }
+
+  // In place.
+  std::vector<std::uint16_t> in_place = all_code_units;
+  ::mapi::UnicodeToUpper(in_place.data(), in_place.data(), kCodeUnitCount);
+
+  for (std::size_t i = 0; i < kCodeUnitCount; i += 1) {
+    if (in_place[i] != ToUpperReference(all_code_units[i])) {
+      CHECK_EQ(ToUpperReference(all_code_units[i]), in_place[i]);
+      break;
+    }
+  }
+}
+
+static void TestStrncmpFuzzAgainstGuardPage() {
+  GuardedPage page1;
+  GuardedPage page2;
+
+  std::mt19937 random(0x5D2);
+  std::uniform_int_distribution<std::size_t> length_distribution(0, 80);
+  std::uniform_int_distribution<std::size_t> misalignment_distribution(
+      0,
+      3
+  );
+
+  static constexpr std::size_t kCounts[] = {
+      0, 1, 7, 8, 9, 15, 16, 17, 33, 64,
+      std::numeric_limits<std::size_t>::max()
+  };
+
+  std::size_t mismatch_count = 0;
+
+  for (int round = 0; round < 20000; round += 1) {
+    std::vector<std::uint16_t> str1 =
+        MakeRandomString(random, length_distribution(random));
+    std::vector<std::uint16_t> str2 =
+        MakeRandomString(random, length_distribution(random));
+
+    // Half of the pairs share a prefix of the first string.
+    if (round % 2 == 0 && str1.size() > 1) {
+      std::size_t prefix_length =
+          std::min(str1.size() - 1, str2.size() - 1);
+      std::copy_n(str1.begin(), prefix_length, str2.begin());
+    }
+
+    // Odd misalignments put the code units across the SSE2 lanes.
+    const std::uint16_t* placed1 =
+        page1.Place(str1, misalignment_distribution(random));
+    const std::uint16_t* placed2 =
+        page2.Place(str2, misalignment_distribution(random));
+
+    for (std::size_t count : kCounts) {
+      int expected =
+          Unicode_strncmp_1_00_Reference(placed1, placed2, count);
+      int actual = ::mapi::UnicodeStrncmp(placed1, placed2, count);
+
+      if (expected != actual) {
+        mismatch_count += 1;
+      }
+    }
+
+    if (Unicode_strncmp_1_00_Reference(
+            placed1,
+            placed2,
+            std::numeric_limits<std::size_t>::max()
+        ) != ::mapi::UnicodeStrcmp(placed1, placed2)) {
+      mismatch_count += 1;
+    }
+
+    if (str1.size() - 1 != ::mapi::UnicodeStrlen(placed1)) {
+      mismatch_count += 1;
+    }
+  }
+
+  CHECK_EQ(0u, mismatch_count);
+}
+
+static void TestStrncmpDifferenceIsExact() {
+  const std::uint16_t str1[] = { u'a', 0xFFFF, 0 };
+  const std::uint16_t str2[] = { u'a', 0x0001, 0 };
+
+  CHECK_EQ(0xFFFE, ::mapi::UnicodeStrncmp(str1, str2, 2));
+  CHECK_EQ(-0xFFFE, ::mapi::UnicodeStrncmp(str2, str1, 2));
+  CHECK_EQ(0, ::mapi::UnicodeStrncmp(str1, str2, 1));
+
+  // Equal through the terminator, and past it nothing is read.
+  const std::uint16_t str3[] = { u'x', 0, u'y' };
+  const std::uint16_t str4[] = { u'x', 0, u'z' };
+  CHECK_EQ(0, ::mapi::UnicodeStrncmp(str3, str4, 3));
+}
+
+static void TestStrcpyAndStrcatAgainstGuardPage() {
+  GuardedPage page;
+
+  std::mt19937 random(0xCA7);
+
+  for (std::size_t length = 0; length < 40; length += 1) {
+    std::vector<std::uint16_t> str = MakeRandomString(random, length);
+    const std::uint16_t* placed = page.Place(str, (length % 2) * 2);
+
+    std::vector<std::uint16_t> dest(100, 0xAAAA);
+    dest[0] = u'>';
+    dest[1] = 0;
+
+    ::mapi::UnicodeStrcat(dest.data(), placed);
+
+    CHECK_EQ(u'>', dest[0]);
+    CHECK(std::equal(str.begin(), str.end(), &dest[1]));
+    CHECK_EQ(0xAAAA, dest[length + 2]);
+
+    ::mapi::UnicodeStrcpy(dest.data(), placed);
+    CHECK(std::equal(str.begin(), str.end(), dest.begin()));
+  }
+}
+
+} // namespace
+
+int main() {
+  TestCaseMappingAllCodeUnits();
+  TestStrncmpDifferenceIsExact();
+  TestStrncmpFuzzAgainstGuardPage();
+  TestStrcpyAndStrcatAgainstGuardPage();
+
+  return ::sgd2mapi_test::GetExitCode();
+}
@@ -0,0 +1,419 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Checks the UTF-8 transcoder against a plain code point by code point
+ * reference. The test is built once for each path of the transcoder:
+ * scalar, SSE2, and AVX2. Every build must match the reference, so the
+ * paths match each other.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../SlashGaming-Diablo-II-API/src/cxx/backend/utf8_transcoder.hpp"
+#include "../support/sgd2mapi_test.hpp"
+
+namespace {
+
+// Tells CTest that the host cannot run the path this build tests.
+static constexpr int kSkipExitCode = 77;
+
+static constexpr char16_t kReplacementChar = 0xFFFD;
+
+// Lengths around the 8, 16, and 32 unit blocks of the vector paths.
+static constexpr std::size_t kBoundaryLengths[] = {
+    0, 1, 7, 8, 9, 15, 16, 17, 31, 32, 33, 47, 48, 49, 63, 64, 65, 100
+};
+
+/**
+ * Decodes one UTF-8 sequence as Unicode's table of well-formed byte
+ * sequences describes it. Anything else is one invalid byte.
+ */
+static char32_t DecodeReference(
+    const std::u8string& src,
+    std::size_t i,
+    std::size_t* size
+) {
+  unsigned int lead = src[i];
+  std::size_t remaining = src.length() - i;
+
+  auto byte_in = [&src, i, remaining](
+      std::size_t offset,
+      unsigned int min,
+      unsigned int max
+  ) {
+    return offset < remaining && src[i + offset] >= min
+        && src[i + offset] <= max;
+  };
+
+  *size = 1;
+
+  if (lead < 0x80) {
+    return lead;
+  }
+
+  if (lead >= 0xC2 && lead <= 0xDF && byte_in(1, 0x80, 0xBF)) {
+    *size = 2;
+    return ((lead & 0x1F) << 6) | (src[i + 1] & 0x3F);
+  }
+
+  unsigned int min_second = 0x80;
+  unsigned int max_second = 0xBF;
+
+  if (lead == 0xE0) {
+    min_second = 0xA0;
+  } else if (lead == 0xED) {
+    max_second = 0x9F;
+  } else if (lead == 0xF0) {
+    min_second = 0x90;
+  } else if (lead == 0xF4) {
+    max_second = 0x8F;
+  }
+
+  if (lead >= 0xE0 && lead <= 0xEF
+      && byte_in(1, min_second, max_second)
+      && byte_in(2, 0x80, 0xBF)) {
+    *size = 3;
+    return ((lead & 0x0F) << 12)
+        | ((src[i + 1] & 0x3F) << 6)
+        | (src[i + 2] & 0x3F);
+  }
+
+  if (lead >= 0xF0 && lead <= 0xF4
+      && byte_in(1, min_second, max_second)
+      && byte_in(2, 0x80, 0xBF)
+      && byte_in(3, 0x80, 0xBF)) {
+    *size = 4;
+    return ((lead & 0x07) << 18)
+        | ((src[i + 1] & 0x3F) << 12)
+        | ((src[i + 2] & 0x3F) << 6)
+        | (src[i + 3] & 0x3F);
+  }
+
+  return kReplacementChar;
+}
+
+static std::u16string Utf8ToUtf16Reference(const std::u8string& src) {
+  std::u16string dest;
+
+  for (std::size_t i = 0; i < src.length(); ) {
+    std::size_t size;
+    char32_t code_point = DecodeReference(src, i, &size);
+    i += size;
+
+    if (code_point >= 0x10000) {
+      code_point -= 0x10000;
+      dest.push_back(static_cast<char16_t>(0xD800 + (code_point >> 10)));
+      dest.push_back(static_cast<char16_t>(0xDC00 + (code_point & 0x3FF)));
+    } else {
+      dest.push_back(static_cast<char16_t>(code_point));
+    }
+  }
+
+  return dest;
+}
+
+static std::u8string Utf16ToUtf8Reference(const std::u16string& src) {
+  std::u8string dest;
+
+  for (std::size_t i = 0; i < src.length(); i += 1) {
+    char32_t code_point = src[i];
+
+    // Unpaired surrogates are encoded on their own.
+    if (code_point >= 0xD800 && code_point <= 0xDBFF
+        && i + 1 < src.length()
+        && src[i + 1] >= 0xDC00 && src[i + 1] <= 0xDFFF) {
+      code_point = 0x10000 + ((code_point - 0xD800) << 10)
+          + (src[i + 1] - 0xDC00);
+      i += 1;
+    }
+
+    if (code_point < 0x80) {
+      dest.push_back(static_cast<char8_t>(code_point));
+    } else if (code_point < 0x800) {
+      dest.push_back(static_cast<char8_t>(0xC0 | (code_point >> 6)));
+      dest.push_back(static_cast<char8_t>(0x80 | (code_point & 0x3F)));
+    } else if (code_point < 0x10000) {
+      dest.push_back(static_cast<char8_t>(0xE0 | (code_point >> 12)));
+      dest.push_back(
+          static_cast<char8_t>(0x80 | ((code_point >> 6) & 0x3F))
+      );
+      dest.push_back(static_cast<char8_t>(0x80 | (code_point & 0x3F)));
+    } else {
+      dest.push_back(static_cast<char8_t>(0xF0 | (code_point >> 18)));
+      dest.push_back(
+          static_cast<char8_t>(0x80 | ((code_point >> 12) & 0x3F))
+      );
+      dest.push_back(
+          static_cast<char8_t>(0x80 | ((code_point >> 6) & 0x3F))
+      );
+      dest.push_back(static_cast<char8_t>(0x80 | (code_point & 0x3F)));
+    }
+  }
+
+  return dest;
+}
+
+// Written after the converted text, to catch writes past its end.
+static constexpr std::uint16_t kGuard16 = 0xA5A5;
+static constexpr char8_t kGuard8 = 0xA5;
+static constexpr std::size_t kGuardLength = 64;
+
+static bool CheckUtf8ToUtf16(const std::u8string& src) {
+  std::u16string expected = Utf8ToUtf16Reference(src);
+
+  std::size_t length = ::mapi::GetUtf8ToUtf16Length(
+      src.data(),
+      src.length()
+  );
+
+  std::vector<std::uint16_t> dest(length + kGuardLength, kGuard16);
+  std::size_t written = ::mapi::TranscodeUtf8ToUtf16(
+      src.data(),
+      src.length(),
+      dest.data()
+  );
+
+  bool is_match = length == expected.length() && written == length;
+
+  for (std::size_t i = 0; is_match && i < length; i += 1) {
+    is_match = dest[i] == expected[i];
+  }
+
+  for (std::size_t i = length; is_match && i < dest.size(); i += 1) {
+    is_match = dest[i] == kGuard16;
+  }
+
+  return is_match;
+}
+
+static bool CheckUtf16ToUtf8(const std::u16string& src) {
+  std::u8string expected = Utf16ToUtf8Reference(src);
+
+  const std::uint16_t* src_data =
+      reinterpret_cast<const std::uint16_t*>(src.data());
+
+  std::size_t length = ::mapi::GetUtf16ToUtf8Length(src_data, src.length());
+
+  std::vector<char8_t> dest(length + kGuardLength, kGuard8);
+  std::size_t written = ::mapi::TranscodeUtf16ToUtf8(
+      src_data,
+      src.length(),
+      dest.data()
+  );
+
+  return length == expected.length()
+      && written == length
+      && std::u8string(dest.data(), length) == expected
+      && std::u8string(dest.data() + length, kGuardLength)
+          == std::u8string(kGuardLength, kGuard8);
+}
+
+static void TestKnownConversions() {
+  CHECK(CheckUtf8ToUtf16(u8""));
+  CHECK(CheckUtf8ToUtf16(u8"plain ASCII"));
+  CHECK(CheckUtf8ToUtf16(u8"é ÿc1 € 𝄞"));
+
+  // Embedded null characters are converted like any other.
+  CHECK(CheckUtf8ToUtf16(std::u8string(u8"a\0b", 3)));
+  CHECK(CheckUtf16ToUtf8(std::u16string(u"a\0b", 3)));
+
+  std::size_t length = ::mapi::GetUtf8ToUtf16Length(u8"a\0b", 3);
+  CHECK_EQ(3u, length);
+
+  CHECK(CheckUtf16ToUtf8(u"é ÿc1 € 𝄞"));
+  CHECK_EQ(
+      4u,
+      ::mapi::GetUtf16ToUtf8Length(
+          reinterpret_cast<const std::uint16_t*>(u"𝄞"),
+          2
+      )
+  );
+}
+
+static void TestInvalidUtf8() {
+  // Each invalid byte becomes one U+FFFD.
+  static const char8_t* const kInvalidInputs[] = {
+      u8"\x80",
+      u8"\xBF\x80",
+      u8"\xC0\xAF",
+      u8"\xC1\xBF",
+      u8"\xE0\x80\xAF",
+      u8"\xE2\x82",
+      u8"\xE2\x82" "A",
+      u8"\xF0\x8F\xBF\xBF",
+      u8"\xF4\x90\x80\x80",
+      u8"\xF5\x80\x80\x80",
+      u8"\xF0\x9D\x84",
+      u8"\xFE\xFF",
+      // Encoded surrogates.
+      u8"\xED\xA0\x80",
+      u8"\xED\xBF\xBF",
+      u8"\xED\xA0\x80\xED\xB0\x80",
+  };
+
+  for (const char8_t* input : kInvalidInputs) {
+    std::u8string src(input);
+    CHECK(CheckUtf8ToUtf16(src));
+
+    // At every offset in and around a vector block of ASCII.
+    for (std::size_t prefix_length : kBoundaryLengths) {
+      std::u8string padded = std::u8string(prefix_length, u8'a') + src
+          + std::u8string(prefix_length, u8'z');
+
+      CHECK(CheckUtf8ToUtf16(padded));
+    }
+  }
+
+  std::u16string replaced = Utf8ToUtf16Reference(u8"\xED\xA0\x80");
+  CHECK(replaced == std::u16string(3, kReplacementChar));
+}
+
+static void TestLoneSurrogates() {
+  static const char16_t kHigh = 0xD834;
+  static const char16_t kLow = 0xDD1E;
+
+  const std::u16string inputs[] = {
+      std::u16string(1, kHigh),
+      std::u16string(1, kLow),
+      std::u16string{ kLow, kHigh },
+      std::u16string{ kHigh, kHigh, kLow },
+      std::u16string{ kHigh, u'a', kLow },
+      std::u16string{ kHigh, kLow },
+  };
+
+  for (const std::u16string& input : inputs) {
+    CHECK(CheckUtf16ToUtf8(input));
+
+    for (std::size_t prefix_length : kBoundaryLengths) {
+      std::u16string padded = std::u16string(prefix_length, u'a') + input
+          + std::u16string(prefix_length, u'z');
+
+      CHECK(CheckUtf16ToUtf8(padded));
+
+      // A pair split across the end of the source stays unpaired.
+      CHECK(CheckUtf16ToUtf8(std::u16string(prefix_length, u'a') + kHigh));
+    }
+  }
+
+  CHECK(Utf16ToUtf8Reference(std::u16string(1, kHigh)) == u8"\xED\xA0\xB4");
+}
+
+static void TestEveryBoundaryPosition() {
+  // A non-ASCII character at every position of every boundary length,
+  // so the vector loops stop and resume at each offset in a block.
+  static const char16_t kNonAscii[] = { 0xE9, 0x20AC, 0xFFFF };
+
+  for (std::size_t length : kBoundaryLengths) {
+    CHECK(CheckUtf16ToUtf8(std::u16string(length, u'x')));
+    CHECK(CheckUtf8ToUtf16(std::u8string(length, u8'x')));
+
+    for (std::size_t position = 0; position < length; position += 1) {
+      for (char16_t ch : kNonAscii) {
+        std::u16string utf16(length, u'x');
+        utf16[position] = ch;
+
+        CHECK(CheckUtf16ToUtf8(utf16));
+        CHECK(CheckUtf8ToUtf16(Utf16ToUtf8Reference(utf16)));
+      }
+
+      // ASCII with its high bit set is invalid in both directions'
+      // vector checks.
+      std::u8string utf8(length, u8'x');
+      utf8[position] = 0x80;
+      CHECK(CheckUtf8ToUtf16(utf8));
+    }
+  }
+}
+
+static void TestRandomInput() {
+  std::mt19937 random(0x0711);
+
+  for (std::size_t i = 0; i < 5000; i += 1) {
+    std::size_t length = random() % 130;
+
+    // Mostly ASCII, so that runs reach the vector blocks.
+    std::u8string utf8;
+    std::u16string utf16;
+
+    for (std::size_t j = 0; j < length; j += 1) {
+      bool is_ascii = (random() % 8) != 0;
+
+      utf8.push_back(
+          static_cast<char8_t>(is_ascii ? random() % 0x80 : random())
+      );
+      utf16.push_back(
+          static_cast<char16_t>(is_ascii ? random() % 0x80 : random())
+      );
+    }
+
+    CHECK(CheckUtf8ToUtf16(utf8));
+    CHECK(CheckUtf16ToUtf8(utf16));
+  }
+}
+
+} // namespace
+
+int main() {
+#if defined(__AVX2__) && defined(__GNUC__)
+  if (!__builtin_cpu_supports("avx2")) {
+    std::printf("The host does not support AVX2.\n");
+    return kSkipExitCode;
+  }
+#endif
+
+  TestKnownConversions();
+  TestInvalidUtf8();
+  TestLoneSurrogates();
+  TestEveryBoundaryPosition();
+  TestRandomInput();
+
+  return ::sgd2mapi_test::GetExitCode();
+}
@@ -0,0 +1,485 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <vector>
+
+#include "../../SlashGaming-Diablo-II-API/src/cxx/backend/x86_instruction_decoder.hpp"
+#include "../support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::mapi::X86Instruction;
+
+struct DecodeCase {
+  std::vector<std::uint8_t> code;
+  std::size_t length;
+  std::size_t opcode_offset;
+  std::size_t relative_offset;
+  std::size_t relative_size;
+  bool is_flow_end;
+};
+
+static void CheckDecode(const DecodeCase& decode_case) {
+  X86Instruction instruction;
+
+  // Trailing bytes must not be consumed.
+  std::vector<std::uint8_t> code = decode_case.code;
+  code.resize(code.size() + ::mapi::kX86MaxInstructionLength, 0xCC);
+
+  bool is_decoded = ::mapi::DecodeX86Instruction(
+      code.data(),
+      code.size(),
+      &instruction
+  );
+
+  CHECK(is_decoded);
+
+  if (!is_decoded) {
+    return;
+  }
+
+  CHECK_EQ(decode_case.length, instruction.length);
+  CHECK_EQ(decode_case.opcode_offset, instruction.opcode_offset);
+  CHECK_EQ(decode_case.relative_offset, instruction.relative_offset);
+  CHECK_EQ(decode_case.relative_size, instruction.relative_size);
+  CHECK_EQ(decode_case.is_flow_end, instruction.is_flow_end);
+
+  // Every truncation of the instruction must be rejected.
+  for (std::size_t size = 0; size < decode_case.length; size += 1) {
+    CHECK(!::mapi::DecodeX86Instruction(code.data(), size, &instruction));
+  }
+}
+
+static void TestPlainInstructions() {
+  // push ebp
+  CheckDecode({ { 0x55 }, 1, 0, 0, 0, false });
+
+  // mov ebp, esp
+  CheckDecode({ { 0x8B, 0xEC }, 2, 0, 0, 0, false });
+
+  // sub esp, 0x10
+  CheckDecode({ { 0x83, 0xEC, 0x10 }, 3, 0, 0, 0, false });
+
+  // mov eax, 0x12345678
+  CheckDecode({ { 0xB8, 0x78, 0x56, 0x34, 0x12 }, 5, 0, 0, 0, false });
+
+  // enter 0x10, 0
+  CheckDecode({ { 0xC8, 0x10, 0x00, 0x00 }, 4, 0, 0, 0, false });
+
+  // ret
+  CheckDecode({ { 0xC3 }, 1, 0, 0, 0, true });
+
+  // ret 8
+  CheckDecode({ { 0xC2, 0x08, 0x00 }, 3, 0, 0, 0, true });
+
+  // int3 ends the flow, since it pads the space between functions.
+  CheckDecode({ { 0xCC }, 1, 0, 0, 0, true });
+}
+
+static void TestModRmForms() {
+  // mov eax, [ecx]
+  CheckDecode({ { 0x8B, 0x01 }, 2, 0, 0, 0, false });
+
+  // mov eax, [0x12345678]: mod 00, rm 101 is disp32
+  CheckDecode({ { 0x8B, 0x05, 0x78, 0x56, 0x34, 0x12 }, 6, 0, 0, 0, false });
+
+  // mov eax, [esp + 8]: SIB and disp8
+  CheckDecode({ { 0x8B, 0x44, 0x24, 0x08 }, 4, 0, 0, 0, false });
+
+  // mov eax, [esp + 0x100]: SIB and disp32
+  CheckDecode({
+      { 0x8B, 0x84, 0x24, 0x00, 0x01, 0x00, 0x00 }, 7, 0, 0, 0, false
+  });
+
+  // mov eax, [eax * 4 + 0x12345678]: SIB with no base is disp32
+  CheckDecode({
+      { 0x8B, 0x04, 0x85, 0x78, 0x56, 0x34, 0x12 }, 7, 0, 0, 0, false
+  });
+
+  // mov eax, [eax + 0x100]: mod 10 is disp32
+  CheckDecode({ { 0x8B, 0x80, 0x00, 0x01, 0x00, 0x00 }, 6, 0, 0, 0, false });
+
+  // mov dword [esp + 4], 1: ModR/M with SIB, disp8 and imm32
+  CheckDecode({
+      { 0xC7, 0x44, 0x24, 0x04, 0x01, 0x00, 0x00, 0x00 }, 8, 0, 0, 0, false
+  });
+
+  // test cl, 1 and test ecx, 1: only TEST in group 3 takes an immediate
+  CheckDecode({ { 0xF6, 0xC1, 0x01 }, 3, 0, 0, 0, false });
+  CheckDecode({
+      { 0xF7, 0xC1, 0x01, 0x00, 0x00, 0x00 }, 6, 0, 0, 0, false
+  });
+
+  // neg eax
+  CheckDecode({ { 0xF7, 0xD8 }, 2, 0, 0, 0, false });
+
+  // call [0x12345678] continues, jmp [0x12345678] does not
+  CheckDecode({ { 0xFF, 0x15, 0x78, 0x56, 0x34, 0x12 }, 6, 0, 0, 0, false });
+  CheckDecode({ { 0xFF, 0x25, 0x78, 0x56, 0x34, 0x12 }, 6, 0, 0, 0, true });
+
+  // jmp eax
+  CheckDecode({ { 0xFF, 0xE0 }, 2, 0, 0, 0, true });
+}
+
+static void TestPrefixes() {
+  // mov word [ebp - 4], 1: the operand size prefix shrinks the immediate
+  CheckDecode({ { 0x66, 0xC7, 0x45, 0xFC, 0x01, 0x00 }, 6, 1, 0, 0, false });
+
+  // rep movsd
+  CheckDecode({ { 0xF3, 0xA5 }, 2, 1, 0, 0, false });
+
+  // mov eax, fs:[0]: segment prefix and moffs32
+  CheckDecode({ { 0x64, 0xA1, 0x00, 0x00, 0x00, 0x00 }, 6, 1, 0, 0, false });
+
+  // mov eax, [0x1234]: the address size prefix shrinks the moffs
+  CheckDecode({ { 0x67, 0xA1, 0x34, 0x12 }, 4, 1, 0, 0, false });
+
+  // mov eax, [bx + si]: 16-bit addressing has no SIB byte
+  CheckDecode({ { 0x67, 0x8B, 0x00 }, 3, 1, 0, 0, false });
+
+  // mov eax, [0x1234]: 16-bit addressing with disp16
+  CheckDecode({ { 0x67, 0x8B, 0x06, 0x34, 0x12 }, 5, 1, 0, 0, false });
+
+  // lock cmpxchg [edx], ecx
+  CheckDecode({ { 0xF0, 0x0F, 0xB1, 0x0A }, 4, 1, 0, 0, false });
+
+  // A run of prefixes with no opcode
+  X86Instruction instruction;
+  const std::uint8_t prefixes[] = { 0x66, 0x66, 0xF3, 0x2E };
+  CHECK(!::mapi::DecodeX86Instruction(
+      prefixes,
+      sizeof(prefixes),
+      &instruction
+  ));
+}
+
+static void TestTwoByteOpcodes() {
+  // movzx eax, al
+  CheckDecode({ { 0x0F, 0xB6, 0xC0 }, 3, 0, 0, 0, false });
+
+  // nop dword [eax + eax + 0]
+  CheckDecode({ { 0x0F, 0x1F, 0x44, 0x00, 0x00 }, 5, 0, 0, 0, false });
+
+  // pshufb xmm0, xmm1
+  CheckDecode({ { 0x66, 0x0F, 0x38, 0x00, 0xC1 }, 5, 1, 0, 0, false });
+
+  // palignr xmm0, xmm1, 8
+  CheckDecode({
+      { 0x66, 0x0F, 0x3A, 0x0F, 0xC1, 0x08 }, 6, 1, 0, 0, false
+  });
+
+  // ud2 ends the flow.
+  CheckDecode({ { 0x0F, 0x0B }, 2, 0, 0, 0, true });
+
+  // 0F 04 is not an instruction.
+  X86Instruction instruction;
+  const std::uint8_t invalid[] = { 0x0F, 0x04, 0x90, 0x90 };
+  CHECK(!::mapi::DecodeX86Instruction(invalid, sizeof(invalid), &instruction));
+}
+
+static void TestRelativeBranches() {
+  // jz rel8
+  CheckDecode({ { 0x74, 0x05 }, 2, 0, 1, 1, false });
+
+  // jmp rel8
+  CheckDecode({ { 0xEB, 0xFE }, 2, 0, 1, 1, true });
+
+  // jecxz rel8
+  CheckDecode({ { 0xE3, 0x05 }, 2, 0, 1, 1, false });
+
+  // call rel32
+  CheckDecode({ { 0xE8, 0x00, 0x00, 0x00, 0x00 }, 5, 0, 1, 4, false });
+
+  // jmp rel32
+  CheckDecode({ { 0xE9, 0x00, 0x00, 0x00, 0x00 }, 5, 0, 1, 4, true });
+
+  // jz rel32
+  CheckDecode({ { 0x0F, 0x84, 0x10, 0x00, 0x00, 0x00 }, 6, 0, 2, 4, false });
+
+  // jmp rel16, with the operand size prefix
+  CheckDecode({ { 0x66, 0xE9, 0x10, 0x00 }, 4, 1, 2, 2, true });
+
+  // jmp far 0x0008:0x00000000
+  CheckDecode({
+      { 0xEA, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00 }, 7, 0, 0, 0, true
+  });
+}
+
+static void TestPatchSize() {
+  // push ebp; mov ebp, esp; sub esp, 0x10
+  const std::uint8_t prologue[] = {
+      0x55, 0x8B, 0xEC, 0x83, 0xEC, 0x10, 0xCC, 0xCC
+  };
+
+  CHECK_EQ(1u, ::mapi::GetX86PatchSize(prologue, 1));
+  CHECK_EQ(3u, ::mapi::GetX86PatchSize(prologue, 2));
+  CHECK_EQ(6u, ::mapi::GetX86PatchSize(prologue, 5));
+
+  // A patch cannot extend past a return.
+  const std::uint8_t short_function[] = {
+      0x33, 0xC0, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC
+  };
+
+  CHECK_EQ(0u, ::mapi::GetX86PatchSize(short_function, 5));
+  CHECK_EQ(3u, ::mapi::GetX86PatchSize(short_function, 3));
+}
+
+static constexpr std::size_t kScanBeforeSize = 32;
+static constexpr std::size_t kScanAfterSize = 64;
+static constexpr std::intptr_t kCodeAddress = 0x00401000;
+
+/**
+ * Lays out the bytes before the patch, then the patch, then the bytes
+ * after it, padded with int3.
+ */
+static std::vector<std::uint8_t> MakeCode(
+    std::initializer_list<std::uint8_t> before,
+    std::initializer_list<std::uint8_t> patch,
+    std::initializer_list<std::uint8_t> after
+) {
+  std::vector<std::uint8_t> code(kScanBeforeSize - before.size(), 0x90);
+  code.insert(code.end(), before);
+  code.insert(code.end(), patch);
+  code.insert(code.end(), after);
+  code.resize(code.size() + kScanAfterSize + 16, 0xCC);
+
+  return code;
+}
+
+static bool IsBranchTarget(
+    const std::vector<std::uint8_t>& code,
+    std::size_t patch_size
+) {
+  return ::mapi::IsX86PatchRangeBranchTarget(
+      &code[kScanBeforeSize],
+      kCodeAddress,
+      patch_size,
+      kScanBeforeSize,
+      kScanAfterSize
+  );
+}
+
+static void TestBranchTargetForward() {
+  // push ebp; mov ebp, esp; sub esp, 0x10; then jnz back to mov ebp, esp
+  std::vector<std::uint8_t> loop = MakeCode(
+      {},
+      { 0x55, 0x8B, 0xEC, 0x83, 0xEC, 0x10 },
+      { 0x75, 0xF9 }
+  );
+
+  CHECK(IsBranchTarget(loop, 6));
+
+  // A branch back to the start of the patch is allowed.
+  std::vector<std::uint8_t> to_start = MakeCode(
+      {},
+      { 0x55, 0x8B, 0xEC, 0x83, 0xEC, 0x10 },
+      { 0x75, 0xF8 }
+  );
+
+  CHECK(!IsBranchTarget(to_start, 6));
+
+  // A branch inside the patch into the patch.
+  std::vector<std::uint8_t> inner = MakeCode(
+      {},
+      { 0x74, 0x01, 0x90, 0x90, 0x90 },
+      {}
+  );
+
+  CHECK(IsBranchTarget(inner, 5));
+}
+
+static void TestBranchTargetBackward() {
+  // A jump just before the patch into its second instruction.
+  std::vector<std::uint8_t> back_edge = MakeCode(
+      { 0xEB, 0x01 },
+      { 0x55, 0x8B, 0xEC, 0x83, 0xEC, 0x10 },
+      {}
+  );
+
+  CHECK(IsBranchTarget(back_edge, 6));
+
+  // A jz rel32 further back into the last instruction.
+  std::vector<std::uint8_t> far_back_edge = MakeCode(
+      { 0x0F, 0x84, 0x0D, 0x00, 0x00, 0x00,
+        0x8B, 0x44, 0x24, 0x08, 0x90, 0x90, 0x90, 0x90 },
+      { 0x55, 0x8B, 0xEC, 0x83, 0xEC, 0x10 },
+      {}
+  );
+
+  CHECK(IsBranchTarget(far_back_edge, 6));
+
+  // Jumps to the start of the patch and past its end are allowed.
+  std::vector<std::uint8_t> to_boundaries = MakeCode(
+      { 0x74, 0x02, 0xEB, 0x06 },
+      { 0x55, 0x8B, 0xEC, 0x83, 0xEC, 0x10 },
+      {}
+  );
+
+  CHECK(!IsBranchTarget(to_boundaries, 6));
+
+  // The immediate of mov eax, 0x909003EB looks like jmp +3 into the patch
+  // when decoded from its second byte. The real instruction boundaries
+  // end at the patch and contain no branch.
+  std::vector<std::uint8_t> misaligned = MakeCode(
+      { 0xB8, 0xEB, 0x03, 0x90, 0x90 },
+      { 0x55, 0x8B, 0xEC, 0x83, 0xEC, 0x10 },
+      {}
+  );
+
+  CHECK(!IsBranchTarget(misaligned, 6));
+}
+
+static void TestRelocate() {
+  static constexpr std::intptr_t kSourceAddress = 0x00401000;
+  static constexpr std::intptr_t kDestinationAddress = 0x00500000;
+
+  // jz rel8, jmp rel8 and call rel32 are relocated to reach the same
+  // targets.
+  const std::uint8_t source[] = {
+      0x74, 0x10,
+      0xEB, 0x20,
+      0xE8, 0x00, 0x01, 0x00, 0x00,
+  };
+
+  std::uint8_t destination[32] = {};
+
+  std::size_t size = ::mapi::BuildX86Trampoline(
+      source,
+      kSourceAddress,
+      sizeof(source),
+      destination,
+      kDestinationAddress,
+      sizeof(destination)
+  );
+
+  CHECK_EQ(6u + 5u + 5u + 5u, size);
+
+  auto read_rel32 = [&](std::size_t offset) {
+    std::int32_t value;
+    std::memcpy(&value, &destination[offset], sizeof(value));
+    return value;
+  };
+
+  // jz rel32 to source + 2 + 0x10
+  CHECK_EQ(0x0F, destination[0]);
+  CHECK_EQ(0x84, destination[1]);
+  CHECK_EQ(
+      kSourceAddress + 0x12,
+      kDestinationAddress + 6 + read_rel32(2)
+  );
+
+  // jmp rel32 to source + 4 + 0x20
+  CHECK_EQ(0xE9, destination[6]);
+  CHECK_EQ(
+      kSourceAddress + 0x24,
+      kDestinationAddress + 11 + read_rel32(7)
+  );
+
+  // call rel32 to source + 9 + 0x100
+  CHECK_EQ(0xE8, destination[11]);
+  CHECK_EQ(
+      kSourceAddress + 0x109,
+      kDestinationAddress + 16 + read_rel32(12)
+  );
+
+  // jmp rel32 back to the end of the source
+  CHECK_EQ(0xE9, destination[16]);
+  CHECK_EQ(
+      kSourceAddress + static_cast<std::intptr_t>(sizeof(source)),
+      kDestinationAddress + 21 + read_rel32(17)
+  );
+
+  // jecxz has no rel32 form.
+  const std::uint8_t jecxz[] = { 0xE3, 0x10 };
+  CHECK_EQ(0u, ::mapi::RelocateX86Instructions(
+      jecxz,
+      kSourceAddress,
+      sizeof(jecxz),
+      destination,
+      kDestinationAddress,
+      sizeof(destination)
+  ));
+
+  // A branch into the relocated range would land in patched bytes.
+  const std::uint8_t inner_branch[] = { 0x74, 0x00, 0x90 };
+  CHECK_EQ(0u, ::mapi::RelocateX86Instructions(
+      inner_branch,
+      kSourceAddress,
+      sizeof(inner_branch),
+      destination,
+      kDestinationAddress,
+      sizeof(destination)
+  ));
+
+  // Too little room in the destination.
+  CHECK_EQ(0u, ::mapi::BuildX86Trampoline(
+      source,
+      kSourceAddress,
+      sizeof(source),
+      destination,
+      kDestinationAddress,
+      20
+  ));
+}
+
+} // namespace
+
+int main() {
+  TestPlainInstructions();
+  TestModRmForms();
+  TestPrefixes();
+  TestTwoByteOpcodes();
+  TestRelativeBranches();
+  TestPatchSize();
+  TestBranchTargetForward();
+  TestBranchTargetBackward();
+  TestRelocate();
+
+  return ::sgd2mapi_test::GetExitCode();
+}
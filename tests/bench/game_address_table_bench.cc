@@ -0,0 +1,159 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Compares the perfect hash lookup of the game address tables against
+ * the binary search it replaced. Every key of every version table is
+ * looked up, in a shuffled order so that the branch predictor cannot
+ * learn the sequence.
+ */
+
+#include <cstddef>
+#include <cstdio>
+#include <algorithm>
+#include <random>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "../../SlashGaming-Diablo-II-API/src/cxx/backend/game_address_table/game_address_table_impl.hpp"
+#include "../support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::d2::DefaultLibrary;
+using ::d2::GameVersion;
+using ::mapi::GameAddressTable;
+using ::mapi::GameAddressTableEntry;
+using ::mapi::GameAddressTableEntryCompareKey;
+
+struct LookupKey {
+  const GameAddressTable* table;
+  DefaultLibrary library;
+  std::string_view address_name;
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+  std::vector<GameAddressTable> tables;
+
+  for (int i = static_cast<int>(GameVersion::k1_00);
+      i <= static_cast<int>(GameVersion::kLod1_14D);
+      i += 1) {
+    tables.push_back(
+        ::mapi::GetGameAddressTable(static_cast<GameVersion>(i))
+    );
+  }
+
+  std::vector<LookupKey> keys;
+
+  for (const GameAddressTable& table : tables) {
+    for (std::size_t i = 0; i < table.size(); i += 1) {
+      const auto& [library, address_name] = table.entries()[i].first;
+      keys.push_back({ &table, library, address_name });
+    }
+  }
+
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(0x5D2A));
+
+  std::size_t iterations = ::sgd2mapi_test::GetBenchmarkIterations(
+      argc,
+      argv,
+      10000000
+  );
+
+  std::printf(
+      "%zu tables, %zu keys, %zu lookups\n",
+      tables.size(),
+      keys.size(),
+      iterations
+  );
+
+  std::size_t key_index = 0;
+
+  double equal_range_ns = ::sgd2mapi_test::TimeBenchmark(
+      "equal_range",
+      iterations,
+      [&]() {
+        const LookupKey& key = keys[key_index];
+        key_index = (key_index + 1 == keys.size()) ? 0 : key_index + 1;
+
+        const GameAddressTableEntry* begin = key.table->entries();
+        const GameAddressTableEntry* end = begin + key.table->size();
+
+        auto range = std::equal_range(
+            begin,
+            end,
+            std::make_tuple(key.library, key.address_name),
+            GameAddressTableEntryCompareKey()
+        );
+
+        ::sgd2mapi_test::DoNotOptimize(range.first);
+      }
+  );
+
+  key_index = 0;
+
+  double find_ns = ::sgd2mapi_test::TimeBenchmark(
+      "GameAddressTable::Find",
+      iterations,
+      [&]() {
+        const LookupKey& key = keys[key_index];
+        key_index = (key_index + 1 == keys.size()) ? 0 : key_index + 1;
+
+        const GameAddressTableEntry* entry =
+            key.table->Find(key.library, key.address_name);
+
+        ::sgd2mapi_test::DoNotOptimize(entry);
+      }
+  );
+
+  if (find_ns > 0.0) {
+    std::printf("speedup: %.2fx\n", equal_range_ns / find_ns);
+  }
+
+  return 0;
+}
@@ -0,0 +1,210 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Measures game version detection from a PE signature. The fingerprint
+ * lookup is compared against the binary search over the sorted table
+ * that it replaced, and the full path of mapping a file from disk and
+ * reading its signature is timed on its own.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../SlashGaming-Diablo-II-API/src/cxx/backend/file/mapped_file.hpp"
+#include "../../SlashGaming-Diablo-II-API/src/cxx/backend/game_version/game_version_file_signature_table.hpp"
+#include "../support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::d2::intern::file_signature::FilePeSignature;
+using ::d2::intern::file_signature::FileSignatureTableEntry;
+using ::d2::intern::file_signature::FileSignatureTableEntryCompareKey;
+using ::d2::intern::file_signature::FindTableEntry;
+using ::d2::intern::file_signature::kFilePeSignatureSortedTable;
+
+static constexpr std::uint32_t kPeHeaderPointer = 0xF0;
+
+static std::vector<std::uint8_t> MakePeImage(
+    const FilePeSignature& signature
+) {
+  std::vector<std::uint8_t> image(
+      kPeHeaderPointer + FilePeSignature::kSignatureSize + 0x200,
+      0
+  );
+
+  image[0] = 'M';
+  image[1] = 'Z';
+  image[FilePeSignature::kPeHeaderPointerOffset] = kPeHeaderPointer;
+
+  std::copy(
+      signature.signature().cbegin(),
+      signature.signature().cend(),
+      image.begin() + kPeHeaderPointer
+  );
+
+  return image;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  std::vector<std::vector<std::uint8_t>> images;
+
+  for (const FileSignatureTableEntry& entry : kFilePeSignatureSortedTable) {
+    images.push_back(MakePeImage(entry.first));
+  }
+
+  // Half of the corpus is foreign files, which must be rejected.
+  std::mt19937 random(0xB3);
+
+  for (std::size_t i = 0; i < kFilePeSignatureSortedTable.size(); i += 1) {
+    std::vector<std::uint8_t> image = images[i];
+    image[kPeHeaderPointer + 8 + (random() % 56)] ^= 0x5A;
+    images.push_back(std::move(image));
+  }
+
+  std::shuffle(images.begin(), images.end(), random);
+
+  std::size_t iterations = ::sgd2mapi_test::GetBenchmarkIterations(
+      argc,
+      argv,
+      10000000
+  );
+
+  std::printf(
+      "%zu signatures, %zu images\n",
+      kFilePeSignatureSortedTable.size(),
+      images.size()
+  );
+
+  std::size_t image_index = 0;
+
+  double binary_search_ns = ::sgd2mapi_test::TimeBenchmark(
+      "read + binary search",
+      iterations,
+      [&]() {
+        const std::vector<std::uint8_t>& image = images[image_index];
+        image_index = (image_index + 1) % images.size();
+
+        FilePeSignature signature;
+        FilePeSignature::ReadBytes(image.data(), image.size(), &signature);
+
+        auto search_result = std::lower_bound(
+            kFilePeSignatureSortedTable.cbegin(),
+            kFilePeSignatureSortedTable.cend(),
+            signature,
+            FileSignatureTableEntryCompareKey()
+        );
+
+        const FileSignatureTableEntry* entry =
+            (search_result != kFilePeSignatureSortedTable.cend()
+                && search_result->first == signature)
+            ? &*search_result
+            : nullptr;
+
+        ::sgd2mapi_test::DoNotOptimize(entry);
+      }
+  );
+
+  image_index = 0;
+
+  double fingerprint_ns = ::sgd2mapi_test::TimeBenchmark(
+      "read + fingerprint lookup",
+      iterations,
+      [&]() {
+        const std::vector<std::uint8_t>& image = images[image_index];
+        image_index = (image_index + 1) % images.size();
+
+        FilePeSignature signature;
+        FilePeSignature::ReadBytes(image.data(), image.size(), &signature);
+
+        const FileSignatureTableEntry* entry = FindTableEntry(signature);
+
+        ::sgd2mapi_test::DoNotOptimize(entry);
+      }
+  );
+
+  if (fingerprint_ns > 0.0) {
+    std::printf("speedup: %.2fx\n", binary_search_ns / fingerprint_ns);
+  }
+
+  // Detection as the game does it, from a file on disk.
+  const char* path = "sgd2mapi_game_version_bench.tmp";
+
+  std::FILE* file = std::fopen(path, "wb");
+  std::fwrite(images[0].data(), 1, images[0].size(), file);
+  std::fclose(file);
+
+  std::wstring wide_path(path, path + std::char_traits<char>::length(path));
+
+  ::sgd2mapi_test::TimeBenchmark(
+      "map file + read + fingerprint lookup",
+      (iterations / 100) + 1,
+      [&]() {
+        const ::mapi::MappedFile mapped_file(wide_path.c_str());
+
+        FilePeSignature signature;
+        FilePeSignature::ReadBytes(
+            mapped_file.data(),
+            mapped_file.size(),
+            &signature
+        );
+
+        const FileSignatureTableEntry* entry = FindTableEntry(signature);
+
+        ::sgd2mapi_test::DoNotOptimize(entry);
+      }
+  );
+
+  std::remove(path);
+
+  return 0;
+}
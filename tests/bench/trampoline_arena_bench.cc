@@ -0,0 +1,149 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Measures stub allocation throughput of the trampoline arena, both with
+ * pages that cost nothing to allocate and with pages mapped from the
+ * process.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../../SlashGaming-Diablo-II-API/include/cxx/trampoline_arena.hpp"
+#include "../support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::mapi::TrampolineArena;
+using ::mapi::TrampolinePageProvider;
+
+class FakePageProvider : public TrampolinePageProvider {
+ public:
+  std::intptr_t AllocatePage(std::intptr_t near_address) override {
+    this->next_page_address_ += this->page_size();
+
+    return this->next_page_address_;
+  }
+
+  void FreePage(std::intptr_t page_address) override {
+  }
+
+  void FlushInstructionCache(
+      std::intptr_t address,
+      std::size_t size
+  ) override {
+  }
+
+  std::size_t page_size() const override {
+    return 4096;
+  }
+
+ private:
+  std::intptr_t next_page_address_ = 0x10000000;
+};
+
+static constexpr std::size_t kStubsPerRound = 1024;
+
+static int Target() {
+  return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  std::size_t rounds = ::sgd2mapi_test::GetBenchmarkIterations(
+      argc,
+      argv,
+      20000
+  );
+
+  // Typical hook trampolines relocate 5 to 16 bytes and add a jump back.
+  std::mt19937 random(0x9);
+  std::uniform_int_distribution<std::size_t> size_distribution(10, 53);
+  std::vector<std::size_t> sizes(kStubsPerRound);
+
+  for (std::size_t& size : sizes) {
+    size = size_distribution(random);
+  }
+
+  std::printf("%zu stubs per round, %zu rounds\n", kStubsPerRound, rounds);
+
+  FakePageProvider fake_page_provider;
+  std::intptr_t target_address = reinterpret_cast<std::intptr_t>(&Target);
+
+  double fake_ns = ::sgd2mapi_test::TimeBenchmark(
+      "allocate round, fake pages",
+      rounds,
+      [&]() {
+        TrampolineArena arena(target_address, fake_page_provider);
+
+        for (std::size_t size : sizes) {
+          ::sgd2mapi_test::DoNotOptimize(arena.Allocate(size));
+        }
+      }
+  );
+
+  std::printf("  %.2f ns per stub\n", fake_ns / kStubsPerRound);
+
+  double process_ns = ::sgd2mapi_test::TimeBenchmark(
+      "allocate round, process pages",
+      (rounds / 10) + 1,
+      [&]() {
+        TrampolineArena arena(target_address);
+
+        for (std::size_t size : sizes) {
+          ::sgd2mapi_test::DoNotOptimize(arena.Allocate(size));
+        }
+      }
+  );
+
+  std::printf("  %.2f ns per stub\n", process_ns / kStubsPerRound);
+
+  return 0;
+}
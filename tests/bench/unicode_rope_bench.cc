@@ -0,0 +1,265 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Compares assembling text with UnicodeRope against the current append
+ * path, which is the std::basic_string<UnicodeChar_1_00> that
+ * UnicodeString_Api wraps. Each run builds a string out of 8 code unit
+ * fragments, by appending, by prepending, or by inserting in the middle,
+ * and then flattens it. A fourth run trims a string from the front, as a
+ * scrolling message log would. Runs are timed for a string of 4096 code
+ * units, which is long for game text, and one of 131072 code units.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "../../SlashGaming-Diablo-II-API/include/cxx/game_struct/d2_unicode_char/d2_unicode_rope.hpp"
+#include "../support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::d2::UnicodeChar;
+using ::d2::UnicodeChar_1_00;
+using ::d2::UnicodeRope;
+using ::d2::UnicodeStringView_Api;
+
+using UnicodeString_1_00 = std::basic_string<UnicodeChar_1_00>;
+
+constexpr int kFragmentLength = 8;
+
+static UnicodeStringView_Api ToView(const UnicodeString_1_00& str) {
+  return UnicodeStringView_Api(
+      reinterpret_cast<const UnicodeChar*>(str.data()),
+      static_cast<int>(str.length())
+  );
+}
+
+static const UnicodeChar_1_00* ToActualData(UnicodeStringView_Api view) {
+  return reinterpret_cast<const UnicodeChar_1_00*>(view.data());
+}
+
+static bool RunBenchmarks(int fragment_count, std::size_t iterations) {
+  UnicodeString_1_00 fragment;
+  for (int i = 0; i < kFragmentLength; i += 1) {
+    fragment.push_back({ static_cast<std::uint16_t>(u'a' + i) });
+  }
+
+  UnicodeStringView_Api fragment_view = ToView(fragment);
+
+  std::printf(
+      "%d fragments of %d code units, %zu runs\n",
+      fragment_count,
+      kFragmentLength,
+      iterations
+  );
+
+  double string_append_ns = ::sgd2mapi_test::TimeBenchmark(
+      "append, basic_string",
+      iterations,
+      [&]() {
+        UnicodeString_1_00 str;
+
+        for (int i = 0; i < fragment_count; i += 1) {
+          str.append(fragment);
+        }
+
+        ::sgd2mapi_test::DoNotOptimize(str.c_str());
+      }
+  );
+
+  double rope_append_ns = ::sgd2mapi_test::TimeBenchmark(
+      "append, UnicodeRope",
+      iterations,
+      [&]() {
+        UnicodeRope rope;
+
+        for (int i = 0; i < fragment_count; i += 1) {
+          rope.append(fragment_view);
+        }
+
+        ::sgd2mapi_test::DoNotOptimize(ToActualData(rope.Flatten()));
+      }
+  );
+
+  double string_prepend_ns = ::sgd2mapi_test::TimeBenchmark(
+      "prepend, basic_string",
+      iterations,
+      [&]() {
+        UnicodeString_1_00 str;
+
+        for (int i = 0; i < fragment_count; i += 1) {
+          str.insert(0, fragment);
+        }
+
+        ::sgd2mapi_test::DoNotOptimize(str.c_str());
+      }
+  );
+
+  double rope_prepend_ns = ::sgd2mapi_test::TimeBenchmark(
+      "prepend, UnicodeRope",
+      iterations,
+      [&]() {
+        UnicodeRope rope;
+
+        for (int i = 0; i < fragment_count; i += 1) {
+          rope.prepend(fragment_view);
+        }
+
+        ::sgd2mapi_test::DoNotOptimize(ToActualData(rope.Flatten()));
+      }
+  );
+
+  double string_insert_ns = ::sgd2mapi_test::TimeBenchmark(
+      "insert in the middle, basic_string",
+      iterations,
+      [&]() {
+        UnicodeString_1_00 str;
+
+        for (int i = 0; i < fragment_count; i += 1) {
+          str.insert(str.length() / 2, fragment);
+        }
+
+        ::sgd2mapi_test::DoNotOptimize(str.c_str());
+      }
+  );
+
+  double rope_insert_ns = ::sgd2mapi_test::TimeBenchmark(
+      "insert in the middle, UnicodeRope",
+      iterations,
+      [&]() {
+        UnicodeRope rope;
+
+        for (int i = 0; i < fragment_count; i += 1) {
+          rope.insert(rope.length() / 2, fragment_view);
+        }
+
+        ::sgd2mapi_test::DoNotOptimize(ToActualData(rope.Flatten()));
+      }
+  );
+
+  UnicodeString_1_00 full_string;
+  for (int i = 0; i < fragment_count; i += 1) {
+    full_string.append(fragment);
+  }
+
+  double string_trim_ns = ::sgd2mapi_test::TimeBenchmark(
+      "trim the front, basic_string",
+      iterations,
+      [&]() {
+        UnicodeString_1_00 str = full_string;
+
+        while (!str.empty()) {
+          str.erase(0, kFragmentLength);
+          ::sgd2mapi_test::DoNotOptimize(str.c_str());
+        }
+      }
+  );
+
+  double rope_trim_ns = ::sgd2mapi_test::TimeBenchmark(
+      "trim the front, UnicodeRope",
+      iterations,
+      [&]() {
+        UnicodeRope rope(ToView(full_string));
+
+        while (!rope.empty()) {
+          rope.erase(0, kFragmentLength);
+          ::sgd2mapi_test::DoNotOptimize(rope);
+        }
+      }
+  );
+
+  bool is_equal = true;
+  {
+    UnicodeRope rope;
+    UnicodeString_1_00 str;
+
+    for (int i = 0; i < fragment_count; i += 1) {
+      rope.insert(rope.length() / 2, fragment_view);
+      str.insert(str.length() / 2, fragment);
+    }
+
+    UnicodeStringView_Api flat = rope.Flatten();
+    is_equal = (UnicodeString_1_00(ToActualData(flat), flat.length()) == str);
+  }
+
+  if (rope_append_ns > 0.0
+      && rope_prepend_ns > 0.0
+      && rope_insert_ns > 0.0
+      && rope_trim_ns > 0.0) {
+    std::printf(
+        "speedup: append %.2fx, prepend %.2fx, insert %.2fx, trim %.2fx\n",
+        string_append_ns / rope_append_ns,
+        string_prepend_ns / rope_prepend_ns,
+        string_insert_ns / rope_insert_ns,
+        string_trim_ns / rope_trim_ns
+    );
+  }
+
+  return is_equal;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  // Both sizes build about the same total amount of text.
+  std::size_t short_iterations = ::sgd2mapi_test::GetBenchmarkIterations(
+      argc,
+      argv,
+      2000
+  );
+  std::size_t long_iterations = ::sgd2mapi_test::GetBenchmarkIterations(
+      argc,
+      argv,
+      60
+  );
+
+  bool is_equal = RunBenchmarks(512, short_iterations)
+      && RunBenchmarks(16384, long_iterations);
+
+  return is_equal ? 0 : 1;
+}
@@ -0,0 +1,233 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Compares reaching the storage of UnicodeString_Api and
+ * UnicodeStringView_Api through std::visit, as before, against the
+ * direct get_if access that replaced it. Each benchmark iterates over
+ * every character of a string, or appends a character to a string,
+ * through a single-alternative variant like ApiVariant.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <variant>
+
+#include "../../SlashGaming-Diablo-II-API/include/cxx/game_struct/d2_unicode_char/d2_unicode_char_struct.hpp"
+#include "../support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::d2::UnicodeChar_1_00;
+
+using StringVariant = std::variant<std::basic_string<UnicodeChar_1_00>>;
+using ViewVariant = std::variant<std::basic_string_view<UnicodeChar_1_00>>;
+
+constexpr std::size_t kStringLength = 256;
+
+template <typename Variant>
+static std::size_t SizeByVisit(const Variant& str) {
+  return std::visit([](const auto& actual_str) {
+    return actual_str.size();
+  }, str);
+}
+
+template <typename Variant>
+static const UnicodeChar_1_00& AtByVisit(
+    const Variant& str,
+    std::size_t pos
+) {
+  return std::visit([pos](const auto& actual_str)
+      -> const UnicodeChar_1_00& {
+    return actual_str[pos];
+  }, str);
+}
+
+template <typename Variant>
+static const auto& GetActualString(const Variant& str) noexcept {
+  return *std::get_if<0>(&str);
+}
+
+template <typename Variant>
+static std::uint32_t SumByVisit(const Variant& str) {
+  std::uint32_t sum = 0;
+
+  for (std::size_t i = 0; i < SizeByVisit(str); i += 1) {
+    sum += AtByVisit(str, i).ch;
+  }
+
+  return sum;
+}
+
+template <typename Variant>
+static std::uint32_t SumByGetIf(const Variant& str) {
+  std::uint32_t sum = 0;
+
+  for (std::size_t i = 0; i < GetActualString(str).size(); i += 1) {
+    sum += GetActualString(str)[i].ch;
+  }
+
+  return sum;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  std::basic_string<UnicodeChar_1_00> source;
+
+  for (std::size_t i = 0; i < kStringLength; i += 1) {
+    source.push_back({ static_cast<std::uint16_t>(u'a' + (i % 26)) });
+  }
+
+  StringVariant str(source);
+  ViewVariant view(std::get<0>(str));
+
+  std::size_t iterations = ::sgd2mapi_test::GetBenchmarkIterations(
+      argc,
+      argv,
+      1000000
+  );
+
+  std::printf(
+      "%zu characters per string, %zu iterations\n",
+      kStringLength,
+      iterations
+  );
+
+  bool is_sums_equal = (SumByVisit(str) == SumByGetIf(str))
+      && (SumByVisit(view) == SumByGetIf(view));
+
+  double string_visit_ns = ::sgd2mapi_test::TimeBenchmark(
+      "UnicodeString iterate, std::visit",
+      iterations,
+      [&]() {
+        ::sgd2mapi_test::DoNotOptimize(str);
+        ::sgd2mapi_test::DoNotOptimize(SumByVisit(str));
+      }
+  );
+
+  double string_get_if_ns = ::sgd2mapi_test::TimeBenchmark(
+      "UnicodeString iterate, get_if",
+      iterations,
+      [&]() {
+        ::sgd2mapi_test::DoNotOptimize(str);
+        ::sgd2mapi_test::DoNotOptimize(SumByGetIf(str));
+      }
+  );
+
+  double view_visit_ns = ::sgd2mapi_test::TimeBenchmark(
+      "UnicodeStringView iterate, std::visit",
+      iterations,
+      [&]() {
+        ::sgd2mapi_test::DoNotOptimize(view);
+        ::sgd2mapi_test::DoNotOptimize(SumByVisit(view));
+      }
+  );
+
+  double view_get_if_ns = ::sgd2mapi_test::TimeBenchmark(
+      "UnicodeStringView iterate, get_if",
+      iterations,
+      [&]() {
+        ::sgd2mapi_test::DoNotOptimize(view);
+        ::sgd2mapi_test::DoNotOptimize(SumByGetIf(view));
+      }
+  );
+
+  // Appends until the string reaches the length, then starts over, so
+  // that the capacity stays allocated and only the append is measured.
+  StringVariant append_str;
+  std::get<0>(append_str).reserve(kStringLength);
+
+  double append_visit_ns = ::sgd2mapi_test::TimeBenchmark(
+      "UnicodeString append, std::visit",
+      iterations * kStringLength,
+      [&]() {
+        std::visit([](auto& actual_str) {
+          if (actual_str.size() == kStringLength) {
+            actual_str.clear();
+          }
+
+          actual_str.push_back({ u'a' });
+        }, append_str);
+
+        ::sgd2mapi_test::DoNotOptimize(append_str);
+      }
+  );
+
+  std::get<0>(append_str).clear();
+
+  double append_get_if_ns = ::sgd2mapi_test::TimeBenchmark(
+      "UnicodeString append, get_if",
+      iterations * kStringLength,
+      [&]() {
+        auto& actual_str = *std::get_if<0>(&append_str);
+
+        if (actual_str.size() == kStringLength) {
+          actual_str.clear();
+        }
+
+        actual_str.push_back({ u'a' });
+
+        ::sgd2mapi_test::DoNotOptimize(append_str);
+      }
+  );
+
+  if (string_get_if_ns > 0.0
+      && view_get_if_ns > 0.0
+      && append_get_if_ns > 0.0) {
+    std::printf(
+        "speedup: string iterate %.2fx, view iterate %.2fx, "
+            "append %.2fx\n",
+        string_visit_ns / string_get_if_ns,
+        view_visit_ns / view_get_if_ns,
+        append_visit_ns / append_get_if_ns
+    );
+  }
+
+  return is_sums_equal ? 0 : 1;
+}
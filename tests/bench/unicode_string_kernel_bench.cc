@@ -0,0 +1,231 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Compares the Unicode string kernels against the scalar loops they
+ * replaced, over strings of several lengths. The strncmp baseline is the
+ * reconstructed 1.00 Unicode_strncmp.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+#include "../../SlashGaming-Diablo-II-API/src/cxx/backend/unicode_string_kernel.hpp"
+#include "../support/sgd2mapi_test.hpp"
+
+namespace {
+
+constexpr std::size_t kLengths[] = { 4, 16, 64, 256, 1024 };
+
+static int ScalarStrncmp(
+    const std::uint16_t* str1,
+    const std::uint16_t* str2,
+    std::size_t count
+) {
+  for (std::size_t i = 0; i < count; i += 1) {
+    int diff = str1[i] - str2[i];
+
+    if (diff != 0) {
+      return diff;
+    }
+
+    if (str1[i] == u'\0') {
+      return 0;
+    }
+  }
+
+  return 0;
+}
+
+static std::size_t ScalarStrlen(const std::uint16_t* str) {
+  std::size_t length = 0;
+
+  while (str[length] != 0) {
+    length += 1;
+  }
+
+  return length;
+}
+
+static void ScalarToLower(
+    const std::uint16_t* src,
+    std::uint16_t* dest,
+    std::size_t count
+) {
+  for (std::size_t i = 0; i < count; i += 1) {
+    std::uint16_t ch = src[i];
+
+    if ((ch >= u'A' && ch <= u'Z')
+        || (ch >= 0xC0 && ch <= 0xDE && ch != 0xD7)) {
+      ch += 0x20;
+    }
+
+    dest[i] = ch;
+  }
+}
+
+/**
+ * Makes a string of mixed case text with Latin-1 letters.
+ */
+static std::vector<std::uint16_t> MakeString(std::size_t length) {
+  static constexpr char16_t kText[] = u"The Stone of Jordan ÉÀ àé ";
+
+  std::vector<std::uint16_t> str;
+
+  for (std::size_t i = 0; i < length; i += 1) {
+    str.push_back(kText[i % (std::size(kText) - 1)]);
+  }
+
+  str.push_back(0);
+
+  return str;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  std::size_t iterations = ::sgd2mapi_test::GetBenchmarkIterations(
+      argc,
+      argv,
+      1000000
+  );
+
+  std::printf("%zu calls per length\n", iterations);
+
+  bool is_results_equal = true;
+
+  for (std::size_t length : kLengths) {
+    // Equal strings, so that every code unit is compared.
+    std::vector<std::uint16_t> str1 = MakeString(length);
+    std::vector<std::uint16_t> str2 = str1;
+    std::vector<std::uint16_t> dest(length + 1);
+
+    constexpr std::size_t kNoLimit = std::numeric_limits<std::size_t>::max();
+
+    is_results_equal = is_results_equal
+        && (ScalarStrncmp(str1.data(), str2.data(), kNoLimit)
+            == ::mapi::UnicodeStrncmp(str1.data(), str2.data(), kNoLimit))
+        && (ScalarStrlen(str1.data())
+            == ::mapi::UnicodeStrlen(str1.data()));
+
+    std::printf("length %zu\n", length);
+
+    double scalar_strncmp_ns = ::sgd2mapi_test::TimeBenchmark(
+        "  strncmp, scalar",
+        iterations,
+        [&]() {
+          ::sgd2mapi_test::DoNotOptimize(str1);
+          ::sgd2mapi_test::DoNotOptimize(
+              ScalarStrncmp(str1.data(), str2.data(), kNoLimit)
+          );
+        }
+    );
+
+    double kernel_strncmp_ns = ::sgd2mapi_test::TimeBenchmark(
+        "  strncmp, UnicodeStrncmp",
+        iterations,
+        [&]() {
+          ::sgd2mapi_test::DoNotOptimize(str1);
+          ::sgd2mapi_test::DoNotOptimize(
+              ::mapi::UnicodeStrncmp(str1.data(), str2.data(), kNoLimit)
+          );
+        }
+    );
+
+    double scalar_strlen_ns = ::sgd2mapi_test::TimeBenchmark(
+        "  strlen, scalar",
+        iterations,
+        [&]() {
+          ::sgd2mapi_test::DoNotOptimize(str1);
+          ::sgd2mapi_test::DoNotOptimize(ScalarStrlen(str1.data()));
+        }
+    );
+
+    double kernel_strlen_ns = ::sgd2mapi_test::TimeBenchmark(
+        "  strlen, UnicodeStrlen",
+        iterations,
+        [&]() {
+          ::sgd2mapi_test::DoNotOptimize(str1);
+          ::sgd2mapi_test::DoNotOptimize(::mapi::UnicodeStrlen(str1.data()));
+        }
+    );
+
+    double scalar_to_lower_ns = ::sgd2mapi_test::TimeBenchmark(
+        "  tolower, scalar",
+        iterations,
+        [&]() {
+          ::sgd2mapi_test::DoNotOptimize(str1);
+          ScalarToLower(str1.data(), dest.data(), length);
+          ::sgd2mapi_test::DoNotOptimize(dest);
+        }
+    );
+
+    double kernel_to_lower_ns = ::sgd2mapi_test::TimeBenchmark(
+        "  tolower, UnicodeToLower",
+        iterations,
+        [&]() {
+          ::sgd2mapi_test::DoNotOptimize(str1);
+          ::mapi::UnicodeToLower(str1.data(), dest.data(), length);
+          ::sgd2mapi_test::DoNotOptimize(dest);
+        }
+    );
+
+    if (kernel_strncmp_ns > 0.0
+        && kernel_strlen_ns > 0.0
+        && kernel_to_lower_ns > 0.0) {
+      std::printf(
+          "  speedup: strncmp %.2fx, strlen %.2fx, tolower %.2fx\n",
+          scalar_strncmp_ns / kernel_strncmp_ns,
+          scalar_strlen_ns / kernel_strlen_ns,
+          scalar_to_lower_ns / kernel_to_lower_ns
+      );
+    }
+  }
+
+  return is_results_equal ? 0 : 1;
+}
@@ -0,0 +1,170 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Compares VersionDispatch against the if-else chain on the running
+ * game version that the generic wrappers used before. The chain calls a
+ * stand-in for game_version::GetRunning that, like the real one, reads
+ * a function-local static. Both forward to the same three stand-in
+ * implementations, which do not reach the game.
+ */
+
+#include <cstddef>
+#include <cstdio>
+
+#include "../../SlashGaming-Diablo-II-API/src/cxx/backend/game_function/version_dispatch.hpp"
+#include "../support/game_version_stub.hpp"
+#include "../support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::d2::GameVersion;
+
+[[gnu::noinline]] static int GetValue_1_00(int value) {
+  return value + 100;
+}
+
+[[gnu::noinline]] static int GetValue_1_07(int value) {
+  return value + 107;
+}
+
+[[gnu::noinline]] static int GetValue_1_14A(int value) {
+  return value + 114;
+}
+
+[[gnu::noinline]] static GameVersion GetRunningGameVersion() {
+  static GameVersion running_game_version =
+      ::d2::game_version::GetRunning();
+
+  return running_game_version;
+}
+
+[[gnu::noinline]] static int GetValueByBranch(int value) {
+  GameVersion running_game_version = GetRunningGameVersion();
+
+  if (running_game_version <= GameVersion::k1_06B) {
+    return GetValue_1_00(value);
+  } else if (running_game_version <= GameVersion::k1_13D) {
+    return GetValue_1_07(value);
+  } else /* if (running_game_version >= GameVersion::kClassic1_14A) */ {
+    return GetValue_1_14A(value);
+  }
+}
+
+struct GetValueDispatchTable {
+  using Function = int(int);
+
+  static constexpr ::mapi::VersionedFunction<Function> kFunctions[] = {
+      { GameVersion::kBeta1_02, GameVersion::k1_06B, &GetValue_1_00 },
+      { GameVersion::k1_07Beta, GameVersion::k1_13D, &GetValue_1_07 },
+      {
+          GameVersion::kClassic1_14A,
+          GameVersion::kLod1_14D,
+          &GetValue_1_14A
+      }
+  };
+};
+
+using GetValueDispatch = ::mapi::VersionDispatch<GetValueDispatchTable>;
+
+[[gnu::noinline]] static int GetValueByDispatch(int value) {
+  return GetValueDispatch::Call(value);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  ::sgd2mapi_test::SetRunningGameVersion(GameVersion::k1_13C);
+
+  std::size_t iterations = ::sgd2mapi_test::GetBenchmarkIterations(
+      argc,
+      argv,
+      100000000
+  );
+
+  std::printf("%zu calls\n", iterations);
+
+  bool is_equal = (GetValueByBranch(1) == GetValueByDispatch(1))
+      && (GetValueByDispatch(1) == 108);
+
+  int value = 0;
+
+  double direct_ns = ::sgd2mapi_test::TimeBenchmark(
+      "direct call, for reference",
+      iterations,
+      [&]() {
+        ::sgd2mapi_test::DoNotOptimize(value);
+        value = GetValue_1_07(value) & 0xFF;
+      }
+  );
+
+  double branch_ns = ::sgd2mapi_test::TimeBenchmark(
+      "if-else chain on GetRunning",
+      iterations,
+      [&]() {
+        ::sgd2mapi_test::DoNotOptimize(value);
+        value = GetValueByBranch(value) & 0xFF;
+      }
+  );
+
+  double dispatch_ns = ::sgd2mapi_test::TimeBenchmark(
+      "VersionDispatch",
+      iterations,
+      [&]() {
+        ::sgd2mapi_test::DoNotOptimize(value);
+        value = GetValueByDispatch(value) & 0xFF;
+      }
+  );
+
+  if (dispatch_ns > 0.0) {
+    std::printf(
+        "speedup: %.2fx, overhead over a direct call: %.2f ns\n",
+        branch_ns / dispatch_ns,
+        dispatch_ns - direct_ns
+    );
+  }
+
+  return is_equal ? 0 : 1;
+}
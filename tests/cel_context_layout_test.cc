@@ -0,0 +1,241 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Reads and writes CelContext fields through each version's layout on a
+ * plain byte buffer, and checks which layout each game version selects.
+ * The layouts are built from the game structs, which hold 32-bit
+ * pointers, so this test is only built for x86-32.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <array>
+
+#include "../SlashGaming-Diablo-II-API/include/cxx/game_struct/d2_cel_context/d2_cel_context_layout.hpp"
+#include "support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::d2::CelContextLayout;
+using ::d2::CelFile;
+using ::d2::GameVersion;
+
+static constexpr std::size_t kCelContextSize = 0x48;
+static constexpr std::uint8_t kFillByte = 0xCC;
+
+/**
+ * The offsets of a version's fields, as documented in the game struct.
+ */
+struct ExpectedOffsets {
+  const CelContextLayout* layout;
+  std::size_t cel_file;
+  std::size_t frame_index;
+  std::size_t direction_index;
+};
+
+static constexpr ExpectedOffsets kExpectedOffsets[] = {
+    { &::d2::kCelContextLayout_1_00, 0x04, 0x08, 0x0C },
+    { &::d2::kCelContextLayout_1_12A, 0x3C, 0x40, 0x38 },
+    { &::d2::kCelContextLayout_1_13C, 0x34, 0x00, 0x40 },
+};
+
+using CelContextBuffer = std::array<std::uint8_t, kCelContextSize>;
+
+static std::uint32_t ReadUint32At(
+    const CelContextBuffer& buffer,
+    std::size_t offset
+) {
+  std::uint32_t value = 0;
+
+  for (std::size_t i = 0; i < sizeof(value); i += 1) {
+    value |= static_cast<std::uint32_t>(buffer[offset + i]) << (i * 8);
+  }
+
+  return value;
+}
+
+static void WriteUint32At(
+    CelContextBuffer& buffer,
+    std::size_t offset,
+    std::uint32_t value
+) {
+  for (std::size_t i = 0; i < sizeof(value); i += 1) {
+    buffer[offset + i] = static_cast<std::uint8_t>(value >> (i * 8));
+  }
+}
+
+static bool IsFieldByte(const ExpectedOffsets& expected, std::size_t i) {
+  return (i >= expected.cel_file && i < expected.cel_file + 4)
+      || (i >= expected.frame_index && i < expected.frame_index + 4)
+      || (i >= expected.direction_index && i < expected.direction_index + 4);
+}
+
+static void TestFieldsAreWrittenAtTheirOffsets() {
+  for (const ExpectedOffsets& expected : kExpectedOffsets) {
+    const CelContextLayout& layout = *expected.layout;
+
+    CHECK_EQ(kCelContextSize, layout.size);
+
+    CelContextBuffer buffer;
+    buffer.fill(kFillByte);
+
+    CelFile* cel_file = reinterpret_cast<CelFile*>(0x12345678);
+    layout.cel_file.Write(buffer.data(), cel_file);
+    layout.frame_index.Write(buffer.data(), 0x0A0B0C0D);
+    layout.direction_index.Write(buffer.data(), 0x01020304);
+
+    CHECK_EQ(0x12345678u, ReadUint32At(buffer, expected.cel_file));
+    CHECK_EQ(0x0A0B0C0Du, ReadUint32At(buffer, expected.frame_index));
+    CHECK_EQ(0x01020304u, ReadUint32At(buffer, expected.direction_index));
+
+    // No other byte of the struct is touched.
+    for (std::size_t i = 0; i < buffer.size(); i += 1) {
+      if (!IsFieldByte(expected, i)) {
+        CHECK_EQ(kFillByte, buffer[i]);
+      }
+    }
+
+    CHECK(layout.cel_file.Read(buffer.data()) == cel_file);
+    CHECK_EQ(0x0A0B0C0Du, layout.frame_index.Read(buffer.data()));
+    CHECK_EQ(0x01020304u, layout.direction_index.Read(buffer.data()));
+  }
+}
+
+static void TestFieldsAreReadFromTheirOffsets() {
+  for (const ExpectedOffsets& expected : kExpectedOffsets) {
+    const CelContextLayout& layout = *expected.layout;
+
+    CelContextBuffer buffer;
+    buffer.fill(kFillByte);
+
+    WriteUint32At(buffer, expected.cel_file, 0x00400000);
+    WriteUint32At(buffer, expected.frame_index, 7);
+    WriteUint32At(buffer, expected.direction_index, 3);
+
+    CHECK(layout.cel_file.Read(buffer.data())
+        == reinterpret_cast<CelFile*>(0x00400000));
+    CHECK_EQ(7u, layout.frame_index.Read(buffer.data()));
+    CHECK_EQ(3u, layout.direction_index.Read(buffer.data()));
+
+    // Fields are read from unaligned structs too, as in packed arrays.
+    std::array<std::uint8_t, kCelContextSize + 1> unaligned_buffer;
+    unaligned_buffer[0] = kFillByte;
+    std::copy(buffer.cbegin(), buffer.cend(), unaligned_buffer.begin() + 1);
+
+    CHECK_EQ(7u, layout.frame_index.Read(&unaligned_buffer[1]));
+    CHECK_EQ(3u, layout.direction_index.Read(&unaligned_buffer[1]));
+  }
+}
+
+static const CelContextLayout* ExpectedLayout(GameVersion game_version) {
+  if (game_version <= GameVersion::k1_10) {
+    return &::d2::kCelContextLayout_1_00;
+  }
+
+  if (game_version == GameVersion::k1_12A) {
+    return &::d2::kCelContextLayout_1_12A;
+  }
+
+  return &::d2::kCelContextLayout_1_13C;
+}
+
+static void TestEveryVersionSelectsItsLayout() {
+  for (int i = static_cast<int>(GameVersion::kBeta1_02);
+      i <= static_cast<int>(GameVersion::kLod1_14D);
+      i += 1) {
+    GameVersion game_version = static_cast<GameVersion>(i);
+
+    const CelContextLayout* layout = ::mapi::FindStructLayout(
+        ::d2::kCelContextLayouts,
+        game_version
+    );
+
+    CHECK(layout != nullptr);
+    CHECK_EQ(ExpectedLayout(game_version), layout);
+  }
+
+  // The boundaries of each range.
+  CHECK_EQ(
+      &::d2::kCelContextLayout_1_00,
+      ::mapi::FindStructLayout(::d2::kCelContextLayouts, GameVersion::k1_10)
+  );
+  CHECK_EQ(
+      &::d2::kCelContextLayout_1_13C,
+      ::mapi::FindStructLayout(::d2::kCelContextLayouts, GameVersion::k1_11B)
+  );
+  CHECK_EQ(
+      &::d2::kCelContextLayout_1_12A,
+      ::mapi::FindStructLayout(::d2::kCelContextLayouts, GameVersion::k1_12A)
+  );
+  CHECK_EQ(
+      &::d2::kCelContextLayout_1_13C,
+      ::mapi::FindStructLayout(
+          ::d2::kCelContextLayouts,
+          GameVersion::k1_13ABeta
+      )
+  );
+
+  // A version past every range has no layout.
+  CHECK(
+      ::mapi::FindStructLayout(
+          ::d2::kCelContextLayouts,
+          static_cast<GameVersion>(
+              static_cast<int>(GameVersion::kLod1_14D) + 1
+          )
+      ) == nullptr
+  );
+}
+
+} // namespace
+
+int main() {
+  TestFieldsAreWrittenAtTheirOffsets();
+  TestFieldsAreReadFromTheirOffsets();
+  TestEveryVersionSelectsItsLayout();
+
+  return ::sgd2mapi_test::GetExitCode();
+}
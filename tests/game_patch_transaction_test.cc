@@ -0,0 +1,396 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Commits game patch transactions to a fake memory that records every
+ * operation, and checks that single patches share the transactions'
+ * bookkeeping of applied ranges.
+ */
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "../SlashGaming-Diablo-II-API/include/cxx/game_patch.hpp"
+#include "../SlashGaming-Diablo-II-API/include/cxx/game_patch_transaction.hpp"
+#include "support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::mapi::GameAddress;
+using ::mapi::GamePatch;
+using ::mapi::GamePatchMemory;
+using ::mapi::GamePatchTransaction;
+
+static constexpr std::size_t kFakePageSize = 64;
+static constexpr std::uint32_t kFakeOldProtection = 0x20;
+
+struct MemoryRange {
+  std::intptr_t address;
+  std::size_t size;
+};
+
+/**
+ * Writes to ordinary memory, and records every page protection change,
+ * write, and flush. A page can be set to refuse to become writable.
+ */
+class FakePatchMemory : public GamePatchMemory {
+ public:
+  FakePatchMemory()
+      : refused_page_address_(0) {
+  }
+
+  bool MakePageWritable(
+      std::intptr_t page_address,
+      std::uint32_t* old_protection
+  ) override {
+    if (page_address == this->refused_page_address_) {
+      return false;
+    }
+
+    *old_protection = kFakeOldProtection;
+    this->writable_pages_.push_back(page_address);
+
+    return true;
+  }
+
+  bool RestorePageProtection(
+      std::intptr_t page_address,
+      std::uint32_t old_protection
+  ) override {
+    CHECK_EQ(kFakeOldProtection, old_protection);
+    this->restored_pages_.push_back(page_address);
+
+    return true;
+  }
+
+  void Write(
+      std::intptr_t address,
+      const std::uint8_t* buffer,
+      std::size_t size
+  ) override {
+    std::copy_n(buffer, size, reinterpret_cast<std::uint8_t*>(address));
+    this->writes_.push_back({ address, size });
+  }
+
+  void FlushInstructionCache(
+      std::intptr_t address,
+      std::size_t size
+  ) override {
+    this->flushes_.push_back({ address, size });
+  }
+
+  std::size_t page_size() const override {
+    return kFakePageSize;
+  }
+
+  void ClearRecords() {
+    this->writable_pages_.clear();
+    this->restored_pages_.clear();
+    this->writes_.clear();
+    this->flushes_.clear();
+  }
+
+  void set_refused_page_address(std::intptr_t page_address) noexcept {
+    this->refused_page_address_ = page_address;
+  }
+
+  const std::vector<std::intptr_t>& writable_pages() const noexcept {
+    return this->writable_pages_;
+  }
+
+  const std::vector<std::intptr_t>& restored_pages() const noexcept {
+    return this->restored_pages_;
+  }
+
+  const std::vector<MemoryRange>& writes() const noexcept {
+    return this->writes_;
+  }
+
+  const std::vector<MemoryRange>& flushes() const noexcept {
+    return this->flushes_;
+  }
+
+ private:
+  std::intptr_t refused_page_address_;
+
+  std::vector<std::intptr_t> writable_pages_;
+  std::vector<std::intptr_t> restored_pages_;
+  std::vector<MemoryRange> writes_;
+  std::vector<MemoryRange> flushes_;
+};
+
+/**
+ * Four fake pages of memory, filled with a known pattern.
+ */
+struct alignas(kFakePageSize) FakeImage {
+  std::array<std::uint8_t, kFakePageSize * 4> bytes;
+
+  FakeImage() {
+    for (std::size_t i = 0; i < this->bytes.size(); i += 1) {
+      this->bytes[i] = static_cast<std::uint8_t>(i);
+    }
+  }
+
+  std::intptr_t address(std::size_t offset) const noexcept {
+    return reinterpret_cast<std::intptr_t>(this->bytes.data() + offset);
+  }
+
+  bool IsUnpatched() const noexcept {
+    for (std::size_t i = 0; i < this->bytes.size(); i += 1) {
+      if (this->bytes[i] != static_cast<std::uint8_t>(i)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+};
+
+static GamePatch MakeFillPatch(
+    std::intptr_t address,
+    std::size_t size,
+    std::uint8_t value
+) {
+  std::vector<std::uint8_t> buffer(size, value);
+
+  return GamePatch::MakeGameBufferPatch(
+      GameAddress::FromOffset(L"", address),
+      buffer.data(),
+      buffer.size()
+  );
+}
+
+static void TestAdjacentAndOverlappingPatchesMerge() {
+  FakeImage image;
+  FakePatchMemory memory;
+
+  // Bytes 0 to 11 are one run: two adjacent patches, and one that
+  // overlaps both with equal values. Bytes 100 to 103 are a second run,
+  // on the second page.
+  GamePatch patch1 = MakeFillPatch(image.address(0), 4, 0xAA);
+  GamePatch patch2 = MakeFillPatch(image.address(4), 8, 0xAA);
+  GamePatch patch3 = MakeFillPatch(image.address(2), 4, 0xAA);
+  GamePatch patch4 = MakeFillPatch(image.address(100), 4, 0xBB);
+
+  GamePatchTransaction transaction(memory);
+  transaction.Add(&patch4);
+  transaction.Add(&patch1);
+  transaction.Add(&patch3);
+  transaction.Add(&patch2);
+
+  CHECK(transaction.Apply());
+
+  CHECK_EQ(2u, memory.writes().size());
+  CHECK_EQ(image.address(0), memory.writes()[0].address);
+  CHECK_EQ(12u, memory.writes()[0].size);
+  CHECK_EQ(image.address(100), memory.writes()[1].address);
+  CHECK_EQ(4u, memory.writes()[1].size);
+
+  CHECK_EQ(2u, memory.flushes().size());
+
+  // Each page is made writable once, and restored once.
+  CHECK_EQ(2u, memory.writable_pages().size());
+  CHECK_EQ(image.address(0), memory.writable_pages()[0]);
+  CHECK_EQ(image.address(kFakePageSize), memory.writable_pages()[1]);
+  CHECK(memory.restored_pages() == memory.writable_pages());
+
+  CHECK_EQ(0xAA, image.bytes[0]);
+  CHECK_EQ(0xAA, image.bytes[11]);
+  CHECK_EQ(12, image.bytes[12]);
+  CHECK_EQ(0xBB, image.bytes[103]);
+
+  // Applying again writes nothing, since every patch is applied.
+  memory.ClearRecords();
+  CHECK(transaction.Apply());
+  CHECK(memory.writes().empty());
+
+  CHECK(transaction.Remove());
+  CHECK_EQ(2u, memory.writes().size());
+  CHECK(image.IsUnpatched());
+}
+
+static void TestConflictingPatchesAreRejected() {
+  FakeImage image;
+  FakePatchMemory memory;
+
+  GamePatch patch1 = MakeFillPatch(image.address(10), 4, 0xAA);
+  GamePatch patch2 = MakeFillPatch(image.address(12), 4, 0xBB);
+
+  GamePatchTransaction transaction(memory);
+  transaction.Add(&patch1);
+  transaction.Add(&patch2);
+
+  CHECK(!transaction.Apply());
+  CHECK(memory.writable_pages().empty());
+  CHECK(memory.writes().empty());
+  CHECK(image.IsUnpatched());
+}
+
+static void TestOverlapWithAppliedPatchIsRejected() {
+  FakeImage image;
+  FakePatchMemory memory;
+
+  GamePatch patch1 = MakeFillPatch(image.address(10), 4, 0xAA);
+  GamePatch patch2 = MakeFillPatch(image.address(12), 4, 0xAA);
+
+  GamePatchTransaction transaction1(memory);
+  transaction1.Add(&patch1);
+
+  GamePatchTransaction transaction2(memory);
+  transaction2.Add(&patch2);
+
+  CHECK(transaction1.Apply());
+
+  // Equal values do not matter: removing either patch would restore the
+  // other's bytes.
+  memory.ClearRecords();
+  CHECK(!transaction2.Apply());
+  CHECK(memory.writes().empty());
+
+  // Once the first patch is removed, its range is free again.
+  CHECK(transaction1.Remove());
+  CHECK(transaction2.Apply());
+  CHECK_EQ(0xAA, image.bytes[15]);
+  CHECK_EQ(11, image.bytes[11]);
+
+  CHECK(transaction2.Remove());
+  CHECK(image.IsUnpatched());
+}
+
+static void TestRefusedPageRollsBack() {
+  FakeImage image;
+  FakePatchMemory memory;
+
+  GamePatch patch1 = MakeFillPatch(image.address(0), 4, 0xAA);
+  GamePatch patch2 = MakeFillPatch(image.address(kFakePageSize * 2), 4, 0xBB);
+
+  GamePatchTransaction transaction(memory);
+  transaction.Add(&patch1);
+  transaction.Add(&patch2);
+
+  memory.set_refused_page_address(image.address(kFakePageSize * 2));
+
+  CHECK(!transaction.Apply());
+  CHECK(memory.writes().empty());
+  CHECK(memory.flushes().empty());
+  CHECK(image.IsUnpatched());
+
+  // The page made writable before the refusal is restored.
+  CHECK_EQ(1u, memory.writable_pages().size());
+  CHECK(memory.restored_pages() == memory.writable_pages());
+
+  // Neither patch was marked as applied, so both apply once the page is
+  // accepted, and the failed commit left no ranges behind.
+  memory.set_refused_page_address(0);
+  memory.ClearRecords();
+
+  CHECK(transaction.Apply());
+  CHECK_EQ(2u, memory.writes().size());
+
+  CHECK(transaction.Remove());
+  CHECK(image.IsUnpatched());
+}
+
+static void TestSinglePatchesShareAppliedRanges() {
+  std::size_t page_size = sysconf(_SC_PAGESIZE);
+
+  void* page = mmap(
+      nullptr,
+      page_size,
+      PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_ANONYMOUS,
+      -1,
+      0
+  );
+
+  CHECK(page != MAP_FAILED);
+  if (page == MAP_FAILED) {
+    return;
+  }
+
+  std::uint8_t* bytes = static_cast<std::uint8_t*>(page);
+  std::intptr_t address = reinterpret_cast<std::intptr_t>(page);
+
+  GamePatch single_patch = MakeFillPatch(address + 8, 4, 0xCC);
+  GamePatch transaction_patch = MakeFillPatch(address + 10, 4, 0xDD);
+
+  GamePatchTransaction transaction;
+  transaction.Add(&transaction_patch);
+
+  // A patch applied on its own blocks an overlapping transaction...
+  single_patch.Apply();
+  CHECK_EQ(0xCC, bytes[8]);
+  CHECK(!transaction.Apply());
+  CHECK_EQ(0xCC, bytes[11]);
+
+  // ...and stops blocking it once it is removed on its own.
+  single_patch.Remove();
+  CHECK_EQ(0, bytes[8]);
+  CHECK(transaction.Apply());
+  CHECK_EQ(0xDD, bytes[10]);
+
+  CHECK(transaction.Remove());
+  CHECK_EQ(0, bytes[10]);
+
+  munmap(page, page_size);
+}
+
+} // namespace
+
+int main() {
+  TestAdjacentAndOverlappingPatchesMerge();
+  TestConflictingPatchesAreRejected();
+  TestOverlapWithAppliedPatchIsRejected();
+  TestRefusedPageRollsBack();
+  TestSinglePatchesShareAppliedRanges();
+
+  return ::sgd2mapi_test::GetExitCode();
+}
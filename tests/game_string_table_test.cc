@@ -0,0 +1,272 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Interns strings from a fake source and checks when the source is
+ * called, how lookups are counted, how languages are kept apart, and
+ * how much memory the table reports.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "../SlashGaming-Diablo-II-API/include/cxx/helper/d2_game_string_table.hpp"
+#include "support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::d2::GameStringSource;
+using ::d2::GameStringTable;
+using ::d2::TextFont;
+using ::d2::UnicodeChar;
+using ::d2::UnicodeStringView_Api;
+
+/**
+ * Returns "<language>:<id>" for every index, except for the indices
+ * given their own text. Every code unit is 10 wide in every font.
+ */
+class FakeStringSource : public GameStringSource {
+ public:
+  FakeStringSource()
+      : language_(u"en"),
+        string_query_count_(0),
+        width_query_count_(0) {
+  }
+
+  UnicodeStringView_Api GetStringByIndex(unsigned int id) override {
+    this->string_query_count_ += 1;
+
+    auto text_it = this->texts_.find(id);
+    if (text_it == this->texts_.end()) {
+      std::u16string text = this->language_ + u":";
+
+      for (char ch : std::to_string(id)) {
+        text.push_back(static_cast<char16_t>(ch));
+      }
+
+      text_it = this->texts_.emplace(id, std::move(text)).first;
+    }
+
+    // The table copies the text, so the source can replace it later.
+    return UnicodeStringView_Api(
+        reinterpret_cast<const UnicodeChar*>(text_it->second.data()),
+        static_cast<int>(text_it->second.length())
+    );
+  }
+
+  int GetDrawWidth(
+      UnicodeStringView_Api text,
+      TextFont text_font
+  ) override {
+    this->width_query_count_ += 1;
+
+    return static_cast<int>(text.length()) * 10;
+  }
+
+  void SetText(unsigned int id, std::u16string text) {
+    this->texts_.insert_or_assign(id, std::move(text));
+  }
+
+  void SetLanguage(std::u16string language) {
+    this->language_ = std::move(language);
+    this->texts_.clear();
+  }
+
+  int string_query_count() const noexcept {
+    return this->string_query_count_;
+  }
+
+  int width_query_count() const noexcept {
+    return this->width_query_count_;
+  }
+
+ private:
+  std::u16string language_;
+  std::unordered_map<unsigned int, std::u16string> texts_;
+  int string_query_count_;
+  int width_query_count_;
+};
+
+static std::u16string_view ToU16StringView(UnicodeStringView_Api view) {
+  return std::u16string_view(
+      reinterpret_cast<const char16_t*>(view.data()),
+      view.length()
+  );
+}
+
+static void TestStringsAreFetchedOnce() {
+  FakeStringSource source;
+  GameStringTable table(source);
+
+  UnicodeStringView_Api text = table.GetString(5);
+  CHECK(ToU16StringView(text) == u"en:5");
+  CHECK_EQ(1, source.string_query_count());
+  CHECK_EQ(0u, table.hit_count());
+  CHECK_EQ(1u, table.miss_count());
+
+  // Later lookups, in either form, are hits that return the same text.
+  CHECK(table.GetString(5).data() == text.data());
+  CHECK(table.GetUtf8String(5) == u8"en:5");
+  CHECK_EQ(1, source.string_query_count());
+  CHECK_EQ(2u, table.hit_count());
+  CHECK_EQ(1u, table.miss_count());
+
+  // The interned copy is null-terminated and outlives the source's text.
+  source.SetText(5, u"changed");
+  CHECK(ToU16StringView(table.GetString(5)) == u"en:5");
+  CHECK(reinterpret_cast<const char16_t*>(text.data())[text.length()]
+      == u'\0');
+
+  CHECK_EQ(1u, table.size());
+}
+
+static void TestPreloadFetchesOnlyMissingStrings() {
+  FakeStringSource source;
+  GameStringTable table(source);
+
+  table.GetString(11);
+  CHECK_EQ(1, source.string_query_count());
+
+  table.Preload(10, 4);
+
+  // 11 was already interned.
+  CHECK_EQ(4, source.string_query_count());
+  CHECK_EQ(4u, table.size());
+
+  // Preloading does not count as lookups.
+  CHECK_EQ(0u, table.hit_count());
+  CHECK_EQ(1u, table.miss_count());
+
+  for (unsigned int id = 10; id < 14; id += 1) {
+    table.GetString(id);
+  }
+
+  CHECK_EQ(4, source.string_query_count());
+  CHECK_EQ(4u, table.hit_count());
+  CHECK_EQ(1u, table.miss_count());
+
+  CHECK(table.GetUtf8String(13) == u8"en:13");
+
+  // Preloading interned strings again fetches nothing.
+  table.Preload(10, 4);
+  CHECK_EQ(4, source.string_query_count());
+}
+
+static void TestLanguagesAreKeptApart() {
+  FakeStringSource source;
+  GameStringTable table(source);
+
+  CHECK_EQ(0u, table.language());
+  CHECK(ToU16StringView(table.GetString(1)) == u"en:1");
+
+  source.SetLanguage(u"de");
+  table.SetLanguage(1);
+  CHECK_EQ(1u, table.language());
+
+  CHECK(ToU16StringView(table.GetString(1)) == u"de:1");
+  CHECK_EQ(2, source.string_query_count());
+  CHECK_EQ(2u, table.size());
+
+  // Switching back finds the strings of the first language.
+  table.SetLanguage(0);
+  CHECK(ToU16StringView(table.GetString(1)) == u"en:1");
+  CHECK_EQ(2, source.string_query_count());
+  CHECK_EQ(1u, table.hit_count());
+}
+
+static void TestDrawWidthIsRememberedPerFont() {
+  FakeStringSource source;
+  GameStringTable table(source);
+
+  CHECK_EQ(40, table.GetDrawWidth(2, TextFont::kFormal_10));
+  CHECK_EQ(40, table.GetDrawWidth(2, TextFont::kFormal_10));
+  CHECK_EQ(1, source.width_query_count());
+
+  // Only the most recently requested font is remembered.
+  CHECK_EQ(40, table.GetDrawWidth(2, TextFont::kExocet_16));
+  CHECK_EQ(40, table.GetDrawWidth(2, TextFont::kFormal_10));
+  CHECK_EQ(3, source.width_query_count());
+}
+
+static void TestMemoryUsageCountsBothForms() {
+  FakeStringSource source;
+  GameStringTable table(source);
+
+  CHECK_EQ(0u, table.memory_usage());
+
+  // "ab" is 2 code units and 2 UTF-8 bytes. "é" is 1 code unit and 2
+  // UTF-8 bytes. Each form has a null terminator.
+  source.SetText(1, u"ab");
+  source.SetText(2, u"é");
+  table.Preload(1, 2);
+
+  std::size_t text_bytes = (3 + 2) * sizeof(char16_t);
+  std::size_t utf8_bytes = 3 + 3;
+  CHECK_EQ(text_bytes + utf8_bytes, table.memory_usage());
+  CHECK(table.GetUtf8String(2) == u8"é");
+
+  table.Clear();
+  CHECK_EQ(0u, table.memory_usage());
+  CHECK_EQ(0u, table.size());
+
+  // Cleared strings are fetched again.
+  table.GetString(1);
+  CHECK_EQ(3, source.string_query_count());
+}
+
+} // namespace
+
+int main() {
+  TestStringsAreFetchedOnce();
+  TestPreloadFetchesOnlyMissingStrings();
+  TestLanguagesAreKeptApart();
+  TestDrawWidthIsRememberedPerFont();
+  TestMemoryUsageCountsBothForms();
+
+  return ::sgd2mapi_test::GetExitCode();
+}
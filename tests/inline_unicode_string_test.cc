@@ -0,0 +1,181 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Checks that InlineUnicodeString keeps its contents when it is
+ * assigned or appended a view into its own characters, both while the
+ * characters are inline and after they have spilled to the heap.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "../SlashGaming-Diablo-II-API/include/cxx/game_struct/d2_unicode_char/d2_inline_unicode_string.hpp"
+#include "support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::d2::UnicodeChar;
+using ::d2::UnicodeChar_1_00;
+using ::d2::UnicodeStringView_Api;
+
+using InlineUnicodeString = ::d2::InlineUnicodeString<8>;
+using UnicodeString_1_00 = std::basic_string<UnicodeChar_1_00>;
+
+static UnicodeString_1_00 MakeString(std::u16string_view str) {
+  UnicodeString_1_00 result;
+
+  for (char16_t ch : str) {
+    result.push_back({ static_cast<std::uint16_t>(ch) });
+  }
+
+  return result;
+}
+
+static InlineUnicodeString MakeInlineString(std::u16string_view str) {
+  UnicodeString_1_00 actual_str = MakeString(str);
+
+  return InlineUnicodeString(
+      reinterpret_cast<const UnicodeChar*>(actual_str.data()),
+      static_cast<int>(actual_str.length())
+  );
+}
+
+static UnicodeStringView_Api SubView(
+    const InlineUnicodeString& str,
+    int pos,
+    int count
+) {
+  const UnicodeChar_1_00* actual_data =
+      reinterpret_cast<const UnicodeChar_1_00*>(str.data());
+
+  return UnicodeStringView_Api(
+      reinterpret_cast<const UnicodeChar*>(&actual_data[pos]),
+      count
+  );
+}
+
+static bool IsStringEqual(
+    const InlineUnicodeString& str,
+    std::u16string_view expected
+) {
+  const UnicodeChar_1_00* actual_data =
+      reinterpret_cast<const UnicodeChar_1_00*>(str.data());
+
+  return std::basic_string_view<UnicodeChar_1_00>(
+      actual_data,
+      str.length()
+  ) == MakeString(expected)
+      && actual_data[str.length()].ch == 0;
+}
+
+static void TestAssignWholeSelf() {
+  InlineUnicodeString str = MakeInlineString(u"Life");
+  str = SubView(str, 0, str.length());
+  CHECK(IsStringEqual(str, u"Life"));
+
+  InlineUnicodeString heap_str = MakeInlineString(u"Fire Resist +75%");
+  CHECK(!heap_str.is_inline());
+  heap_str = SubView(heap_str, 0, heap_str.length());
+  CHECK(IsStringEqual(heap_str, u"Fire Resist +75%"));
+}
+
+static void TestAssignPrefixOfSelf() {
+  InlineUnicodeString str = MakeInlineString(u"Life: 100");
+  str = SubView(str, 0, 4);
+  CHECK(IsStringEqual(str, u"Life"));
+
+  InlineUnicodeString heap_str = MakeInlineString(u"Fire Resist +75%");
+  heap_str = SubView(heap_str, 0, 4);
+  CHECK(IsStringEqual(heap_str, u"Fire"));
+}
+
+static void TestAssignSuffixOfSelf() {
+  InlineUnicodeString str = MakeInlineString(u"Life: 100");
+  str = SubView(str, 6, 3);
+  CHECK(IsStringEqual(str, u"100"));
+
+  InlineUnicodeString heap_str = MakeInlineString(u"Fire Resist +75%");
+  heap_str = SubView(heap_str, 5, 11);
+  CHECK(IsStringEqual(heap_str, u"Resist +75%"));
+}
+
+static void TestAppendSelf() {
+  InlineUnicodeString str = MakeInlineString(u"Life");
+  str += SubView(str, 0, str.length());
+  CHECK(IsStringEqual(str, u"LifeLife"));
+  CHECK(str.is_inline());
+
+  // Growing to the heap keeps the source characters alive.
+  str += SubView(str, 0, str.length());
+  CHECK(IsStringEqual(str, u"LifeLifeLifeLife"));
+  CHECK(!str.is_inline());
+}
+
+static void TestAssignLongerView() {
+  UnicodeString_1_00 long_string = MakeString(u"Cold Resist +75%");
+
+  InlineUnicodeString str = MakeInlineString(u"Life");
+  str = UnicodeStringView_Api(
+      reinterpret_cast<const UnicodeChar*>(long_string.data()),
+      static_cast<int>(long_string.length())
+  );
+  CHECK(IsStringEqual(str, u"Cold Resist +75%"));
+  CHECK(!str.is_inline());
+}
+
+} // namespace
+
+int main() {
+  TestAssignWholeSelf();
+  TestAssignPrefixOfSelf();
+  TestAssignSuffixOfSelf();
+  TestAppendSelf();
+  TestAssignLongerView();
+
+  return ::sgd2mapi_test::GetExitCode();
+}
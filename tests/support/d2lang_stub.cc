@@ -0,0 +1,81 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Stands in for the D2Lang functions that the string helpers call. The
+ * tests read strings through their own sources, so reaching the game
+ * fails the test.
+ */
+
+#include <cstdint>
+
+#include <mdc/error/exit_on_error.hpp>
+#include <mdc/wchar_t/filew.h>
+#include "../../SlashGaming-Diablo-II-API/include/cxx/game_function/d2lang/d2lang_get_string_by_index.hpp"
+
+namespace d2::d2lang {
+namespace {
+
+[[noreturn]] static void ExitOnGameCall(const wchar_t* function_name) {
+  ::mdc::error::ExitOnGeneralError(
+      L"Error",
+      L"Tests cannot call the game function %ls.",
+      __FILEW__,
+      __LINE__,
+      function_name
+  );
+}
+
+} // namespace
+
+const UnicodeChar* GetStringByIndex(unsigned int id) {
+  ExitOnGameCall(L"GetStringByIndex");
+}
+
+const UnicodeChar_1_00* GetStringByIndex_1_00(std::uint32_t id) {
+  ExitOnGameCall(L"GetStringByIndex_1_00");
+}
+
+} // namespace d2::d2lang
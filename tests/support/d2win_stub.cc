@@ -0,0 +1,109 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Stands in for the D2Win functions that the text helpers call. The
+ * tests lay out, measure, and draw text through their own sources and
+ * backends, so reaching the game fails the test.
+ */
+
+#include <cstdint>
+
+#include <mdc/error/exit_on_error.hpp>
+#include <mdc/wchar_t/filew.h>
+#include "../../SlashGaming-Diablo-II-API/include/cxx/game_function/d2win/d2win_draw_unicode_text.hpp"
+#include "../../SlashGaming-Diablo-II-API/include/cxx/game_function/d2win/d2win_get_pop_up_unicode_text_width_and_height.hpp"
+#include "../../SlashGaming-Diablo-II-API/include/cxx/game_function/d2win/d2win_get_unicode_text_n_draw_width.hpp"
+#include "../../SlashGaming-Diablo-II-API/include/cxx/game_function/d2win/d2win_set_unicode_text_font.hpp"
+
+namespace d2::d2win {
+namespace {
+
+[[noreturn]] static void ExitOnGameCall(const wchar_t* function_name) {
+  ::mdc::error::ExitOnGeneralError(
+      L"Error",
+      L"Tests cannot call the game function %ls.",
+      __FILEW__,
+      __LINE__,
+      function_name
+  );
+}
+
+} // namespace
+
+void DrawUnicodeText(
+    const UnicodeChar* text,
+    int position_x,
+    int position_y,
+    TextColor text_color,
+    bool is_indented
+) {
+  ExitOnGameCall(L"DrawUnicodeText");
+}
+
+void GetPopUpUnicodeTextWidthAndHeight(
+    const UnicodeChar* text,
+    int* width,
+    int* height
+) {
+  ExitOnGameCall(L"GetPopUpUnicodeTextWidthAndHeight");
+}
+
+std::int32_t GetUnicodeTextNDrawWidth_1_00(
+    const UnicodeChar_1_00* text,
+    std::int32_t length
+) {
+  ExitOnGameCall(L"GetUnicodeTextNDrawWidth_1_00");
+}
+
+TextFont SetUnicodeTextFont(TextFont text_font) {
+  ExitOnGameCall(L"SetUnicodeTextFont");
+}
+
+TextFont_1_00 SetUnicodeTextFont_1_00(TextFont_1_00 text_font) {
+  ExitOnGameCall(L"SetUnicodeTextFont_1_00");
+}
+
+} // namespace d2::d2win
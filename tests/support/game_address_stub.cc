@@ -0,0 +1,118 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Stands in for the game address factories, which need the game
+ * libraries to be loaded. The tests never resolve an address of a game
+ * library, so those factories fail the test. A test addresses its own
+ * memory instead, by passing an empty path and an absolute offset.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <mdc/error/exit_on_error.hpp>
+#include <mdc/wchar_t/filew.h>
+#include "../../SlashGaming-Diablo-II-API/include/cxx/game_address.hpp"
+
+namespace mapi {
+
+GameAddress GameAddress::FromExportedName(
+    ::d2::DefaultLibrary library,
+    const char* exported_name
+) {
+  ::mdc::error::ExitOnGeneralError(
+      L"Error",
+      L"Tests cannot locate the exported name %hs.",
+      __FILEW__,
+      __LINE__,
+      exported_name
+  );
+}
+
+GameAddress GameAddress::FromOffset(
+    ::d2::DefaultLibrary library,
+    std::ptrdiff_t offset
+) {
+  ::mdc::error::ExitOnGeneralError(
+      L"Error",
+      L"Tests cannot locate the offset 0x%X.",
+      __FILEW__,
+      __LINE__,
+      static_cast<unsigned int>(offset)
+  );
+}
+
+GameAddress GameAddress::FromOrdinal(
+    ::d2::DefaultLibrary library,
+    std::int16_t ordinal
+) {
+  ::mdc::error::ExitOnGeneralError(
+      L"Error",
+      L"Tests cannot locate the ordinal %d.",
+      __FILEW__,
+      __LINE__,
+      static_cast<int>(ordinal)
+  );
+}
+
+GameAddress GameAddress::FromOffset(
+    const wchar_t* path,
+    std::ptrdiff_t offset
+) {
+  if (path[0] != L'\0') {
+    ::mdc::error::ExitOnGeneralError(
+        L"Error",
+        L"Tests cannot locate an offset in %ls.",
+        __FILEW__,
+        __LINE__,
+        path
+    );
+  }
+
+  return GameAddress(offset);
+}
+
+} // namespace mapi
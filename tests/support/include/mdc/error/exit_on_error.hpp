@@ -0,0 +1,119 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * A stand-in for the MirD Common error functions, used to build the
+ * tests without the library. Every error prints where it happened and
+ * aborts, so that the test fails. The message is printed unformatted,
+ * since stderr is byte oriented.
+ */
+
+#ifndef SGD2MAPI_TESTS_SUPPORT_MDC_ERROR_EXIT_ON_ERROR_HPP_
+#define SGD2MAPI_TESTS_SUPPORT_MDC_ERROR_EXIT_ON_ERROR_HPP_
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace mdc::error {
+
+template <typename ...Args>
+[[noreturn]] inline void ExitOnGeneralError(
+    const wchar_t* caption_text,
+    const wchar_t* message_format,
+    const wchar_t* file_path,
+    int line,
+    Args... args
+) {
+  std::fprintf(
+      stderr,
+      "%ls:%d: %ls: %ls\n",
+      file_path,
+      line,
+      caption_text,
+      message_format
+  );
+
+  std::abort();
+}
+
+template <typename T>
+[[noreturn]] inline void ExitOnConstantMappingError(
+    const wchar_t* file_path,
+    int line,
+    T value
+) {
+  std::fprintf(
+      stderr,
+      "%ls:%d: Constant mapping error for value %lld.\n",
+      file_path,
+      line,
+      static_cast<long long>(value)
+  );
+
+  std::abort();
+}
+
+template <typename ErrorCode>
+[[noreturn]] inline void ExitOnWindowsFunctionError(
+    const wchar_t* file_path,
+    int line,
+    const wchar_t* function_name,
+    ErrorCode error_code
+) {
+  std::fprintf(
+      stderr,
+      "%ls:%d: %ls failed with error code 0x%lX.\n",
+      file_path,
+      line,
+      function_name,
+      static_cast<unsigned long>(error_code)
+  );
+
+  std::abort();
+}
+
+} // namespace mdc::error
+
+#endif // SGD2MAPI_TESTS_SUPPORT_MDC_ERROR_EXIT_ON_ERROR_HPP_
@@ -0,0 +1,91 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include "sgd2mapi_test.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+namespace sgd2mapi_test {
+namespace {
+
+static int failure_count = 0;
+
+} // namespace
+
+void ReportFailure(const char* file, int line, const char* expression) {
+  failure_count += 1;
+  std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", file, line, expression);
+}
+
+int GetFailureCount() {
+  return failure_count;
+}
+
+int GetExitCode() {
+  if (failure_count == 0) {
+    std::printf("All checks passed.\n");
+    return 0;
+  }
+
+  std::fprintf(stderr, "%d check(s) failed.\n", failure_count);
+  return 1;
+}
+
+std::size_t GetBenchmarkIterations(
+    int argc,
+    char** argv,
+    std::size_t iterations
+) {
+  for (int i = 1; i < argc; i += 1) {
+    if (std::strcmp(argv[i], "--quick") == 0) {
+      return (iterations / 1000) + 1;
+    }
+  }
+
+  return iterations;
+}
+
+} // namespace sgd2mapi_test
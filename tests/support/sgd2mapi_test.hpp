@@ -0,0 +1,136 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Minimal checks and timers shared by the tests and benchmarks. A test
+ * reports failures through the CHECK macros, and its main returns
+ * GetExitCode().
+ */
+
+#ifndef SGD2MAPI_TESTS_SUPPORT_SGD2MAPI_TEST_HPP_
+#define SGD2MAPI_TESTS_SUPPORT_SGD2MAPI_TEST_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace sgd2mapi_test {
+
+/**
+ * Records a failed check, and prints where it happened.
+ */
+void ReportFailure(const char* file, int line, const char* expression);
+
+/**
+ * Returns the number of failed checks so far.
+ */
+int GetFailureCount();
+
+/**
+ * Returns the exit code of a test: zero if every check passed.
+ */
+int GetExitCode();
+
+/**
+ * Returns the number of iterations a benchmark should run. Passing
+ * --quick on the command line, as CTest does, divides the count by 1000
+ * so the benchmark only checks that it still works.
+ */
+std::size_t GetBenchmarkIterations(
+    int argc,
+    char** argv,
+    std::size_t iterations
+);
+
+/**
+ * Prevents the compiler from discarding a value computed by a benchmark.
+ */
+template <typename T>
+inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__)
+  asm volatile("" : : "g"(&value) : "memory");
+#else
+  static volatile const void* sink;
+  sink = &value;
+#endif
+}
+
+/**
+ * Runs a function the specified number of times, and prints the mean
+ * time per call in nanoseconds. Returns the mean.
+ */
+template <typename Func>
+double TimeBenchmark(const char* name, std::size_t iterations, Func&& func) {
+  using Clock = std::chrono::steady_clock;
+
+  Clock::time_point start = Clock::now();
+
+  for (std::size_t i = 0; i < iterations; i += 1) {
+    func();
+  }
+
+  Clock::time_point end = Clock::now();
+
+  double total_ns =
+      std::chrono::duration<double, std::nano>(end - start).count();
+  double mean_ns = (iterations == 0) ? 0.0 : total_ns / iterations;
+
+  std::printf("%-48s %12.2f ns\n", name, mean_ns);
+
+  return mean_ns;
+}
+
+} // namespace sgd2mapi_test
+
+#define CHECK(expression) \
+    do { \
+      if (!(expression)) { \
+        ::sgd2mapi_test::ReportFailure(__FILE__, __LINE__, #expression); \
+      } \
+    } while (false)
+
+#define CHECK_EQ(expected, actual) CHECK((expected) == (actual))
+
+#endif // SGD2MAPI_TESTS_SUPPORT_SGD2MAPI_TEST_HPP_
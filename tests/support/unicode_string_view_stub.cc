@@ -0,0 +1,101 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Stands in for the UnicodeStringView_Api constructors. The rest of
+ * d2_unicode_string_view_api.cc draws text through the game libraries,
+ * so it cannot be built for the tests, and drawing fails the test.
+ */
+
+#include <string_view>
+
+#include <mdc/error/exit_on_error.hpp>
+#include <mdc/wchar_t/filew.h>
+#include "../../SlashGaming-Diablo-II-API/include/cxx/game_struct/d2_unicode_char/d2_unicode_string_view_api.hpp"
+
+namespace d2 {
+
+UnicodeStringView_Api::UnicodeStringView_Api() noexcept
+    : view_(std::basic_string_view<UnicodeChar_1_00>()) {
+}
+
+UnicodeStringView_Api::UnicodeStringView_Api(
+    const value_type* s,
+    size_type count
+) : view_(std::basic_string_view<UnicodeChar_1_00>(
+        reinterpret_cast<const UnicodeChar_1_00*>(s),
+        count
+    )) {
+}
+
+UnicodeStringView_Api::UnicodeStringView_Api(const value_type* s)
+    : view_(std::basic_string_view<UnicodeChar_1_00>(
+          reinterpret_cast<const UnicodeChar_1_00*>(s)
+      )) {
+}
+
+void UnicodeStringView_Api::Draw(int position_x, int position_y) const {
+  ::mdc::error::ExitOnGeneralError(
+      L"Error",
+      L"Tests cannot draw text.",
+      __FILEW__,
+      __LINE__
+  );
+}
+
+void UnicodeStringView_Api::Draw(
+    int position_x,
+    int position_y,
+    const DrawTextOptions& options
+) const {
+  ::mdc::error::ExitOnGeneralError(
+      L"Error",
+      L"Tests cannot draw text.",
+      __FILEW__,
+      __LINE__
+  );
+}
+
+} // namespace d2
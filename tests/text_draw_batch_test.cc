@@ -0,0 +1,334 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Flushes text draw batches to a backend that records every call, and
+ * checks the order of the draws, the font changes, and the alignment.
+ */
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "../SlashGaming-Diablo-II-API/include/cxx/helper/d2_text_draw_batch.hpp"
+#include "support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::d2::DrawPositionXBehavior;
+using ::d2::DrawTextOptions;
+using ::d2::TextColor;
+using ::d2::TextDrawBackend;
+using ::d2::TextDrawBatch;
+using ::d2::TextFont;
+using ::d2::UnicodeChar;
+using ::d2::UnicodeStringView_Api;
+
+struct RecordedDraw {
+  std::u16string_view text;
+  int position_x;
+  int position_y;
+  TextColor text_color;
+  TextFont text_font;
+};
+
+/**
+ * Records every font change and draw. Every code unit is 10 wide in
+ * every font.
+ */
+class RecordingBackend : public TextDrawBackend {
+ public:
+  explicit RecordingBackend(TextFont game_font)
+      : text_font_(game_font),
+        measure_count_(0) {
+  }
+
+  TextFont SetFont(TextFont text_font) override {
+    TextFont previous_font = this->text_font_;
+
+    this->text_font_ = text_font;
+    this->font_changes_.push_back(text_font);
+
+    return previous_font;
+  }
+
+  int GetDrawWidth(UnicodeStringView_Api text) override {
+    this->measure_count_ += 1;
+
+    return static_cast<int>(text.length()) * 10;
+  }
+
+  void DrawUnicodeText(
+      UnicodeStringView_Api text,
+      int position_x,
+      int position_y,
+      TextColor text_color
+  ) override {
+    RecordedDraw draw = {
+        std::u16string_view(
+            reinterpret_cast<const char16_t*>(text.data()),
+            text.length()
+        ),
+        position_x,
+        position_y,
+        text_color,
+        this->text_font_
+    };
+
+    this->draws_.push_back(draw);
+  }
+
+  TextFont text_font() const noexcept {
+    return this->text_font_;
+  }
+
+  int measure_count() const noexcept {
+    return this->measure_count_;
+  }
+
+  const std::vector<TextFont>& font_changes() const noexcept {
+    return this->font_changes_;
+  }
+
+  const std::vector<RecordedDraw>& draws() const noexcept {
+    return this->draws_;
+  }
+
+ private:
+  TextFont text_font_;
+  int measure_count_;
+  std::vector<TextFont> font_changes_;
+  std::vector<RecordedDraw> draws_;
+};
+
+static UnicodeStringView_Api ToView(std::u16string_view text) {
+  return UnicodeStringView_Api(
+      reinterpret_cast<const UnicodeChar*>(text.data()),
+      static_cast<int>(text.length())
+  );
+}
+
+static DrawTextOptions MakeOptions(
+    TextColor text_color,
+    DrawPositionXBehavior position_x_behavior
+) {
+  DrawTextOptions options;
+  options.text_color = text_color;
+  options.position_x_behavior = position_x_behavior;
+
+  return options;
+}
+
+static void AddLeft(
+    TextDrawBatch& batch,
+    std::u16string_view text,
+    int position_y,
+    TextFont text_font,
+    TextColor text_color
+) {
+  batch.Add(
+      ToView(text),
+      0,
+      position_y,
+      text_font,
+      MakeOptions(text_color, DrawPositionXBehavior::kLeft)
+  );
+}
+
+static void TestDrawsAreGroupedByFontThenColor() {
+  RecordingBackend backend(TextFont::kFormal_10);
+  TextDrawBatch batch(backend);
+
+  AddLeft(batch, u"a", 0, TextFont::kFormal_12, TextColor::kRed);
+  AddLeft(batch, u"b", 1, TextFont::kExocet_16, TextColor::kGold);
+  AddLeft(batch, u"c", 2, TextFont::kFormal_12, TextColor::kWhite);
+  AddLeft(batch, u"d", 3, TextFont::kExocet_16, TextColor::kWhite);
+  AddLeft(batch, u"e", 4, TextFont::kFormal_12, TextColor::kRed);
+  AddLeft(batch, u"f", 5, TextFont::kExocet_16, TextColor::kGold);
+
+  CHECK_EQ(6u, batch.size());
+
+  batch.Flush();
+
+  // Fonts and colors are ordered by their enum values, and the draws in
+  // each group keep the order they were added in.
+  const std::vector<RecordedDraw>& draws = backend.draws();
+  CHECK_EQ(6u, draws.size());
+  if (draws.size() != 6) {
+    return;
+  }
+
+  CHECK(draws[0].text == u"d");
+  CHECK(draws[1].text == u"b");
+  CHECK(draws[2].text == u"f");
+  CHECK(draws[3].text == u"c");
+  CHECK(draws[4].text == u"a");
+  CHECK(draws[5].text == u"e");
+
+  CHECK(draws[0].text_font == TextFont::kExocet_16);
+  CHECK(draws[1].text_color == TextColor::kGold);
+  CHECK(draws[3].text_font == TextFont::kFormal_12);
+  CHECK(draws[4].text_color == TextColor::kRed);
+  CHECK_EQ(0, draws[4].position_y);
+  CHECK_EQ(4, draws[5].position_y);
+
+  CHECK(batch.empty());
+}
+
+static void TestEachFontIsSetOnceAndRestored() {
+  RecordingBackend backend(TextFont::kFormal_10);
+  TextDrawBatch batch(backend);
+
+  AddLeft(batch, u"a", 0, TextFont::kFormal_12, TextColor::kRed);
+  AddLeft(batch, u"b", 0, TextFont::kExocet_16, TextColor::kGold);
+  AddLeft(batch, u"c", 0, TextFont::kFormal_12, TextColor::kWhite);
+  AddLeft(batch, u"d", 0, TextFont::kExocet_16, TextColor::kWhite);
+
+  batch.Flush();
+
+  // One change per font group, then one to restore the game's font.
+  const std::vector<TextFont>& font_changes = backend.font_changes();
+  CHECK_EQ(3u, font_changes.size());
+  if (font_changes.size() != 3) {
+    return;
+  }
+
+  CHECK(font_changes[0] == TextFont::kExocet_16);
+  CHECK(font_changes[1] == TextFont::kFormal_12);
+  CHECK(font_changes[2] == TextFont::kFormal_10);
+  CHECK(backend.text_font() == TextFont::kFormal_10);
+}
+
+static void TestUnchangedFontIsNotRestored() {
+  RecordingBackend backend(TextFont::kFormal_12);
+  TextDrawBatch batch(backend);
+
+  AddLeft(batch, u"a", 0, TextFont::kFormal_12, TextColor::kRed);
+  AddLeft(batch, u"b", 0, TextFont::kFormal_12, TextColor::kGold);
+
+  batch.Flush();
+
+  CHECK_EQ(1u, backend.font_changes().size());
+  CHECK(backend.text_font() == TextFont::kFormal_12);
+
+  // An empty batch touches nothing.
+  batch.Flush();
+  CHECK_EQ(1u, backend.font_changes().size());
+}
+
+static void TestCenterAndRightAreMeasured() {
+  RecordingBackend backend(TextFont::kFormal_10);
+  TextDrawBatch batch(backend);
+
+  batch.Add(
+      ToView(u"abcd"),
+      100,
+      0,
+      TextFont::kFormal_10,
+      MakeOptions(TextColor::kWhite, DrawPositionXBehavior::kLeft)
+  );
+  batch.Add(
+      ToView(u"abcd"),
+      100,
+      1,
+      TextFont::kFormal_10,
+      MakeOptions(TextColor::kWhite, DrawPositionXBehavior::kCenter)
+  );
+  batch.Add(
+      ToView(u"abcd"),
+      100,
+      2,
+      TextFont::kFormal_10,
+      MakeOptions(TextColor::kWhite, DrawPositionXBehavior::kRight)
+  );
+  batch.AddCentered(
+      ToView(u"ab"),
+      50,
+      150,
+      3,
+      TextFont::kFormal_10,
+      TextColor::kWhite
+  );
+
+  batch.Flush();
+
+  // Left aligned text is never measured.
+  CHECK_EQ(3, backend.measure_count());
+
+  const std::vector<RecordedDraw>& draws = backend.draws();
+  CHECK_EQ(4u, draws.size());
+  if (draws.size() != 4) {
+    return;
+  }
+
+  CHECK_EQ(100, draws[0].position_x);
+  CHECK_EQ(80, draws[1].position_x);
+  CHECK_EQ(60, draws[2].position_x);
+  CHECK_EQ(90, draws[3].position_x);
+}
+
+static void TestClearDiscardsDraws() {
+  RecordingBackend backend(TextFont::kFormal_10);
+  TextDrawBatch batch(backend);
+
+  AddLeft(batch, u"a", 0, TextFont::kFormal_12, TextColor::kRed);
+  batch.Clear();
+  batch.Flush();
+
+  CHECK(backend.draws().empty());
+  CHECK(backend.font_changes().empty());
+}
+
+} // namespace
+
+int main() {
+  TestDrawsAreGroupedByFontThenColor();
+  TestEachFontIsSetOnceAndRestored();
+  TestUnchangedFontIsNotRestored();
+  TestCenterAndRightAreMeasured();
+  TestClearDiscardsDraws();
+
+  return ::sgd2mapi_test::GetExitCode();
+}
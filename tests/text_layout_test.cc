@@ -0,0 +1,294 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Lays out text with a fixed-width source and checks where the lines
+ * break, their widths, and the color codes that carry across breaks.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "../SlashGaming-Diablo-II-API/include/cxx/helper/d2_text_layout.hpp"
+#include "support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::d2::TextFont;
+using ::d2::TextLayout;
+using ::d2::TextLayoutEngine;
+using ::d2::TextLayoutSource;
+using ::d2::UnicodeChar;
+using ::d2::UnicodeChar_1_00;
+using ::d2::UnicodeStringView_Api;
+
+/**
+ * Every glyph is 10 wide, except spaces, which are 5 wide.
+ */
+class FixedWidthSource : public TextLayoutSource {
+ public:
+  int GetGlyphWidth(UnicodeChar_1_00 ch, TextFont text_font) override {
+    this->glyph_query_count += 1;
+
+    return (ch.ch == u' ') ? 5 : 10;
+  }
+
+  int GetLineHeight(TextFont text_font) override {
+    return 12;
+  }
+
+  int glyph_query_count = 0;
+};
+
+static UnicodeStringView_Api ToView(std::u16string_view text) {
+  return UnicodeStringView_Api(
+      reinterpret_cast<const UnicodeChar*>(text.data()),
+      static_cast<int>(text.length())
+  );
+}
+
+static std::u16string ToU16String(UnicodeStringView_Api view) {
+  const char16_t* data = reinterpret_cast<const char16_t*>(view.data());
+
+  // Lines are null-terminated.
+  if (data[view.length()] != u'\0') {
+    return u"<not terminated>";
+  }
+
+  return std::u16string(data, view.length());
+}
+
+static bool IsLineEqual(
+    const TextLayout& layout,
+    std::size_t index,
+    std::u16string_view text,
+    int width
+) {
+  if (index >= layout.lines().size()) {
+    return false;
+  }
+
+  return ToU16String(layout.lines()[index].text) == text
+      && layout.lines()[index].width == width;
+}
+
+static void TestBreaksAtSpaces() {
+  FixedWidthSource source;
+  TextLayoutEngine engine(source);
+
+  const TextLayout& layout =
+      engine.Layout(ToView(u"abc def ghi"), TextFont::kFormal_10, 75);
+
+  CHECK_EQ(2u, layout.lines().size());
+  CHECK(IsLineEqual(layout, 0, u"abc def", 65));
+  CHECK(IsLineEqual(layout, 1, u"ghi", 30));
+  CHECK_EQ(65, layout.width());
+  CHECK_EQ(24, layout.height());
+}
+
+static void TestBreaksLongWordsAndNewlines() {
+  FixedWidthSource source;
+  TextLayoutEngine engine(source);
+
+  const TextLayout& layout =
+      engine.Layout(ToView(u"abcdefg\nhi"), TextFont::kFormal_10, 30);
+
+  CHECK_EQ(4u, layout.lines().size());
+  CHECK(IsLineEqual(layout, 0, u"abc", 30));
+  CHECK(IsLineEqual(layout, 1, u"def", 30));
+  CHECK(IsLineEqual(layout, 2, u"g", 10));
+  CHECK(IsLineEqual(layout, 3, u"hi", 20));
+}
+
+static void TestNoWrapping() {
+  FixedWidthSource source;
+  TextLayoutEngine engine(source);
+
+  const TextLayout& layout =
+      engine.Layout(ToView(u"abc def ghi"), TextFont::kFormal_10, 0);
+
+  CHECK_EQ(1u, layout.lines().size());
+  CHECK(IsLineEqual(layout, 0, u"abc def ghi", 100));
+}
+
+static void TestColorCodesCarryAcrossBreaks() {
+  FixedWidthSource source;
+  TextLayoutEngine engine(source);
+
+  // Wrapped at a space: the color code is copied to the next line and
+  // takes no width.
+  const TextLayout& wrapped = engine.Layout(
+      ToView(u"ÿc1abc def"),
+      TextFont::kFormal_10,
+      40
+  );
+
+  CHECK_EQ(2u, wrapped.lines().size());
+  CHECK(IsLineEqual(wrapped, 0, u"ÿc1abc", 30));
+  CHECK(IsLineEqual(wrapped, 1, u"ÿc1def", 30));
+
+  // Broken within a word, and after a newline. The latest code wins.
+  const TextLayout& broken = engine.Layout(
+      ToView(u"abÿc2cdef\nxy"),
+      TextFont::kFormal_10,
+      30
+  );
+
+  CHECK_EQ(3u, broken.lines().size());
+  CHECK(IsLineEqual(broken, 0, u"abÿc2c", 30));
+  CHECK(IsLineEqual(broken, 1, u"ÿc2def", 30));
+  CHECK(IsLineEqual(broken, 2, u"ÿc2xy", 20));
+
+  // A code inside the word that moves to the next line follows the code
+  // that was active at the start of that line.
+  const TextLayout& moved = engine.Layout(
+      ToView(u"ÿc1ab cÿc4de"),
+      TextFont::kFormal_10,
+      40
+  );
+
+  CHECK_EQ(2u, moved.lines().size());
+  CHECK(IsLineEqual(moved, 0, u"ÿc1ab", 20));
+  CHECK(IsLineEqual(moved, 1, u"ÿc1cÿc4de", 30));
+
+  // A line that starts with its own code gets no copy, and a code cut
+  // off by the end of the text is not carried.
+  const TextLayout& own_code = engine.Layout(
+      ToView(u"ÿc1ab\nÿc3cd\nÿc"),
+      TextFont::kFormal_10,
+      0
+  );
+
+  CHECK_EQ(3u, own_code.lines().size());
+  CHECK(IsLineEqual(own_code, 1, u"ÿc3cd", 20));
+  CHECK(IsLineEqual(own_code, 2, u"ÿc3ÿc", 0));
+}
+
+static void TestLayoutsAreCached() {
+  FixedWidthSource source;
+  TextLayoutEngine engine(source);
+
+  const TextLayout& layout1 =
+      engine.Layout(ToView(u"abc def"), TextFont::kFormal_10, 50);
+  int query_count = source.glyph_query_count;
+
+  const TextLayout& layout2 =
+      engine.Layout(ToView(u"abc def"), TextFont::kFormal_10, 50);
+
+  CHECK(&layout1 == &layout2);
+  CHECK_EQ(query_count, source.glyph_query_count);
+  CHECK_EQ(1u, engine.size());
+
+  engine.Clear();
+  CHECK_EQ(0u, engine.size());
+}
+
+static void TestLayoutsKeepTheirKeys() {
+  FixedWidthSource source;
+  TextLayoutEngine engine(source);
+
+  const TextLayout& layout =
+      engine.Layout(ToView(u"abc def"), TextFont::kFormal_10, 50);
+
+  // Every other combination of text, font, and width gets its own
+  // layout, and none of them replaces the first one.
+  const TextLayout& other_font =
+      engine.Layout(ToView(u"abc def"), TextFont::kExocet_16, 50);
+  const TextLayout& other_width =
+      engine.Layout(ToView(u"abc def"), TextFont::kFormal_10, 0);
+
+  CHECK(&layout != &other_font);
+  CHECK(&layout != &other_width);
+  CHECK_EQ(1u, other_width.lines().size());
+
+  for (int i = 0; i < 2000; i += 1) {
+    std::u16string text = u"line " + std::u16string(i % 50 + 1, u'x');
+    engine.Layout(ToView(text), TextFont::kFormal_10, i + 1);
+  }
+
+  CHECK_EQ(2003u, engine.size());
+  CHECK_EQ(2u, layout.lines().size());
+  CHECK(IsLineEqual(layout, 0, u"abc", 30));
+  CHECK(&layout
+      == &engine.Layout(ToView(u"abc def"), TextFont::kFormal_10, 50));
+}
+
+static void TestTrimFreesUnusedLayouts() {
+  FixedWidthSource source;
+  TextLayoutEngine engine(source);
+
+  const TextLayout& kept =
+      engine.Layout(ToView(u"kept"), TextFont::kFormal_10, 0);
+  engine.Layout(ToView(u"dropped"), TextFont::kFormal_10, 0);
+
+  // Both were used before the first trim.
+  engine.Trim();
+  CHECK_EQ(2u, engine.size());
+
+  CHECK(&kept == &engine.Layout(ToView(u"kept"), TextFont::kFormal_10, 0));
+
+  engine.Trim();
+  CHECK_EQ(1u, engine.size());
+  CHECK(IsLineEqual(kept, 0, u"kept", 40));
+
+  engine.Trim();
+  CHECK_EQ(0u, engine.size());
+}
+
+} // namespace
+
+int main() {
+  TestBreaksAtSpaces();
+  TestBreaksLongWordsAndNewlines();
+  TestNoWrapping();
+  TestColorCodesCarryAcrossBreaks();
+  TestLayoutsAreCached();
+  TestLayoutsKeepTheirKeys();
+  TestTrimFreesUnusedLayouts();
+
+  return ::sgd2mapi_test::GetExitCode();
+}
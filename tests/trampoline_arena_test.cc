@@ -0,0 +1,315 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../SlashGaming-Diablo-II-API/include/cxx/trampoline_arena.hpp"
+#include "support/sgd2mapi_test.hpp"
+
+namespace {
+
+using ::mapi::TrampolineArena;
+using ::mapi::TrampolinePageProvider;
+
+/**
+ * Hands out page addresses without backing memory, since allocating a
+ * stub never touches it.
+ */
+class FakePageProvider : public TrampolinePageProvider {
+ public:
+  explicit FakePageProvider(std::intptr_t first_page_address)
+      : next_page_address_(first_page_address) {
+  }
+
+  std::intptr_t AllocatePage(std::intptr_t near_address) override {
+    std::intptr_t page_address = this->next_page_address_;
+    this->next_page_address_ += this->page_size();
+
+    this->allocated_page_count_ += 1;
+
+    return page_address;
+  }
+
+  void FreePage(std::intptr_t page_address) override {
+    this->freed_page_count_ += 1;
+  }
+
+  void FlushInstructionCache(
+      std::intptr_t address,
+      std::size_t size
+  ) override {
+  }
+
+  std::size_t page_size() const override {
+    return 4096;
+  }
+
+  std::size_t allocated_page_count() const noexcept {
+    return this->allocated_page_count_;
+  }
+
+  std::size_t freed_page_count() const noexcept {
+    return this->freed_page_count_;
+  }
+
+ private:
+  std::intptr_t next_page_address_;
+  std::size_t allocated_page_count_ = 0;
+  std::size_t freed_page_count_ = 0;
+};
+
+static constexpr std::intptr_t kTargetAddress = 0x00401000;
+
+static void TestStubsArePacked() {
+  FakePageProvider page_provider(0x10000000);
+  TrampolineArena arena(kTargetAddress, page_provider);
+
+  std::size_t stubs_per_page =
+      page_provider.page_size() / TrampolineArena::kStubAlignment;
+
+  std::intptr_t previous_stub = 0;
+
+  for (std::size_t i = 0; i < stubs_per_page; i += 1) {
+    // Sizes round up to the stub alignment.
+    std::intptr_t stub = arena.Allocate((i % 16) + 1);
+
+    CHECK(stub != 0);
+    CHECK_EQ(0, stub % TrampolineArena::kStubAlignment);
+
+    if (i > 0) {
+      CHECK_EQ(
+          previous_stub + static_cast<std::intptr_t>(
+              TrampolineArena::kStubAlignment
+          ),
+          stub
+      );
+    }
+
+    previous_stub = stub;
+  }
+
+  CHECK_EQ(1u, arena.page_count());
+
+  CHECK(arena.Allocate(1) != 0);
+  CHECK_EQ(2u, arena.page_count());
+}
+
+static void TestInvalidSizes() {
+  FakePageProvider page_provider(0x10000000);
+  TrampolineArena arena(kTargetAddress, page_provider);
+
+  CHECK_EQ(0, arena.Allocate(0));
+  CHECK_EQ(0, arena.Allocate(page_provider.page_size() + 1));
+  CHECK_EQ(0u, arena.page_count());
+
+  CHECK(arena.Allocate(page_provider.page_size()) != 0);
+  CHECK_EQ(1u, arena.page_count());
+}
+
+static void TestFragmentation() {
+  FakePageProvider page_provider(0x10000000);
+  TrampolineArena arena(kTargetAddress, page_provider);
+
+  std::mt19937 random(0x7A);
+  std::uniform_int_distribution<std::size_t> size_distribution(1, 256);
+
+  std::vector<std::pair<std::intptr_t, std::size_t>> stubs;
+  std::size_t used_size = 0;
+
+  for (std::size_t i = 0; i < 10000; i += 1) {
+    std::size_t size = size_distribution(random);
+    std::intptr_t stub = arena.Allocate(size);
+
+    CHECK(stub != 0);
+
+    stubs.emplace_back(stub, size);
+    used_size += size;
+  }
+
+  std::sort(stubs.begin(), stubs.end());
+
+  std::intptr_t page_mask =
+      ~static_cast<std::intptr_t>(page_provider.page_size() - 1);
+
+  for (std::size_t i = 0; i < stubs.size(); i += 1) {
+    auto [stub, size] = stubs[i];
+
+    // No stub straddles a page.
+    CHECK_EQ(stub & page_mask, (stub + size - 1) & page_mask);
+
+    // No stubs overlap.
+    if (i + 1 < stubs.size()) {
+      CHECK(stub + static_cast<std::intptr_t>(size) <= stubs[i + 1].first);
+    }
+  }
+
+  // Rounding to 16 bytes and the unused tail of each page waste less
+  // than a tenth of the space for stubs of up to 256 bytes.
+  std::size_t reserved_size = arena.page_count() * page_provider.page_size();
+  std::size_t aligned_size = 0;
+
+  for (const auto& [stub, size] : stubs) {
+    aligned_size += (size + 15) & ~std::size_t(15);
+  }
+
+  CHECK(aligned_size <= reserved_size);
+  CHECK(reserved_size - aligned_size < reserved_size / 10);
+  CHECK(used_size <= aligned_size);
+}
+
+static void TestPagesAboveTwoGigabytes() {
+  // Large address aware processes receive pages at or above 2 GB.
+  FakePageProvider high_page_provider(0x80000000);
+  TrampolineArena high_arena(kTargetAddress, high_page_provider);
+
+  CHECK(high_arena.Allocate(16) != 0);
+  CHECK_EQ(0u, high_page_provider.freed_page_count());
+
+  // On x86-32, a rel32 branch wraps around, so the top of the address
+  // space is also reachable from a low module. Elsewhere it is not.
+  FakePageProvider top_page_provider(0xFFFF0000);
+  TrampolineArena top_arena(kTargetAddress, top_page_provider);
+
+  std::intptr_t stub = top_arena.Allocate(16);
+
+  if constexpr (sizeof(std::uintptr_t) == sizeof(std::uint32_t)) {
+    CHECK(stub != 0);
+    CHECK_EQ(0u, top_page_provider.freed_page_count());
+  } else {
+    CHECK_EQ(0, stub);
+    CHECK_EQ(1u, top_page_provider.freed_page_count());
+  }
+}
+
+static void TestClearAndMove() {
+  FakePageProvider page_provider(0x10000000);
+
+  {
+    TrampolineArena arena(kTargetAddress, page_provider);
+
+    for (std::size_t i = 0; i < 3; i += 1) {
+      arena.Allocate(page_provider.page_size());
+    }
+
+    CHECK_EQ(3u, arena.page_count());
+
+    TrampolineArena moved_arena(std::move(arena));
+    CHECK_EQ(0u, arena.page_count());
+    CHECK_EQ(3u, moved_arena.page_count());
+
+    moved_arena.Clear();
+    CHECK_EQ(3u, page_provider.freed_page_count());
+
+    moved_arena.Allocate(16);
+    arena = std::move(moved_arena);
+  }
+
+  // The arena that received the page freed it on destruction.
+  CHECK_EQ(4u, page_provider.freed_page_count());
+  CHECK_EQ(4u, page_provider.allocated_page_count());
+}
+
+static int ReturnFortyTwo() {
+  return 42;
+}
+
+static void TestProcessPageProvider() {
+  std::intptr_t target_address =
+      reinterpret_cast<std::intptr_t>(&ReturnFortyTwo);
+
+  TrampolineArena arena(target_address);
+
+  std::intptr_t stub = arena.Allocate(16);
+
+  CHECK(stub != 0);
+
+  if (stub == 0) {
+    return;
+  }
+
+  std::intptr_t distance = (stub > target_address)
+      ? stub - target_address
+      : target_address - stub;
+
+  CHECK(distance <= 0x7FFFFFFF);
+
+#if defined(__i386__) || defined(__x86_64__)
+  // mov eax, 7; ret
+  static constexpr std::uint8_t kCode[] = {
+      0xB8, 0x07, 0x00, 0x00, 0x00, 0xC3
+  };
+
+  std::copy(
+      std::begin(kCode),
+      std::end(kCode),
+      reinterpret_cast<std::uint8_t*>(stub)
+  );
+
+  TrampolinePageProvider::GetProcessPageProvider().FlushInstructionCache(
+      stub,
+      sizeof(kCode)
+  );
+
+  CHECK_EQ(7, reinterpret_cast<int (*)()>(stub)());
+#endif
+}
+
+} // namespace
+
+int main() {
+  TestStubsArePacked();
+  TestInvalidSizes();
+  TestFragmentation();
+  TestPagesAboveTwoGigabytes();
+  TestClearAndMove();
+  TestProcessPageProvider();
+
+  return ::sgd2mapi_test::GetExitCode();
+}
@@ -0,0 +1,254 @@
+/**
+ * SlashGaming Diablo II Modding API for C++
+ * Copyright (C) 2018-2022  Mir Drualga
+ *
+ * This file is part of SlashGaming Diablo II Modding API for C++.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Additional permissions under GNU Affero General Public License version 3
+ *  section 7
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with Diablo II (or a modified version of that game and its
+ *  libraries), containing parts covered by the terms of Blizzard End User
+ *  License Agreement, the licensors of this Program grant you additional
+ *  permission to convey the resulting work. This additional permission is
+ *  also extended to any combination of expansions, mods, and remasters of
+ *  the game.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any Graphics Device Interface (GDI), DirectDraw, Direct3D,
+ *  Glide, OpenGL, or Rave wrapper (or modified versions of those
+ *  libraries), containing parts not covered by a compatible license, the
+ *  licensors of this Program grant you additional permission to convey the
+ *  resulting work.
+ *
+ *  If you modify this Program, or any covered work, by linking or combining
+ *  it with any library (or a modified version of that library) that links
+ *  to Diablo II (or a modified version of that game and its libraries),
+ *  containing parts not covered by a compatible license, the licensors of
+ *  this Program grant you additional permission to convey the resulting
+ *  work.
+ */
+
+/**
+ * Checks that UnicodeStringArena and UnicodeStringBuilder stop
+ * allocating once they have warmed up. The global operator new is
+ * replaced to count heap allocations.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string_view>
+#include <vector>
+
+#include "../SlashGaming-Diablo-II-API/include/cxx/game_struct/d2_unicode_char/d2_unicode_string_arena.hpp"
+#include "support/sgd2mapi_test.hpp"
+
+namespace {
+
+static std::size_t allocation_count = 0;
+
+} // namespace
+
+void* operator new(std::size_t size) {
+  allocation_count += 1;
+
+  void* ptr = std::malloc(size == 0 ? 1 : size);
+
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+
+  return ptr;
+}
+
+void* operator new[](std::size_t size) {
+  return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t size) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t size) noexcept {
+  std::free(ptr);
+}
+
+namespace {
+
+using ::d2::UnicodeChar;
+using ::d2::UnicodeChar_1_00;
+using ::d2::UnicodeStringArena;
+using ::d2::UnicodeStringBuilder;
+using ::d2::UnicodeStringView_Api;
+
+using UnicodeString_1_00 = std::basic_string<UnicodeChar_1_00>;
+
+static UnicodeString_1_00 MakeString(std::u16string_view str) {
+  UnicodeString_1_00 result;
+
+  for (char16_t ch : str) {
+    result.push_back({ static_cast<std::uint16_t>(ch) });
+  }
+
+  return result;
+}
+
+static UnicodeStringView_Api ToView(const UnicodeString_1_00& str) {
+  return UnicodeStringView_Api(
+      reinterpret_cast<const UnicodeChar*>(str.data()),
+      static_cast<int>(str.length())
+  );
+}
+
+static bool IsViewEqual(
+    UnicodeStringView_Api view,
+    const UnicodeString_1_00& expected
+) {
+  const UnicodeChar_1_00* actual_data =
+      reinterpret_cast<const UnicodeChar_1_00*>(view.data());
+
+  return std::basic_string_view<UnicodeChar_1_00>(
+      actual_data,
+      view.length()
+  ) == expected
+      && actual_data[view.length()].ch == 0;
+}
+
+/**
+ * Builds the strings of one frame, the way a status display would:
+ * several short labels built from pieces, one long line that outgrows
+ * the builder's initial capacity, and copies of fixed strings.
+ */
+static void BuildFrame(
+    UnicodeStringArena& arena,
+    const std::vector<UnicodeString_1_00>& pieces,
+    std::vector<UnicodeStringView_Api>& results
+) {
+  results.clear();
+
+  for (std::size_t i = 0; i < 16; i += 1) {
+    UnicodeStringBuilder builder(arena);
+    builder += ToView(pieces[i % pieces.size()]);
+    builder += ToView(pieces[(i + 1) % pieces.size()]);
+    builder.push_back(
+        reinterpret_cast<const UnicodeChar&>(pieces[0][0])
+    );
+
+    results.push_back(builder);
+  }
+
+  UnicodeStringBuilder long_builder(arena);
+
+  for (std::size_t i = 0; i < 200; i += 1) {
+    long_builder += ToView(pieces[i % pieces.size()]);
+  }
+
+  results.push_back(long_builder);
+
+  for (const UnicodeString_1_00& piece : pieces) {
+    results.push_back(arena.Copy(ToView(piece)));
+  }
+}
+
+static void TestContents() {
+  UnicodeStringArena arena(64);
+
+  UnicodeStringBuilder builder(arena);
+  CHECK(builder.empty());
+  CHECK(IsViewEqual(builder, UnicodeString_1_00()));
+
+  builder += ToView(MakeString(u"Life: "));
+  builder += ToView(MakeString(u"100"));
+  CHECK(IsViewEqual(builder, MakeString(u"Life: 100")));
+
+  // Growing past the chunk length moves the builder to its own chunk.
+  UnicodeString_1_00 long_string(100, UnicodeChar_1_00{ u'x' });
+  builder += ToView(long_string);
+  CHECK(IsViewEqual(builder, MakeString(u"Life: 100") + long_string));
+
+  builder.clear();
+  CHECK(IsViewEqual(builder, UnicodeString_1_00()));
+
+  UnicodeStringView_Api copy = arena.Copy(ToView(MakeString(u"Mana")));
+  CHECK(IsViewEqual(copy, MakeString(u"Mana")));
+}
+
+static void TestSteadyStateDoesNotAllocate() {
+  std::vector<UnicodeString_1_00> pieces = {
+      MakeString(u"Life: "),
+      MakeString(u"1234"),
+      MakeString(u" / "),
+      MakeString(u"ÿc1Fire Resist"),
+      MakeString(u"+75%"),
+  };
+
+  std::vector<UnicodeStringView_Api> results;
+  results.reserve(64);
+
+  UnicodeStringArena arena(256);
+
+  // The first frame allocates the chunks it needs.
+  BuildFrame(arena, pieces, results);
+  arena.Reset();
+
+  std::size_t chunk_count = arena.chunk_count();
+  CHECK(chunk_count > 0);
+
+  std::size_t allocation_count_before = allocation_count;
+
+  for (int frame = 0; frame < 100; frame += 1) {
+    BuildFrame(arena, pieces, results);
+    arena.Reset();
+  }
+
+  CHECK_EQ(allocation_count_before, allocation_count);
+  CHECK_EQ(chunk_count, arena.chunk_count());
+
+  // The strings of the last frame are still correct.
+  BuildFrame(arena, pieces, results);
+  CHECK(IsViewEqual(results[0], pieces[0] + pieces[1] + pieces[0][0]));
+  CHECK(IsViewEqual(results.back(), pieces.back()));
+}
+
+static void TestAllocationCounterWorks() {
+  std::size_t allocation_count_before = allocation_count;
+
+  UnicodeStringArena arena(16);
+  arena.Allocate(8);
+
+  CHECK(allocation_count > allocation_count_before);
+}
+
+} // namespace
+
+int main() {
+  TestAllocationCounterWorks();
+  TestContents();
+  TestSteadyStateDoesNotAllocate();
+
+  return ::sgd2mapi_test::GetExitCode();
+}